@@ -58,6 +58,11 @@
 #define OS_MAX_BIN_SEMAPHORES       20
 #define OS_MAX_MUTEXES              20
 
+/*
+** The maximum number of fixed-block memory pools (OS_MemPoolCreate)
+*/
+#define OS_MAX_MEM_POOLS            16
+
 /*
 ** Maximum length for an absolute path name
 */
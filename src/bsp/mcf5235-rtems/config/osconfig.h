@@ -58,6 +58,11 @@
 #define OS_MAX_BIN_SEMAPHORES       20
 #define OS_MAX_MUTEXES              20
 
+/*
+** The maximum number of fixed-block memory pools (OS_MemPoolCreate)
+*/
+#define OS_MAX_MEM_POOLS            16
+
 /*
 ** Maximum length for an absolute path name
 */
@@ -168,4 +173,15 @@
 */
 #define OS_MAX_TIMERS         5
 
+/*
+** This define sets the maximum number of time base objects
+** The limit depends on the underlying OS and the resources it offers, but in general
+** these are a limited resource and only a handful can be created.
+**
+** This is included as an example, for OSAL implementations that do not [yet] support
+** separate timebase objects, this directive will be ignored.  However, the OSAL unit
+** test stub code does require that this is defined.
+*/
+#define OS_MAX_TIMEBASES      5
+
 #endif
@@ -58,6 +58,17 @@
 #define OS_MAX_BIN_SEMAPHORES       20
 #define OS_MAX_MUTEXES              20
 
+/*
+** The maximum number of fibers (OS_FiberCreate). Fibers are cheap, each one
+** costs only its own stack, so this can be much larger than OS_MAX_TASKS.
+*/
+#define OS_MAX_FIBERS               256
+
+/*
+** The maximum number of fixed-block memory pools (OS_MemPoolCreate)
+*/
+#define OS_MAX_MEM_POOLS            16
+
 /*
 ** Maximum length for an absolute path name
 */
@@ -122,6 +133,27 @@
 */
 #define OS_MAX_NUM_OPEN_FILES 50 
 
+/*
+** The maximum number of asynchronous I/O queues (OS_AsyncQueueCreate), the
+** number of requests each queue can have outstanding, and the number of
+** threads each queue starts when it cannot use io_uring
+*/
+#define OS_MAX_ASYNC_QUEUES   4
+#define OS_ASYNC_QUEUE_DEPTH  64
+#define OS_ASYNC_WORKERS      2
+
+/*
+** The maximum number of buffered file streams (OS_StreamOpen), and the
+** buffer size a stream gets when it is opened with a buffer_size of 0
+*/
+#define OS_MAX_STREAMS                 8
+#define OS_STREAM_DEFAULT_BUFFER_SIZE  4096
+
+/*
+** The maximum number of sync groups (OS_SyncGroupCreate)
+*/
+#define OS_MAX_SYNC_GROUPS    4
+
 /* 
 ** This defines the filethe input command of OS_ShellOutputToFile
 ** is written to in the VxWorks6 port 
@@ -179,8 +211,24 @@
 ** for a timer object; in the case of the newer "posix-ng" and "rtems-ng" variants,
 ** the "timebase" allocates the OS resources and the timer does not use any additional
 ** OS resources. Therefore this limit can be higher.
+**
+** On posix the timer table is allocated when the API is initialized and the
+** timers are kept in a timing wheel, so thousands of timers are practical.
 */
-#define OS_MAX_TIMERS         5
+#define OS_MAX_TIMERS         1024
+
+/*
+** This define sets the tick, in microseconds, of the time base shared by
+** the timers made with OS_TimerCreate. It is the resolution of those timers.
+*/
+#define OS_TIMER_TICK_USEC    1000
+
+/*
+** This define sets the OSAL priority (0 is highest) of the threads that call
+** the timer callbacks. Callbacks run in thread context, so they may use any
+** OSAL call; keep this above the tasks that depend on timely callbacks.
+*/
+#define OS_TIMER_DISPATCH_PRIORITY  0
 
 /*
 ** This define sets the maximum number of open directories
@@ -194,6 +242,37 @@
 */
 #define OS_QUEUE_MAX_DEPTH    50
 
+/*
+ * If OS_LOCK_MEMORY is defined, OS_API_Init will lock all current and future memory of the
+ * process into RAM with mlockall(), and tasks are always created with exactly the stack size
+ * they ask for. This keeps page faults from adding latency while the application runs.
+ * Locking memory needs root (or CAP_IPC_LOCK) and a large enough RLIMIT_MEMLOCK.  Under
+ * OSAL_DEBUG_PERMISSIVE_MODE a failure to lock is ignored.
+ * OS_MemLockGetInfo reports how much memory ended up locked.
+ */
+#undef OS_LOCK_MEMORY
+
+/*
+ * If OS_MONOTONIC_TSC is defined, OS_GetMonotonicTime reads the CPU time stamp counter
+ * (x86-64 only) instead of CLOCK_MONOTONIC. OS_API_Init calibrates the TSC against
+ * CLOCK_MONOTONIC, which takes about 20 msecs, and falls back to the clock when the
+ * CPU does not report an invariant TSC. The result drifts slowly from CLOCK_MONOTONIC,
+ * so use it for short interval measurements.
+ */
+#undef OS_MONOTONIC_TSC
+
+/*
+ * If OS_VIRTUAL_TIME is defined, the POSIX OSAL runs on a virtual clock that starts at
+ * zero. Whenever every task, the main thread and the timer dispatchers are waiting in
+ * the OSAL, the clock jumps to the next pending deadline: task delays, semaphore and
+ * queue timeouts, mutexes and timers all run faster than real time, and a scenario
+ * gives the same time line on every run. Local time is the virtual clock plus the
+ * offset set by OS_SetLocalTime. A task blocked outside of the OSAL (file or socket
+ * I/O, or its own host calls) stops the clock until it comes back, and only OSAL
+ * tasks may wait on OSAL objects. Needs the POSIX message queues (no OSAL_SOCKET_QUEUE).
+ */
+#undef OS_VIRTUAL_TIME
+
 /*
  * If OS_DEBUG_PRINTF is defined, this will enable the "OS_DEBUG" statements in the code
  * This should be left disabled in a normal build as it may affect real time performance as
@@ -98,6 +98,26 @@ typedef struct
     uint32 microsecs;
 }OS_time_t; 
 
+/* task runtime statistics, for OS_TaskGetStats() */
+typedef struct
+{
+    OS_time_t cpu_time;              /* CPU time consumed by the task */
+    uint32    voluntary_switches;    /* context switches where the task blocked */
+    uint32    involuntary_switches;  /* context switches where the task was preempted */
+    uint32    stack_size;            /* bytes of stack covered by the watermark */
+    uint32    stack_high_water;      /* most stack used so far, in bytes */
+}OS_task_stats_t;
+
+/* periodic release schedule, for OS_TaskPeriodInit() / OS_TaskDelayUntil() */
+typedef struct
+{
+    OS_time_t next_release;    /* monotonic time of the next release */
+    uint32    period_usecs;    /* release period, in microseconds */
+    uint32    overruns;        /* releases that were already late when waited for */
+    uint32    missed_periods;  /* releases skipped because of overruns */
+    uint32    last_missed;     /* releases skipped by the most recent wait */
+}OS_task_period_t;
+
 /* heap info */
 typedef struct
 {
@@ -106,6 +126,27 @@ typedef struct
     uint32 largest_free_block;
 }OS_heap_prop_t;
 
+/* memory locking info, for OS_MemLockGetInfo() */
+typedef struct
+{
+    uint32 locked;           /* TRUE if OS_API_Init locked the process memory */
+    uint64 locked_bytes;     /* bytes of the process locked in RAM */
+    uint64 resident_bytes;   /* bytes of the process resident in RAM */
+}OS_mem_lock_prop_t;
+
+/* memory pools */
+typedef struct
+{
+    char   name [OS_MAX_API_NAME];
+    uint32 creator;
+    uint32 block_size;         /* usable bytes per block */
+    uint32 num_blocks;         /* total blocks in the pool */
+    uint32 blocks_free;        /* blocks not allocated right now */
+    uint32 blocks_used_max;    /* most blocks allocated at one time */
+    uint32 alloc_count;        /* successful OS_MemPoolAlloc calls */
+    uint32 alloc_failures;     /* OS_MemPoolAlloc calls that found the pool empty */
+}OS_mem_pool_prop_t;
+
 
 /* This typedef is for the OS_GetErrorName function, to ensure
  * everyone is making an array of the same length.
@@ -132,6 +173,11 @@ typedef osal_task ((*osal_task_entry)(void));
 */
 typedef void (*OS_ArgCallback_t)(uint32 object_id, void *arg);
 
+/*
+** Typedef for the fiber entry point
+*/
+typedef void (*OS_FiberEntry_t)(void *arg);
+
 
 /*
 **  External Declarations
@@ -191,11 +237,32 @@ int32 OS_TaskDelete            (uint32 task_id);
 void OS_TaskExit               (void);
 int32 OS_TaskInstallDeleteHandler(osal_task_entry function_pointer);
 int32 OS_TaskDelay             (uint32 millisecond);
+int32 OS_TaskPeriodInit        (OS_task_period_t *period, uint32 period_usecs);
+int32 OS_TaskDelayUntil        (OS_task_period_t *period);
 int32 OS_TaskSetPriority       (uint32 task_id, uint32 new_priority);
 int32 OS_TaskRegister          (void);
 uint32 OS_TaskGetId            (void);
 int32 OS_TaskGetIdByName       (uint32 *task_id, const char *task_name);
 int32 OS_TaskGetInfo           (uint32 task_id, OS_task_prop_t *task_prop);          
+int32 OS_TaskGetStats          (uint32 task_id, OS_task_stats_t *task_stats);
+
+/*
+** Fiber API
+**
+** Fibers are cooperative contexts that run inside the OSAL task that created
+** them, when that task calls OS_FiberRun. A fiber runs until it yields, waits
+** or returns, so many fibers can share one task without any locking between them.
+*/
+int32 OS_FiberCreate           (uint32 *fiber_id, const char *fiber_name,
+                                OS_FiberEntry_t entry_point, void *arg,
+                                uint32 stack_size);
+int32 OS_FiberRun              (void);
+int32 OS_FiberYield            (void);
+int32 OS_FiberGetId            (uint32 *fiber_id);
+int32 OS_FiberQueueGet         (uint32 queue_id, void *data, uint32 size,
+                                uint32 *size_copied, int32 timeout);
+int32 OS_FiberBinSemWait       (uint32 sem_id, int32 timeout);
+int32 OS_FiberCountSemWait     (uint32 sem_id, int32 timeout);
 
 /*
 ** Message Queue API
@@ -256,6 +323,7 @@ int32 OS_Milli2Ticks           (uint32 milli_seconds);
 int32 OS_Tick2Micros           (void);
 int32  OS_GetLocalTime         (OS_time_t *time_struct);
 int32  OS_SetLocalTime         (OS_time_t *time_struct);  
+int32  OS_GetMonotonicTime     (uint64 *time_nsecs);
 
 /*
 ** Exception API
@@ -306,6 +374,18 @@ int32 OS_ShMemGetIdByName   (uint32 *ShMemId, const char *SegName );
 ** Heap API
 */
 int32 OS_HeapGetInfo       (OS_heap_prop_t *heap_prop);
+int32 OS_MemLockGetInfo    (OS_mem_lock_prop_t *mem_lock_prop);
+
+/*
+** Memory Pool API
+*/
+int32 OS_MemPoolCreate      (uint32 *pool_id, const char *pool_name, uint32 block_size,
+                             uint32 num_blocks, uint32 flags);
+int32 OS_MemPoolDelete      (uint32 pool_id);
+int32 OS_MemPoolAlloc       (uint32 pool_id, void **block);
+int32 OS_MemPoolFree        (uint32 pool_id, void *block);
+int32 OS_MemPoolGetIdByName (uint32 *pool_id, const char *pool_name);
+int32 OS_MemPoolGetInfo     (uint32 pool_id, OS_mem_pool_prop_t *pool_prop);
 
 /*
 ** API for useful debugging function
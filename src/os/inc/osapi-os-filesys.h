@@ -125,6 +125,7 @@
 #ifndef freeRTOS
 #include <dirent.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #endif
 #define OS_READ_ONLY        0
 #define OS_WRITE_ONLY       1
@@ -137,6 +138,37 @@
 #define OS_CHK_ONLY         0
 #define OS_REPAIR           1
 
+/*
+** Modes for OS_fallocate
+*/
+#define OS_FALLOC_KEEP_SIZE   0x01  /* allocate blocks but leave the file size alone */
+#define OS_FALLOC_PUNCH_HOLE  0x02  /* free the blocks of the range; implies OS_FALLOC_KEEP_SIZE */
+
+/*
+** Flags for OS_AsyncQueueCreate
+*/
+#define OS_ASYNC_WORKER_POOL 0x01   /* use worker threads even if io_uring is available */
+
+/*
+** Access pattern hints for OS_madvise
+*/
+#define OS_MADV_NORMAL      0
+#define OS_MADV_SEQUENTIAL  1
+#define OS_MADV_RANDOM      2
+#define OS_MADV_WILLNEED    3
+#define OS_MADV_DONTNEED    4
+
+/*
+** Flags for OS_StreamOpen
+*/
+#define OS_STREAM_SYNC      0x01    /* wait for the data to reach the device on each flush */
+
+/*
+** Flags for OS_SyncGroupCreate
+*/
+#define OS_SYNC_GROUP_FULL    0x01  /* fsync each file, so its metadata is synced as well */
+#define OS_SYNC_GROUP_SYNCFS  0x02  /* sync each file system the files are on, once */
+
 #define FS_BASED            0
 #define RAM_DISK            1
 #define EEPROM_DISK         2
@@ -238,9 +270,56 @@ typedef struct
 typedef struct stat         os_fstat_t;
 typedef DIR*                os_dirp_t;
 typedef struct dirent       os_dirent_t;
+typedef struct iovec        os_iovec_t;
 /* still don't know what this should be*/
 typedef unsigned long int   os_fshealth_t; 
 
+/*
+ * File status with a 64-bit size, as returned by OS_stat64. The layout does
+ * not depend on the off_t width the application was compiled with.
+*/
+typedef struct
+{
+    uint64   FileSize;               /* Size of the file in bytes */
+    uint32   FileModeBits;           /* Type and permission bits, as in st_mode */
+    int64    FileTime;               /* Time of last modification, in seconds */
+} os_fstat64_t;
+
+/*
+ * Entry types reported by OS_ReadDirBatch
+*/
+#define OS_DIRENT_TYPE_UNKNOWN  0
+#define OS_DIRENT_TYPE_FILE     1
+#define OS_DIRENT_TYPE_DIR      2
+#define OS_DIRENT_TYPE_OTHER    3
+
+/*
+ * A directory entry with its metadata, as returned by OS_ReadDirBatch.
+ * Names that do not fit in FileName are truncated.
+*/
+typedef struct
+{
+    char     FileName[OS_MAX_PATH_LEN]; /* Name of the entry within the directory */
+    uint32   FileType;                  /* One of the OS_DIRENT_TYPE_ values */
+    uint64   FileSize;                  /* Size of the entry in bytes */
+    int64    FileTime;                  /* Time of last modification, in seconds */
+} os_dirent_info_t;
+
+/*
+ * Progress callback for long file operations such as OS_cpProgress:
+ * called with the number of bytes done so far and the total
+*/
+typedef void (*OS_FileProgress_t)(uint64 bytes_done, uint64 bytes_total, void *arg);
+
+/*
+ * A finished asynchronous request, as returned by OS_AsyncWait
+*/
+typedef struct
+{
+    void    *user_data;              /* The user_data given with the request */
+    int32    result;                 /* Bytes transferred (0 for fsync) or OS_FS_ERROR */
+} OS_async_completion_t;
+
 /*
  * Exported Functions
 */
@@ -265,6 +344,11 @@ int32           OS_creat  (const char *path, int32  access);
 */
 int32           OS_open   (const char *path,  int32 access,  uint32 mode);
 
+/*
+ * Opens a file like OS_open and allocates blocks for size_hint bytes of it up front
+*/
+int32           OS_openPrealloc (const char *path, int32 access, uint32 mode, int64 size_hint);
+
 /*
  * Closes an open file.
 */
@@ -280,6 +364,41 @@ int32           OS_read   (int32  filedes, void *buffer, uint32 nbytes);
 */
 int32           OS_write  (int32  filedes, void *buffer, uint32 nbytes);
 
+/*
+ * Reads from a file into the iovcnt buffers described by iov, in order
+*/
+int32           OS_readv  (int32  filedes, const os_iovec_t *iov, int32 iovcnt);
+
+/*
+ * Writes the iovcnt buffers described by iov to a file with a single call
+*/
+int32           OS_writev (int32  filedes, const os_iovec_t *iov, int32 iovcnt);
+
+/*
+ * Reads nbytes bytes from file at offset, without moving the file pointer
+*/
+int32           OS_pread  (int32  filedes, void *buffer, uint32 nbytes, int64 offset);
+
+/*
+ * Writes nbytes bytes of buffer into the file at offset, without moving the file pointer
+*/
+int32           OS_pwrite (int32  filedes, void *buffer, uint32 nbytes, int64 offset);
+
+/*
+ * Waits until the data and metadata of a file are on the device
+*/
+int32           OS_fsync  (int32  filedes);
+
+/*
+ * Waits until the data of a file, and the metadata needed to read it back, are on the device
+*/
+int32           OS_fdatasync (int32  filedes);
+
+/*
+ * Allocates or frees the blocks of a range of a file
+*/
+int32           OS_fallocate (int32  filedes, uint32 mode, int64 offset, int64 length);
+
 /*
  * Changes the permissions of a file
 */
@@ -295,6 +414,26 @@ int32           OS_stat   (const char *path, os_fstat_t  *filestats);
 */
 int32           OS_lseek  (int32  filedes, int32 offset, uint32 whence);
 
+/*
+ * Reads up to nbytes bytes from file into buffer; the count may exceed 2 GB
+*/
+int64           OS_read64 (int32  filedes, void *buffer, uint64 nbytes);
+
+/*
+ * Writes up to nbytes bytes of buffer into the file; the count may exceed 2 GB
+*/
+int64           OS_write64(int32  filedes, void *buffer, uint64 nbytes);
+
+/*
+ * Returns file status information, with a 64-bit file size, in filestats
+*/
+int32           OS_stat64 (const char *path, os_fstat64_t *filestats);
+
+/*
+ * Seeks to the specified 64-bit position of an open file 
+*/
+int64           OS_lseek64(int32  filedes, int64 offset, uint32 whence);
+
 /*
  * Removes a file from the file system
 */
@@ -310,6 +449,11 @@ int32           OS_rename (const char *old_filename, const char *new_filename);
 */
 int32 OS_cp (const char *src, const char *dest);
 
+/* 
+ * copies a single file from src to dest, reporting progress to callback
+*/
+int32 OS_cpProgress (const char *src, const char *dest, OS_FileProgress_t callback, void *arg);
+
 /* 
  * moves a single file from src to dest
 */
@@ -365,6 +509,11 @@ void           OS_rewinddir(os_dirp_t directory);
 */
 os_dirent_t *   OS_readdir (os_dirp_t directory);
 
+/*
+ * Reads up to max_entries objects in the directory, with their type, size and time
+*/
+int32           OS_ReadDirBatch (os_dirp_t directory, os_dirent_info_t *entries, uint32 max_entries);
+
 /*
  * Removes an empty directory from the file system.
 */
@@ -438,4 +587,129 @@ int32       OS_GetFsInfo(os_fsinfo_t  *filesys_info);
 /* executes the shell command passed into is and writes the output of that 
  * command to the file specified by the given OSAPI file descriptor */
 int32 OS_ShellOutputToFile(char* Cmd, int32 OS_fd);
+
+/* same as OS_ShellOutputToFile, but kills the command if it runs for longer
+ * than timeout_msecs or writes more than max_bytes (0 means no limit) */
+int32 OS_ShellOutputToFileLimited(char* Cmd, int32 OS_fd, uint32 timeout_msecs, uint32 max_bytes);
+
+/******************************************************************************
+** Asynchronous I/O API
+******************************************************************************/
+
+/*
+ * Creates a queue that file requests are submitted to and completed on
+*/
+int32 OS_AsyncQueueCreate (uint32 *queue_id, const char *queue_name, uint32 flags);
+
+/*
+ * Waits for the outstanding requests of a queue, then deletes it
+*/
+int32 OS_AsyncQueueDelete (uint32 queue_id);
+
+/*
+ * Starts reading nbytes from file at offset into buffer
+*/
+int32 OS_AsyncRead (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                    int64 offset, void *user_data);
+
+/*
+ * Starts writing nbytes of buffer to file at offset
+*/
+int32 OS_AsyncWrite (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                     int64 offset, void *user_data);
+
+/*
+ * Starts flushing the data of a file to its device
+*/
+int32 OS_AsyncFsync (uint32 queue_id, int32 filedes, void *user_data);
+
+/*
+ * Gets the next finished request of a queue, waiting up to msecs for one
+*/
+int32 OS_AsyncWait (uint32 queue_id, OS_async_completion_t *completion, int32 msecs);
+
+/******************************************************************************
+** Memory-mapped file API
+******************************************************************************/
+
+/*
+ * Maps length bytes of an open file, starting at offset, into memory.
+ * OS_READ_ONLY gives a read-only mapping, OS_READ_WRITE a shared one whose
+ * stores go to the file
+*/
+int32 OS_mmap (int32 filedes, int64 offset, uint32 length, int32 access, void **addr);
+
+/*
+ * Maps a whole file, given by its path, into memory and returns its length
+*/
+int32 OS_mmapFile (const char *path, int32 access, void **addr, uint32 *length);
+
+/*
+ * Unmaps memory returned by OS_mmap or OS_mmapFile
+*/
+int32 OS_munmap (void *addr, uint32 length);
+
+/*
+ * Writes the modified pages of a shared mapping back to the file
+*/
+int32 OS_msync (void *addr, uint32 length);
+
+/*
+ * Tells the kernel how a mapping is going to be accessed
+*/
+int32 OS_madvise (void *addr, uint32 length, uint32 advice);
+
+/******************************************************************************
+** Buffered Stream API
+******************************************************************************/
+
+/*
+ * Puts a buffer in front of an open file. Writes are collected in the buffer
+ * and reach the file when it fills up, flush_msecs after the first buffered
+ * write (0 means never), on OS_StreamFlush and on OS_StreamClose
+*/
+int32 OS_StreamOpen (uint32 *stream_id, int32 filedes, uint32 buffer_size,
+                     uint32 flush_msecs, uint32 flags);
+
+/*
+ * Adds nbytes of buffer to a stream
+*/
+int32 OS_StreamWrite (uint32 stream_id, const void *buffer, uint32 nbytes);
+
+/*
+ * Writes the buffered data of a stream to its file
+*/
+int32 OS_StreamFlush (uint32 stream_id);
+
+/*
+ * Flushes a stream, then closes it and its file
+*/
+int32 OS_StreamClose (uint32 stream_id);
+
+/******************************************************************************
+** Sync Group API
+******************************************************************************/
+
+/*
+ * Creates a group that syncs the files added to it together: flush_msecs after
+ * the first file was added (0 means never), when max_pending files are waiting
+ * (0 means no limit) and on OS_SyncGroupCommit
+*/
+int32 OS_SyncGroupCreate (uint32 *group_id, uint32 flush_msecs, uint32 max_pending,
+                          uint32 flags);
+
+/*
+ * Adds an open file with unsynced writes to a sync group
+*/
+int32 OS_SyncGroupAdd (uint32 group_id, int32 filedes);
+
+/*
+ * Syncs the files waiting in a sync group, and returns once they are on the device
+*/
+int32 OS_SyncGroupCommit (uint32 group_id);
+
+/*
+ * Commits a sync group, then deletes it
+*/
+int32 OS_SyncGroupDelete (uint32 group_id);
 #endif
@@ -43,6 +43,13 @@
 typedef void (*OS_TimerCallback_t)(uint32 timer_id);
 typedef int32 (*OS_TimerSync_t)(uint32 timer_id);
 
+/*
+** Buckets of the timer latency histogram: bucket 0 counts callbacks that ran
+** early or less than 1 usec late, bucket i those [2^(i-1), 2^i) usecs late, and the
+** last bucket everything later than that
+*/
+#define OS_TIMER_LATENCY_BUCKETS   16
+
 typedef struct 
 {
    char                name[OS_MAX_API_NAME];
@@ -51,6 +58,20 @@ typedef struct
    uint32              interval_time;
    uint32              accuracy;
 
+   /*
+   ** Callback statistics since the timer was last set, where supported.
+   ** Latency is how long after its expected fire time a callback was
+   ** entered, in usecs, and negative for a callback that ran early. An
+   ** overrun is an expiry that was skipped because the callback for the
+   ** previous one had not run yet.
+   */
+   uint32              fire_count;
+   uint32              overrun_count;
+   int32               min_latency;
+   int32               max_latency;
+   int32               mean_latency;
+   uint32              latency_histogram[OS_TIMER_LATENCY_BUCKETS];
+
 } OS_timer_prop_t;
 
 typedef struct
@@ -67,6 +88,7 @@ typedef struct
 int32  OS_TimerAPIInit          (void);
 
 int32 OS_TimeBaseCreate         (uint32 *timer_id, const char *timebase_name, OS_TimerSync_t external_sync);
+int32 OS_TimeBaseCreateFd       (uint32 *timer_id, const char *timebase_name, int32 sync_fd);
 int32 OS_TimeBaseSet            (uint32 timer_id, uint32 start_time, uint32 interval_time);
 int32 OS_TimeBaseDelete         (uint32 timer_id);
 int32 OS_TimeBaseGetIdByName    (uint32 *timer_id, const char *timebase_name);
@@ -74,6 +96,7 @@ int32 OS_TimeBaseGetIdByName    (uint32 *timer_id, const char *timebase_name);
 int32 OS_TimerCreate            (uint32 *timer_id, const char *timer_name, uint32 *clock_accuracy, OS_TimerCallback_t callback_ptr);
 int32 OS_TimerAdd               (uint32 *timer_id, const char *timer_name, uint32 timebase_id, OS_ArgCallback_t  callback_ptr, void *callback_arg);
 int32 OS_TimerSet               (uint32 timer_id, uint32 start_time, uint32 interval_time);
+int32 OS_TimerSet64             (uint32 timer_id, uint64 start_time, uint64 interval_time);
 int32 OS_TimerDelete            (uint32 timer_id);
 
 int32 OS_TimerGetIdByName       (uint32 *timer_id, const char *timer_name);
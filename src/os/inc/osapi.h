@@ -111,6 +111,9 @@
 #define OS_TIMER_ERR_TIMER_ID          (-30)
 #define OS_TIMER_ERR_UNAVAILABLE       (-31)
 #define OS_TIMER_ERR_INTERNAL          (-32)
+#define OS_ERR_PERIOD_OVERRUN          (-33)
+#define OS_ERR_POOL_EMPTY              (-34)
+#define OS_ERR_OUTPUT_TRUNCATED        (-35)
 
 /*
 ** Defines for Queue Timeout parameters
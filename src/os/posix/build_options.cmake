@@ -21,6 +21,12 @@
 #
 set(OSAL_C_FLAGS "${OSAL_C_FLAGS} -D_XOPEN_SOURCE=600")
 
+# "_FILE_OFFSET_BITS=64" makes off_t and struct stat 64 bits wide on 32-bit hosts too,
+# so files written through the OSAL (and by applications using os_fstat_t) can grow
+# past 2 GB.  It is applied to the whole build so that the OSAL and the applications
+# agree on the layout of os_fstat_t.  It has no effect on 64-bit hosts.
+set(OSAL_C_FLAGS "${OSAL_C_FLAGS} -D_FILE_OFFSET_BITS=64")
+
 # OSAL_LINK_LIBS determines which system-level libraries must be included in the
 # link command in order to produce the final binary.  These libs will be used for
 # ALL targets that utilize the POSIX OS layer.  Additional target-specific libraries 
@@ -100,7 +100,17 @@
 /****************************************************************************************
                                     INCLUDE FILES
 ****************************************************************************************/
+
+/*
+** _GNU_SOURCE is needed for pthread_getattr_np() and syscall(), which are
+** used to collect the per-task runtime statistics
+*/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include <stdio.h>
+#include <stdlib.h>
 #include <sys/types.h>
 #include <ctype.h>
 #include <unistd.h>
@@ -117,6 +127,9 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <limits.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <malloc.h>
 
 /*
 ** The __USE_UNIX98 is for advanced pthread features on linux
@@ -141,6 +154,35 @@
 #include <mqueue.h>
 #endif
 
+#if defined(OS_VIRTUAL_TIME) && defined(OSAL_SOCKET_QUEUE)
+#error "OS_VIRTUAL_TIME needs the POSIX message queues, undefine OSAL_SOCKET_QUEUE"
+#endif
+
+/*
+** The TSC fast path of OS_GetMonotonicTime is only built for x86-64 with GCC
+*/
+#if defined(OS_MONOTONIC_TSC) && defined(__x86_64__) && defined(__GNUC__)
+#define OS_USE_TSC_CLOCK
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+/*
+** The semaphores wait on their condition variables through these, so that
+** with OS_VIRTUAL_TIME they wait on the virtual clock instead
+*/
+#ifdef OS_VIRTUAL_TIME
+#define OS_COND_WAIT(cv, mut)           OS_VirtualTimeCondTimedWait((cv), (mut), NULL)
+#define OS_COND_TIMEDWAIT(cv, mut, ts)  OS_VirtualTimeCondTimedWait((cv), (mut), (ts))
+#define OS_COND_SIGNAL(cv)              OS_VirtualTimeCondSignal(cv)
+#define OS_COND_BROADCAST(cv)           OS_VirtualTimeCondBroadcast(cv)
+#else
+#define OS_COND_WAIT(cv, mut)           pthread_cond_wait((cv), (mut))
+#define OS_COND_TIMEDWAIT(cv, mut, ts)  pthread_cond_timedwait((cv), (mut), (ts))
+#define OS_COND_SIGNAL(cv)              pthread_cond_signal(cv)
+#define OS_COND_BROADCAST(cv)           pthread_cond_broadcast(cv)
+#endif
+
 /*
 ** Defines
 */
@@ -155,6 +197,18 @@
 
 #define OS_SHUTDOWN_MAGIC_NUMBER    0xABADC0DE
 
+/*
+** Pattern painted over a new task's stack, and the number of bytes left
+** unpainted below the entry frame so the painting code does not overwrite itself
+*/
+#define OS_STACK_WATERMARK          0xA5C3A5C3
+#define OS_STACK_PAINT_MARGIN       1024
+
+/*
+** Deadline of a virtual time wait that has no timeout
+*/
+#define OS_VTIME_FOREVER            0xFFFFFFFFFFFFFFFFULL
+
 /*
 ** Global data for the API
 */
@@ -173,6 +227,11 @@ typedef struct
     uint32    stack_size;
     uint32    priority;
     osal_task_entry  delete_hook_pointer;
+    osal_task_entry  entry_point;
+    pid_t     host_tid;      /* kernel thread id, 0 once the thread is gone */
+    uint32   *stack_low;     /* lowest word of the watermarked stack area */
+    uint32   *stack_high;    /* word just above the watermarked stack area */
+    uint32   *stack_mark;    /* lowest word found overwritten so far */
 }OS_task_internal_record_t;
     
 #ifdef OSAL_SOCKET_QUEUE
@@ -230,6 +289,46 @@ typedef struct
     int             creator;
 }OS_mut_sem_internal_record_t;
 
+/*
+** Memory pools hand out fixed size blocks carved from one region.
+** The free blocks form a lock-free stack: free_head holds the index of
+** the top block in the low 32 bits and a modification count in the high
+** 32 bits, so that a pop racing with a pop/push pair cannot succeed
+** against a stale head.  next_free links each free block to the next one.
+*/
+typedef struct
+{
+    int             free;
+    char            name [OS_MAX_API_NAME];
+    int             creator;
+    uint8          *region;
+    uint32          block_size;
+    uint32          num_blocks;
+    uint32         *next_free;
+    uint8          *in_use;
+    uint64          free_head;
+    uint32          blocks_free;
+    uint32          blocks_used_max;
+    uint32          alloc_count;
+    uint32          alloc_failures;
+}OS_mem_pool_internal_record_t;
+
+#ifdef OS_VIRTUAL_TIME
+/*
+** A thread waiting on the virtual clock, for an object to be signalled
+** or for its deadline, whichever comes first
+*/
+typedef struct OS_vtime_waiter
+{
+    struct OS_vtime_waiter *next;
+    const void             *object;
+    uint64                  deadline;
+    uint32                  counted;    /* FALSE if the thread was idle already */
+    uint32                  woken;
+    uint32                  timed_out;
+}OS_vtime_waiter_t;
+#endif
+
 /* function pointer type */
 typedef void (*FuncPtr_t)(void);
 
@@ -239,6 +338,7 @@ OS_queue_internal_record_t   OS_queue_table         [OS_MAX_QUEUES];
 OS_bin_sem_internal_record_t OS_bin_sem_table       [OS_MAX_BIN_SEMAPHORES];
 OS_count_sem_internal_record_t OS_count_sem_table   [OS_MAX_COUNT_SEMAPHORES];
 OS_mut_sem_internal_record_t OS_mut_sem_table       [OS_MAX_MUTEXES];
+OS_mem_pool_internal_record_t OS_mem_pool_table     [OS_MAX_MEM_POOLS];
 
 pthread_key_t    thread_key;
 
@@ -247,9 +347,39 @@ pthread_mutex_t OS_queue_table_mut;
 pthread_mutex_t OS_bin_sem_table_mut;
 pthread_mutex_t OS_mut_sem_table_mut;
 pthread_mutex_t OS_count_sem_table_mut;
+pthread_mutex_t OS_mem_pool_table_mut;
 
 uint32          OS_printf_enabled = TRUE;
 volatile uint32 OS_shutdown = FALSE;
+uint32          OS_memory_locked = FALSE;
+
+#ifdef OS_VIRTUAL_TIME
+/*
+** The virtual clock, in nanoseconds. Every thread that can wait on it (the
+** main thread, the tasks and the time base dispatchers) is counted in
+** OS_vtime_running while it is not waiting. When the count drops to zero the
+** clock jumps to the earliest deadline in OS_vtime_waiters. A thread that is
+** blocked outside of the OSAL, on a time base sync source, is marked idle.
+*/
+pthread_mutex_t    OS_vtime_mut     = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t     OS_vtime_cv      = PTHREAD_COND_INITIALIZER;
+uint64             OS_vtime_now     = 0;
+int64              OS_vtime_offset  = 0;
+int32              OS_vtime_running = 1;
+OS_vtime_waiter_t *OS_vtime_waiters = NULL;
+static __thread uint32 OS_vtime_idle = FALSE;
+#endif
+
+#ifdef OS_USE_TSC_CLOCK
+/*
+** TSC calibration for OS_GetMonotonicTime: nanoseconds = base_nsecs +
+** ((tsc - base_tsc) * mult) >> 32. Left disabled if the TSC is not invariant.
+*/
+uint32          OS_tsc_enabled = FALSE;
+uint64          OS_tsc_base;
+uint64          OS_tsc_base_nsecs;
+uint64          OS_tsc_mult;
+#endif
 
 /*
 ** Local Function Prototypes
@@ -260,6 +390,108 @@ uint32  OS_FindCreator(void);
 int32   OS_PriorityRemap(uint32 InputPri);
 int     OS_InterruptSafeLock(pthread_mutex_t *lock, sigset_t *set, sigset_t *previous);
 void    OS_InterruptSafeUnlock(pthread_mutex_t *lock, sigset_t *previous);
+int32   OS_FiberAPIInit(void);
+#ifdef OS_USE_TSC_CLOCK
+void    OS_TscCalibrate(void);
+#endif
+#ifdef OS_VIRTUAL_TIME
+int     OS_VirtualTimeCondTimedWait(const void *cond, pthread_mutex_t *mut, const struct timespec *abstime);
+int     OS_VirtualTimeCondSignal(const void *cond);
+int     OS_VirtualTimeCondBroadcast(const void *cond);
+int32   OS_VirtualTimeSleepUntil(uint64 deadline);
+void    OS_VirtualTimeThreadStart(void);
+void    OS_VirtualTimeThreadEnd(void *arg);
+void    OS_VirtualTimeSetIdle(uint32 idle);
+#endif
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_GetProcFields
+
+   Purpose: Reads a /proc status file line by line and converts the value of each
+            "Name:   value" line whose name is in names. The file is read to the end,
+            however long it is, so fields near the end are not cut off.
+
+   returns: OS_ERROR if the file could not be read or a field is not there
+            OS_SUCCESS otherwise
+---------------------------------------------------------------------------------------*/
+static int32 OS_GetProcFields(const char *path, const char * const *names, uint64 *values,
+                              uint32 count)
+{
+    FILE    *file;
+    char     line[256];
+    uint32   found;
+    uint32   at_line_start;
+    uint32   name_len;
+    uint32   i;
+
+    file = fopen(path, "r");
+    if (file == NULL)
+    {
+        return OS_ERROR;
+    }
+
+    found         = 0;
+    at_line_start = TRUE;
+    while (found < count && fgets(line, sizeof(line), file) != NULL)
+    {
+        /*
+        ** A line longer than the buffer comes back in pieces; only the
+        ** first piece starts with a name
+        */
+        if (at_line_start == TRUE)
+        {
+            for (i = 0; i < count; i++)
+            {
+                name_len = strlen(names[i]);
+                if (strncmp(line, names[i], name_len) == 0 && line[name_len] == ':')
+                {
+                    values[i] = strtoull(line + name_len + 1, NULL, 10);
+                    ++found;
+                    break;
+                }
+            }
+        }
+        at_line_start = (strchr(line, '\n') != NULL);
+    }
+
+    fclose(file);
+
+    return (found == count) ? OS_SUCCESS : OS_ERROR;
+}
+
+#ifdef OS_LOCK_MEMORY
+/*---------------------------------------------------------------------------------------
+   Name: OS_LockMemory
+
+   Purpose: Locks all current and future pages of the process into RAM, and stops
+            malloc from handing freed memory back to the system, so it does not have
+            to be faulted in again later.
+
+   returns: OS_ERROR if mlockall fails (OS_SUCCESS in permissive mode)
+            OS_SUCCESS otherwise
+---------------------------------------------------------------------------------------*/
+static int32 OS_LockMemory(void)
+{
+    mallopt(M_TRIM_THRESHOLD, -1);
+    mallopt(M_MMAP_MAX, 0);
+
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        #ifdef OS_DEBUG_PRINTF
+           printf("OS_API_Init: mlockall failed: %s\n", strerror(errno));
+        #endif
+        #ifdef OSAL_DEBUG_PERMISSIVE_MODE
+           return OS_SUCCESS;
+        #else
+           return OS_ERROR;
+        #endif
+    }
+
+    OS_memory_locked = TRUE;
+
+    return OS_SUCCESS;
+}
+#endif
 
 /*---------------------------------------------------------------------------------------
    Name: OS_NoopSigHandler
@@ -329,6 +561,28 @@ int32 OS_API_Init(void)
    */
    signal(SIGHUP, OS_NoopSigHandler);
 
+#ifdef OS_LOCK_MEMORY
+   return_code = OS_LockMemory();
+   if ( return_code != OS_SUCCESS )
+   {
+      return(return_code);
+   }
+#endif
+
+#ifdef OS_USE_TSC_CLOCK
+   OS_TscCalibrate();
+#endif
+
+   /*
+   ** Touch every page of the object tables now, so that creating
+   ** objects later does not take page faults
+   */
+   memset(OS_task_table, 0, sizeof(OS_task_table));
+   memset(OS_queue_table, 0, sizeof(OS_queue_table));
+   memset(OS_bin_sem_table, 0, sizeof(OS_bin_sem_table));
+   memset(OS_count_sem_table, 0, sizeof(OS_count_sem_table));
+   memset(OS_mut_sem_table, 0, sizeof(OS_mut_sem_table));
+   memset(OS_mem_pool_table, 0, sizeof(OS_mem_pool_table));
 
     /* Initialize Task Table */
    
@@ -337,6 +591,11 @@ int32 OS_API_Init(void)
         OS_task_table[i].free                = TRUE;
         OS_task_table[i].creator             = UNINITIALIZED;
         OS_task_table[i].delete_hook_pointer = NULL;
+        OS_task_table[i].entry_point         = NULL;
+        OS_task_table[i].host_tid            = 0;
+        OS_task_table[i].stack_low           = NULL;
+        OS_task_table[i].stack_high          = NULL;
+        OS_task_table[i].stack_mark          = NULL;
         strcpy(OS_task_table[i].name,"");    
     }
 
@@ -375,6 +634,16 @@ int32 OS_API_Init(void)
         strcpy(OS_mut_sem_table[i].name,"");
     }
 
+    /* Initialize Memory Pool Table */
+
+    for(i = 0; i < OS_MAX_MEM_POOLS; i++)
+    {
+        OS_mem_pool_table[i].free        = TRUE;
+        OS_mem_pool_table[i].creator     = UNINITIALIZED;
+        OS_mem_pool_table[i].region      = NULL;
+        strcpy(OS_mem_pool_table[i].name,"");
+    }
+
    /*
    ** Initialize the module loader
    */
@@ -395,6 +664,15 @@ int32 OS_API_Init(void)
       return(return_code);
    }
 
+   /*
+   ** Initialize the Fiber API
+   */
+   return_code = OS_FiberAPIInit();
+   if ( return_code == OS_ERROR )
+   {
+      return(return_code);
+   }
+
    ret = pthread_key_create(&thread_key, NULL );
    if ( ret != 0 )
    {
@@ -479,6 +757,12 @@ int32 OS_API_Init(void)
       return_code = OS_ERROR;
       return(return_code);
    }
+   ret = pthread_mutex_init((pthread_mutex_t *) & OS_mem_pool_table_mut,&mutex_attr); 
+   if ( ret != 0 )
+   {
+      return_code = OS_ERROR;
+      return(return_code);
+   }
 
    /*
    ** File system init
@@ -583,10 +867,30 @@ void OS_DeleteAllObjects       (void)
     {
         OS_TimerDelete(i);
     }
+    for (i = 0; i < OS_MAX_TIMEBASES; ++i)
+    {
+        OS_TimeBaseDelete(i);
+    }
+    for (i = 0; i < OS_MAX_MEM_POOLS; ++i)
+    {
+        OS_MemPoolDelete(i);
+    }
     for (i = 0; i < OS_MAX_MODULES; ++i)
     {
         OS_ModuleUnload(i);
     }
+    for (i = 0; i < OS_MAX_ASYNC_QUEUES; ++i)
+    {
+        OS_AsyncQueueDelete(i);
+    }
+    for (i = 0; i < OS_MAX_STREAMS; ++i)
+    {
+        OS_StreamClose(i);
+    }
+    for (i = 0; i < OS_MAX_SYNC_GROUPS; ++i)
+    {
+        OS_SyncGroupDelete(i);
+    }
     for (i = 0; i < OS_MAX_NUM_OPEN_FILES; ++i)
     {
         OS_close(i);
@@ -606,6 +910,23 @@ void OS_DeleteAllObjects       (void)
 void OS_IdleLoop()
 {
    sigset_t mask;
+#ifdef OS_VIRTUAL_TIME
+   sigset_t previous;
+
+   /*
+   ** The main thread has to wait on the virtual clock like the tasks, or the
+   ** clock would never move. OS_ApplicationShutdown signals OS_shutdown.
+   */
+   sigemptyset(&mask);
+   pthread_sigmask(SIG_SETMASK, &mask, &previous);
+   pthread_mutex_lock(&OS_task_table_mut);
+   while (OS_shutdown != OS_SHUTDOWN_MAGIC_NUMBER)
+   {
+      OS_VirtualTimeCondTimedWait((void *)&OS_shutdown, &OS_task_table_mut, NULL);
+   }
+   pthread_mutex_unlock(&OS_task_table_mut);
+   pthread_sigmask(SIG_SETMASK, &previous, NULL);
+#else
 
    /* All signals should be unblocked in this thread while suspended */
    sigemptyset(&mask);
@@ -615,6 +936,7 @@ void OS_IdleLoop()
       /* Unblock signals and wait for something to occur */
       sigsuspend(&mask);
    }
+#endif
 }
 
 
@@ -634,6 +956,12 @@ void OS_ApplicationShutdown(uint8 flag)
       OS_shutdown = OS_SHUTDOWN_MAGIC_NUMBER;
    }
 
+#ifdef OS_VIRTUAL_TIME
+   pthread_mutex_lock(&OS_task_table_mut);
+   OS_VirtualTimeCondBroadcast((void *)&OS_shutdown);
+   pthread_mutex_unlock(&OS_task_table_mut);
+#endif
+
    /*
     * Raise a signal that is unblocked in OS_IdleLoop(),
     * which should break it out of the sigsuspend() call.
@@ -649,6 +977,115 @@ void OS_ApplicationShutdown(uint8 flag)
 **********************************************************************************
 */
 
+/*---------------------------------------------------------------------------------------
+   Name: OS_TaskStackPaint
+
+   Purpose: Fills the unused part of the calling task's stack with OS_STACK_WATERMARK
+            so OS_TaskGetStats can find how deep the stack has been used.
+            Only the part of the stack the task asked for is painted, starting just
+            below the current stack frame. This also faults in those stack pages
+            before the task runs, so it does not page fault as its stack grows.
+
+   returns: nothing
+---------------------------------------------------------------------------------------*/
+static void OS_TaskStackPaint(uint32 task_id)
+{
+    pthread_attr_t     attr;
+    void              *stack_addr;
+    size_t             stack_size;
+    size_t             paint_size;
+    volatile uint32    frame_marker;
+    uint32            *low;
+    uint32            *high;
+    uint32            *p;
+    sigset_t           previous;
+    sigset_t           mask;
+
+    if (pthread_getattr_np(pthread_self(), &attr) != 0)
+    {
+        return;
+    }
+    if (pthread_attr_getstack(&attr, &stack_addr, &stack_size) != 0)
+    {
+        pthread_attr_destroy(&attr);
+        return;
+    }
+    pthread_attr_destroy(&attr);
+
+    high = (uint32 *)(((cpuaddr)&frame_marker - OS_STACK_PAINT_MARGIN) & ~(cpuaddr)(sizeof(uint32) - 1));
+    low  = (uint32 *)stack_addr;
+    if (high <= low)
+    {
+        return;
+    }
+
+    paint_size = OS_task_table[task_id].stack_size;
+    if (paint_size < PTHREAD_STACK_MIN)
+    {
+        paint_size = PTHREAD_STACK_MIN;
+    }
+    if ((size_t)(high - low) > paint_size / sizeof(uint32))
+    {
+        low = high - (paint_size / sizeof(uint32));
+    }
+
+    for (p = low; p < high; ++p)
+    {
+        *p = OS_STACK_WATERMARK;
+    }
+
+    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
+    OS_task_table[task_id].stack_low  = low;
+    OS_task_table[task_id].stack_high = high;
+    OS_task_table[task_id].stack_mark = high;
+    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+
+}/* end OS_TaskStackPaint */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_PthreadEntry
+
+   Purpose: Common pthread entry point for all OSAL tasks. Records the kernel thread
+            id and paints the stack watermark before calling the user entry point.
+
+   returns: NULL
+---------------------------------------------------------------------------------------*/
+static void *OS_PthreadEntry(void *arg)
+{
+    uint32    task_id = (uint32)(cpuaddr)arg;
+    sigset_t  previous;
+    sigset_t  mask;
+
+    OS_task_table[task_id].host_tid = (pid_t)syscall(SYS_gettid);
+
+    OS_TaskStackPaint(task_id);
+
+#ifdef OS_VIRTUAL_TIME
+    /*
+    ** However the task ends, it stops holding back the virtual clock
+    */
+    pthread_cleanup_push(OS_VirtualTimeThreadEnd, NULL);
+#endif
+
+    (*OS_task_table[task_id].entry_point)();
+
+#ifdef OS_VIRTUAL_TIME
+    pthread_cleanup_pop(1);
+#endif
+
+    /*
+    ** The stack goes away with the thread, so stop OS_TaskGetStats from looking at it
+    */
+    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
+    OS_task_table[task_id].host_tid   = 0;
+    OS_task_table[task_id].stack_low  = NULL;
+    OS_task_table[task_id].stack_high = NULL;
+    OS_task_table[task_id].stack_mark = NULL;
+    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+
+    return NULL;
+}/* end OS_PthreadEntry */
+
 /*---------------------------------------------------------------------------------------
    Name: OS_TaskCreate
 
@@ -769,6 +1206,24 @@ int32 OS_TaskCreate (uint32 *task_id, const char *task_name, osal_task_entry fun
     }
 
 
+#ifdef OS_LOCK_MEMORY
+    /*
+    ** All of a thread's stack is locked in RAM, so use the size that was
+    ** asked for rather than the (much larger) default, even when not root
+    */
+    if (pthread_attr_setstacksize(&custom_attr, (size_t)local_stack_size ))
+    {
+       pthread_attr_destroy(&custom_attr);
+       OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
+       OS_task_table[possible_taskid].free = TRUE;
+       OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+       #ifdef OS_DEBUG_PRINTF
+          printf("pthread_attr_setstacksize error in OS_TaskCreate, Task ID = %d\n",possible_taskid);
+       #endif
+       return(OS_ERROR);
+    }
+#endif
+
     /*
     ** Test to see if the user is running as root.
     ** root is required to set the scheduling policy, stack, and priority
@@ -828,15 +1283,32 @@ int32 OS_TaskCreate (uint32 *task_id, const char *task_name, osal_task_entry fun
 
     } /* End if user is root */
 
+    /*
+    ** The entry point and stack size are needed by OS_PthreadEntry,
+    ** so they must be in the table before the thread starts
+    */
+    OS_task_table[possible_taskid].entry_point = function_pointer;
+    OS_task_table[possible_taskid].stack_size  = stack_size;
+    OS_task_table[possible_taskid].host_tid    = 0;
+    OS_task_table[possible_taskid].stack_low   = NULL;
+    OS_task_table[possible_taskid].stack_high  = NULL;
+    OS_task_table[possible_taskid].stack_mark  = NULL;
+
     /*
     ** Create thread
     */
+#ifdef OS_VIRTUAL_TIME
+    OS_VirtualTimeThreadStart();
+#endif
     return_code = pthread_create(&(OS_task_table[possible_taskid].id),
                                  &custom_attr,
-                                 (void*(*)(void*))function_pointer,
-                                 (void *)0);
+                                 OS_PthreadEntry,
+                                 (void *)(cpuaddr)possible_taskid);
     if (return_code != 0)
     {
+#ifdef OS_VIRTUAL_TIME
+        OS_VirtualTimeThreadEnd(NULL);
+#endif
         OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
         OS_task_table[possible_taskid].free = TRUE;
         OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
@@ -929,6 +1401,17 @@ int32 OS_TaskDelete (uint32 task_id)
        (*FunctionPointer)();
     }
 
+    /*
+    ** The thread's stack is released once it is cancelled, so stop
+    ** OS_TaskGetStats from looking at it first
+    */
+    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
+    OS_task_table[task_id].host_tid   = 0;
+    OS_task_table[task_id].stack_low  = NULL;
+    OS_task_table[task_id].stack_high = NULL;
+    OS_task_table[task_id].stack_mark = NULL;
+    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+
     /* 
     ** Try to delete the task 
     */
@@ -986,6 +1469,11 @@ void OS_TaskExit()
     OS_task_table[task_id].priority = UNINITIALIZED;
     OS_task_table[task_id].id = UNINITIALIZED;
     OS_task_table[task_id].delete_hook_pointer = NULL;
+    OS_task_table[task_id].entry_point = NULL;
+    OS_task_table[task_id].host_tid = 0;
+    OS_task_table[task_id].stack_low = NULL;
+    OS_task_table[task_id].stack_high = NULL;
+    OS_task_table[task_id].stack_mark = NULL;
     
     OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
 
@@ -1002,6 +1490,12 @@ void OS_TaskExit()
 ---------------------------------------------------------------------------------------*/
 int32 OS_TaskDelay(uint32 millisecond )
 {
+#ifdef OS_VIRTUAL_TIME
+    uint64          now;
+
+    OS_GetMonotonicTime(&now);
+    return OS_VirtualTimeSleepUntil(now + ((uint64)millisecond * 1000000));
+#else
     struct timespec waittime;
     uint32          ms = millisecond;
     int             sleepstat;
@@ -1026,65 +1520,217 @@ int32 OS_TaskDelay(uint32 millisecond )
     {
        return OS_SUCCESS;
     }
+#endif
     
 }/* end OS_TaskDelay */
 
 /*---------------------------------------------------------------------------------------
-   Name: OS_TaskSetPriority
+   Name: OS_TaskPeriodClock
 
-   Purpose: Sets the given task to a new priority
+   Purpose: Reads the clock that periodic schedules run on: CLOCK_MONOTONIC, or the
+            virtual clock with OS_VIRTUAL_TIME
 
-    returns: OS_ERR_INVALID_ID if the ID passed to it is invalid
-             OS_ERR_INVALID_PRIORITY if the priority is greater than the max 
-             allowed
-             OS_ERROR if the OS call to change the priority fails
-             OS_SUCCESS if success
+   returns: 0 if success, -1 if the clock cannot be read
 ---------------------------------------------------------------------------------------*/
-int32 OS_TaskSetPriority (uint32 task_id, uint32 new_priority)
+static int OS_TaskPeriodClock(struct timespec *now)
 {
-    int                os_priority;
-    int                ret;
+#ifdef OS_VIRTUAL_TIME
+    uint64 now_nsecs;
 
-    if(task_id >= OS_MAX_TASKS || OS_task_table[task_id].free == TRUE)
-    {
-        return OS_ERR_INVALID_ID;
-    }
+    OS_GetMonotonicTime(&now_nsecs);
+    now->tv_sec  = now_nsecs / 1000000000;
+    now->tv_nsec = now_nsecs % 1000000000;
+    return 0;
+#else
+    return clock_gettime(CLOCK_MONOTONIC, now);
+#endif
+}/* end OS_TaskPeriodClock */
 
-    if (new_priority > MAX_PRIORITY)
+/*---------------------------------------------------------------------------------------
+   Name: OS_TaskPeriodInit
+
+   Purpose: Starts a periodic release schedule for use with OS_TaskDelayUntil.
+            The first release is one period after this call. Release times are
+            taken from CLOCK_MONOTONIC so setting the wall clock does not move them.
+
+   returns: OS_INVALID_POINTER if period is NULL
+            OS_ERROR if period_usecs is 0 or the clock cannot be read
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskPeriodInit(OS_task_period_t *period, uint32 period_usecs)
+{
+    struct timespec now;
+    uint64          release_usecs;
+
+    if (period == NULL)
     {
-        return OS_ERR_INVALID_PRIORITY;
+       return OS_INVALID_POINTER;
     }
-   
-    /* Change OSAL priority into a priority that will work for this OS */
-    os_priority = OS_PriorityRemap(new_priority);
 
-    if (geteuid() == 0 )
+    if (period_usecs == 0 || OS_TaskPeriodClock(&now) != 0)
     {
-       /* 
-       ** Set priority
-       */
-       ret = pthread_setschedprio(OS_task_table[task_id].id, os_priority);
-       if( ret != 0 )
-       {
-          #ifdef OS_DEBUG_PRINTF
-             printf("pthread_setschedprio err in OS_TaskSetPriority, Task ID = %lu, prio = %d, errno = %s\n",
-                        task_id,os_priority ,strerror(errno));
-          #endif
-          return(OS_ERROR);
-       }
+       return OS_ERROR;
     }
 
-    /* Use the abstracted priority, not the OS one */
-    /* Change the priority in the table as well */
-    OS_task_table[task_id].priority = new_priority;
+    release_usecs = ((uint64)now.tv_sec * 1000000) + (now.tv_nsec / 1000) + period_usecs;
 
-   return OS_SUCCESS;
-} /* end OS_TaskSetPriority */
+    period->next_release.seconds   = release_usecs / 1000000;
+    period->next_release.microsecs = release_usecs % 1000000;
+    period->period_usecs           = period_usecs;
+    period->overruns               = 0;
+    period->missed_periods         = 0;
+    period->last_missed            = 0;
 
+    return OS_SUCCESS;
+
+}/* end OS_TaskPeriodInit */
 
 /*---------------------------------------------------------------------------------------
-   Name: OS_TaskRegister
-  
+   Name: OS_TaskDelayUntil
+
+   Purpose: Delays the calling task until the next release time of its periodic
+            schedule, then advances the schedule by one period. Because the release
+            times are absolute, the time spent running between calls does not make
+            the period drift.
+
+            If the release time has already passed the call returns at once. Any
+            whole periods that passed as well are skipped, so the schedule stays on
+            its original time grid. The number skipped is put in last_missed.
+
+   returns: OS_INVALID_POINTER if period is NULL
+            OS_ERROR if the schedule was not initialized or the sleep fails
+            OS_ERR_PERIOD_OVERRUN if the release time had already passed
+            OS_SUCCESS if the task was released on time
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskDelayUntil(OS_task_period_t *period)
+{
+    struct timespec now;
+#ifndef OS_VIRTUAL_TIME
+    struct timespec release;
+#endif
+    uint64          now_usecs;
+    uint64          release_usecs;
+    uint64          missed;
+    int32           return_code;
+    int             status;
+
+    if (period == NULL)
+    {
+       return OS_INVALID_POINTER;
+    }
+
+    if (period->period_usecs == 0 || OS_TaskPeriodClock(&now) != 0)
+    {
+       return OS_ERROR;
+    }
+
+    now_usecs     = ((uint64)now.tv_sec * 1000000) + (now.tv_nsec / 1000);
+    release_usecs = ((uint64)period->next_release.seconds * 1000000) + period->next_release.microsecs;
+
+    if (now_usecs > release_usecs)
+    {
+       /*
+       ** Overrun: run now, for the latest release that has passed
+       */
+       missed = (now_usecs - release_usecs) / period->period_usecs;
+       release_usecs += missed * period->period_usecs;
+
+       period->overruns++;
+       period->missed_periods += missed;
+       period->last_missed     = missed;
+       return_code = OS_ERR_PERIOD_OVERRUN;
+    }
+    else
+    {
+       /*
+       ** The wake up time is absolute, so an interrupted sleep can just be restarted
+       */
+#ifdef OS_VIRTUAL_TIME
+       status = (OS_VirtualTimeSleepUntil(release_usecs * 1000) == OS_SUCCESS) ? 0 : -1;
+#else
+       release.tv_sec  = release_usecs / 1000000;
+       release.tv_nsec = (release_usecs % 1000000) * 1000;
+
+       do
+       {
+          status = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &release, NULL);
+       }
+       while ( status == EINTR );
+#endif
+
+       if ( status != 0 )
+       {
+          return OS_ERROR;
+       }
+
+       period->last_missed = 0;
+       return_code = OS_SUCCESS;
+    }
+
+    release_usecs += period->period_usecs;
+    period->next_release.seconds   = release_usecs / 1000000;
+    period->next_release.microsecs = release_usecs % 1000000;
+
+    return return_code;
+
+}/* end OS_TaskDelayUntil */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_TaskSetPriority
+
+   Purpose: Sets the given task to a new priority
+
+    returns: OS_ERR_INVALID_ID if the ID passed to it is invalid
+             OS_ERR_INVALID_PRIORITY if the priority is greater than the max 
+             allowed
+             OS_ERROR if the OS call to change the priority fails
+             OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskSetPriority (uint32 task_id, uint32 new_priority)
+{
+    int                os_priority;
+    int                ret;
+
+    if(task_id >= OS_MAX_TASKS || OS_task_table[task_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    if (new_priority > MAX_PRIORITY)
+    {
+        return OS_ERR_INVALID_PRIORITY;
+    }
+   
+    /* Change OSAL priority into a priority that will work for this OS */
+    os_priority = OS_PriorityRemap(new_priority);
+
+    if (geteuid() == 0 )
+    {
+       /* 
+       ** Set priority
+       */
+       ret = pthread_setschedprio(OS_task_table[task_id].id, os_priority);
+       if( ret != 0 )
+       {
+          #ifdef OS_DEBUG_PRINTF
+             printf("pthread_setschedprio err in OS_TaskSetPriority, Task ID = %lu, prio = %d, errno = %s\n",
+                        task_id,os_priority ,strerror(errno));
+          #endif
+          return(OS_ERROR);
+       }
+    }
+
+    /* Use the abstracted priority, not the OS one */
+    /* Change the priority in the table as well */
+    OS_task_table[task_id].priority = new_priority;
+
+   return OS_SUCCESS;
+} /* end OS_TaskSetPriority */
+
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_TaskRegister
+  
    Purpose: Registers the calling task id with the task by adding the var to the tcb
             It searches the OS_task_table to find the task_id corresponding to the tcb_id
             
@@ -1250,6 +1896,132 @@ int32 OS_TaskGetInfo (uint32 task_id, OS_task_prop_t *task_prop)
     
 } /* end OS_TaskGetInfo */
 
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskReadSwitchCounts
+
+    Purpose: Reads the voluntary and involuntary context switch counts of a thread
+             from /proc/self/task/<tid>/status
+
+    Returns: OS_ERROR if the status file could not be read
+             OS_SUCCESS otherwise
+---------------------------------------------------------------------------------------*/
+static int32 OS_TaskReadSwitchCounts(pid_t host_tid, uint32 *voluntary, uint32 *involuntary)
+{
+    static const char * const names[2] = { "voluntary_ctxt_switches", "nonvoluntary_ctxt_switches" };
+    char     path[64];
+    uint64   values[2];
+
+    snprintf(path, sizeof(path), "/proc/self/task/%d/status", (int)host_tid);
+
+    if (OS_GetProcFields(path, names, values, 2) != OS_SUCCESS)
+    {
+        return OS_ERROR;
+    }
+
+    *voluntary   = values[0];
+    *involuntary = values[1];
+
+    return OS_SUCCESS;
+}/* end OS_TaskReadSwitchCounts */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskGetStats
+
+    Purpose: This function will pass back the runtime statistics of the specified task:
+             the CPU time it has used, the number of voluntary and involuntary context
+             switches, and the deepest stack usage seen so far.
+
+    Returns: OS_ERR_INVALID_ID if the ID passed to it is invalid or the task has ended
+             OS_INVALID_POINTER if the task_stats pointer is NULL
+             OS_ERROR if the OS calls to get the statistics fail
+             OS_SUCCESS if it copied all of the statistics over
+
+    Notes: The stack is scanned from the bottom up to the deepest point found by the
+           previous call, with the task table unlocked, so sampling every task
+           periodically stays cheap and does not hold up other task calls.
+           stack_size and stack_high_water are 0 if the stack could not be painted.
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskGetStats (uint32 task_id, OS_task_stats_t *task_stats)
+{
+    clockid_t        cpu_clock;
+    struct timespec  cpu_time;
+    pid_t            host_tid;
+    uint32          *stack_low;
+    uint32          *stack_high;
+    uint32          *stack_mark;
+    uint32          *p;
+    int32            return_code;
+    sigset_t         previous;
+    sigset_t         mask;
+
+    if (task_id >= OS_MAX_TASKS || OS_task_table[task_id].free == TRUE)
+    {
+       return OS_ERR_INVALID_ID;
+    }
+
+    if (task_stats == NULL)
+    {
+       return OS_INVALID_POINTER;
+    }
+
+    memset(task_stats, 0, sizeof(OS_task_stats_t));
+
+    OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
+
+    host_tid = OS_task_table[task_id].host_tid;
+    if (OS_task_table[task_id].free == TRUE || host_tid == 0)
+    {
+       OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+       return OS_ERR_INVALID_ID;
+    }
+
+    if (pthread_getcpuclockid(OS_task_table[task_id].id, &cpu_clock) != 0 ||
+        clock_gettime(cpu_clock, &cpu_time) != 0)
+    {
+       OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+       return OS_ERROR;
+    }
+    task_stats->cpu_time.seconds   = cpu_time.tv_sec;
+    task_stats->cpu_time.microsecs = cpu_time.tv_nsec / 1000;
+
+    stack_low  = OS_task_table[task_id].stack_low;
+    stack_high = OS_task_table[task_id].stack_high;
+    stack_mark = OS_task_table[task_id].stack_mark;
+
+    OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+
+    /*
+    ** The scan can cover most of the stack, so it is done with the table
+    ** unlocked. The new mark is only kept if the task is still the same one,
+    ** and never moves back up past a deeper mark found by another caller.
+    */
+    if (stack_low != NULL)
+    {
+       p = stack_low;
+       while (p < stack_mark && *p == OS_STACK_WATERMARK)
+       {
+          ++p;
+       }
+
+       OS_InterruptSafeLock(&OS_task_table_mut, &mask, &previous); 
+       if (OS_task_table[task_id].free == FALSE && OS_task_table[task_id].host_tid == host_tid &&
+           p < OS_task_table[task_id].stack_mark)
+       {
+          OS_task_table[task_id].stack_mark = p;
+       }
+       OS_InterruptSafeUnlock(&OS_task_table_mut, &previous); 
+
+       task_stats->stack_size       = (stack_high - stack_low) * sizeof(uint32);
+       task_stats->stack_high_water = (stack_high - p) * sizeof(uint32);
+    }
+
+    return_code = OS_TaskReadSwitchCounts(host_tid, &task_stats->voluntary_switches,
+                                          &task_stats->involuntary_switches);
+
+    return return_code;
+
+} /* end OS_TaskGetStats */
+
 /*--------------------------------------------------------------------------------------
      Name: OS_TaskInstallDeleteHandler
 
@@ -1922,6 +2694,71 @@ int32 OS_QueueDelete (uint32 queue_id)
     
 } /* end OS_QueueDelete */
 
+#ifdef OS_VIRTUAL_TIME
+/*---------------------------------------------------------------------------------------
+   Name: OS_QueueGetVirtual
+
+   Purpose: OS_QueueGet for OS_PEND and timeouts on the virtual clock. The queue is
+            polled under OS_queue_table_mut, and OS_QueuePut signals the queue entry
+            under the same mutex after sending, so no message is missed.
+
+   Returns: as OS_QueueGet
+---------------------------------------------------------------------------------------*/
+static int32 OS_QueueGetVirtual(uint32 queue_id, void *data, uint32 size, uint32 *size_copied, int32 timeout)
+{
+    struct timespec ts;
+    struct timespec immediate;
+    int             sizeCopied;
+    int             error;
+    int             ret = 0;
+
+    if (timeout != OS_PEND)
+    {
+        OS_CompAbsDelayTime(timeout, &ts);
+    }
+
+    /*
+    ** A deadline that has passed makes mq_timedreceive return at once
+    */
+    immediate.tv_sec  = 0;
+    immediate.tv_nsec = 0;
+
+    pthread_mutex_lock(&OS_queue_table_mut);
+    while (1)
+    {
+        do
+        {
+           sizeCopied = mq_timedreceive(OS_queue_table[queue_id].id, data, size, NULL, &immediate);
+        } while ( sizeCopied == -1 && errno == EINTR );
+        error = errno;
+
+        if (sizeCopied != -1 || error != ETIMEDOUT || ret == ETIMEDOUT)
+        {
+            break;
+        }
+
+        ret = OS_VirtualTimeCondTimedWait(&OS_queue_table[queue_id], &OS_queue_table_mut,
+                                          (timeout == OS_PEND) ? NULL : &ts);
+    }
+    pthread_mutex_unlock(&OS_queue_table_mut);
+
+    if (sizeCopied != -1)
+    {
+        *size_copied = sizeCopied;
+        return OS_SUCCESS;
+    }
+
+    *size_copied = 0;
+    if (error == ETIMEDOUT)
+    {
+        return OS_QUEUE_TIMEOUT;
+    }
+
+    return OS_ERROR;
+
+} /* end OS_QueueGetVirtual */
+#endif
+
 /*---------------------------------------------------------------------------------------
  Name: OS_QueueGet
  
@@ -1961,6 +2798,13 @@ int32 OS_QueueGet (uint32 queue_id, void *data, uint32 size, uint32 *size_copied
         return(OS_QUEUE_INVALID_SIZE);
     }
 
+#ifdef OS_VIRTUAL_TIME
+    if (timeout != OS_CHECK)
+    {
+        return OS_QueueGetVirtual(queue_id, data, size, size_copied, timeout);
+    }
+#endif
+
     /*
     ** Read the message queue for data
     */
@@ -2100,6 +2944,12 @@ int32 OS_QueuePut (uint32 queue_id, const void *data, uint32 size, uint32 flags)
     {
         return(OS_ERROR);
     }
+
+#ifdef OS_VIRTUAL_TIME
+    pthread_mutex_lock(&OS_queue_table_mut);
+    OS_VirtualTimeCondSignal(&OS_queue_table[queue_id]);
+    pthread_mutex_unlock(&OS_queue_table_mut);
+#endif
     
     return OS_SUCCESS;
 
@@ -2441,7 +3291,7 @@ int32 OS_BinSemGive ( uint32 sem_id )
     if ( OS_bin_sem_table[sem_id].current_value  < OS_bin_sem_table[sem_id].max_value )
     {
          OS_bin_sem_table[sem_id].current_value ++;
-         pthread_cond_signal(&(OS_bin_sem_table[sem_id].cv));
+         OS_COND_SIGNAL(&(OS_bin_sem_table[sem_id].cv));
     }
     OS_InterruptSafeUnlock(&(OS_bin_sem_table[sem_id].id), &previous);
     return (OS_SUCCESS);
@@ -2484,7 +3334,7 @@ int32 OS_BinSemFlush (uint32 sem_id)
     /* 
     ** Release all threads waiting on the binary semaphore 
     */
-    ret = pthread_cond_broadcast(&(OS_bin_sem_table[sem_id].cv));
+    ret = OS_COND_BROADCAST(&(OS_bin_sem_table[sem_id].cv));
     if ( ret == 0 )
     {
        ret_val = OS_SUCCESS ;
@@ -2546,7 +3396,7 @@ int32 OS_BinSemTake ( uint32 sem_id )
        ** re-aquires the mutex when the function returns. This allows the function that
        ** calls the pthread_cond_signal or pthread_cond_broadcast to aquire the mutex
        */
-       ret = pthread_cond_wait(&(OS_bin_sem_table[sem_id].cv),&(OS_bin_sem_table[sem_id].id));
+       ret = OS_COND_WAIT(&(OS_bin_sem_table[sem_id].cv),&(OS_bin_sem_table[sem_id].id));
        if ( ret == 0 )
        {
           ret_val = OS_SUCCESS;
@@ -2626,7 +3476,7 @@ int32 OS_BinSemTimedWait ( uint32 sem_id, uint32 msecs )
        ** re-aquires the mutex when the function returns. This allows the function that
        ** calls the pthread_cond_signal or pthread_cond_broadcast to aquire the mutex
        */
-       ret = pthread_cond_timedwait(&(OS_bin_sem_table[sem_id].cv), &(OS_bin_sem_table[sem_id].id), &ts);
+       ret = OS_COND_TIMEDWAIT(&(OS_bin_sem_table[sem_id].cv), &(OS_bin_sem_table[sem_id].id), &ts);
        if ( ret == 0 )
        {
           ret_val = OS_SUCCESS;
@@ -2985,7 +3835,7 @@ int32 OS_CountSemGive ( uint32 sem_id )
     if ( OS_count_sem_table[sem_id].current_value  <= 0 )
     {
          OS_count_sem_table[sem_id].current_value ++;
-         pthread_cond_signal(&(OS_count_sem_table[sem_id].cv));
+         OS_COND_SIGNAL(&(OS_count_sem_table[sem_id].cv));
     }
     else if ( OS_count_sem_table[sem_id].current_value  < OS_count_sem_table[sem_id].max_value )
     {
@@ -3043,7 +3893,7 @@ int32 OS_CountSemTake ( uint32 sem_id )
        ** re-aquires the mutex when the function returns. This allows the function that
        ** calls the pthread_cond_signal or pthread_cond_broadcast to aquire the mutex
        */
-       ret = pthread_cond_wait(&(OS_count_sem_table[sem_id].cv),&(OS_count_sem_table[sem_id].id));
+       ret = OS_COND_WAIT(&(OS_count_sem_table[sem_id].cv),&(OS_count_sem_table[sem_id].id));
        if ( ret == 0 )
        {
           ret_val = OS_SUCCESS;
@@ -3122,7 +3972,7 @@ int32 OS_CountSemTimedWait ( uint32 sem_id, uint32 msecs )
        ** re-aquires the mutex when the function returns. This allows the function that
        ** calls the pthread_cond_signal or pthread_cond_broadcast to aquire the mutex
        */
-       ret = pthread_cond_timedwait(&(OS_count_sem_table[sem_id].cv), &(OS_count_sem_table[sem_id].id), &ts);
+       ret = OS_COND_TIMEDWAIT(&(OS_count_sem_table[sem_id].cv), &(OS_count_sem_table[sem_id].id), &ts);
        if ( ret == 0 )
        {
           ret_val = OS_SUCCESS;
@@ -3490,6 +4340,12 @@ int32 OS_MutSemGive ( uint32 sem_id )
     {
         ret_val = OS_SUCCESS ;
     }
+
+#ifdef OS_VIRTUAL_TIME
+    pthread_mutex_lock(&OS_mut_sem_table_mut);
+    OS_VirtualTimeCondSignal(&OS_mut_sem_table[sem_id]);
+    pthread_mutex_unlock(&OS_mut_sem_table_mut);
+#endif
     
     return ret_val;
 } /* end OS_MutSemGive */
@@ -3524,7 +4380,20 @@ int32 OS_MutSemTake ( uint32 sem_id )
     ** Lock the mutex - unlike the sem calls, the pthread mutex call
     ** should not be interrupted by a signal
     */
+#ifdef OS_VIRTUAL_TIME
+    /*
+    ** A task blocked on the host mutex would hold the virtual clock back,
+    ** so wait on the clock until OS_MutSemGive says the mutex is free
+    */
+    pthread_mutex_lock(&OS_mut_sem_table_mut);
+    while ((status = pthread_mutex_trylock(&(OS_mut_sem_table[sem_id].id))) == EBUSY)
+    {
+       OS_VirtualTimeCondTimedWait(&OS_mut_sem_table[sem_id], &OS_mut_sem_table_mut, NULL);
+    }
+    pthread_mutex_unlock(&OS_mut_sem_table_mut);
+#else
     status = pthread_mutex_lock(&(OS_mut_sem_table[sem_id].id));
+#endif
     if( status == EINVAL )
     {
       return OS_SEM_FAILURE ;
@@ -3760,6 +4629,39 @@ int32 OS_IntDisable(int32 Level)
     return(OS_ERR_NOT_IMPLEMENTED);
 }
 
+/*---------------------------------------------------------------------------------------
+   Name: OS_MemLockGetInfo
+
+   Purpose: Reports whether OS_API_Init locked the process memory (OS_LOCK_MEMORY),
+            and how many bytes of the process are locked and resident in RAM.
+            This is meant for sizing the memory lock limit of a deployment.
+
+   Returns: OS_INVALID_POINTER if mem_lock_prop is NULL
+            OS_ERROR if /proc/self/status cannot be read
+            OS_SUCCESS otherwise
+---------------------------------------------------------------------------------------*/
+int32 OS_MemLockGetInfo (OS_mem_lock_prop_t *mem_lock_prop)
+{
+    static const char * const names[2] = { "VmLck", "VmRSS" };
+    uint64   values_kb[2];
+
+    if (mem_lock_prop == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    if (OS_GetProcFields("/proc/self/status", names, values_kb, 2) != OS_SUCCESS)
+    {
+        return OS_ERROR;
+    }
+
+    mem_lock_prop->locked         = OS_memory_locked;
+    mem_lock_prop->locked_bytes   = values_kb[0] * 1024;
+    mem_lock_prop->resident_bytes = values_kb[1] * 1024;
+
+    return OS_SUCCESS;
+}
+
 /*---------------------------------------------------------------------------------------
    Name: OS_HeapGetInfo
 
@@ -3767,24 +4669,463 @@ int32 OS_IntDisable(int32 Level)
 
    Parameters:
 
+   Notes: The numbers come from the C library allocator (mallinfo).  The free bytes
+          and free blocks cover the main arena's free chunks.  The largest free block
+          is the releasable top of the heap, which is the largest block that can be
+          guaranteed without growing the heap; a fragment in the middle of the heap
+          may be larger.  Values above 4GB are clamped.
+
+   Returns: OS_INVALID_POINTER if heap_prop is NULL
+            OS_SUCCESS otherwise
 ---------------------------------------------------------------------------------------*/
+/*
+** __GLIBC_PREREQ only exists on glibc, and an #if using it does not even
+** parse elsewhere, so it needs an #if of its own
+*/
+#if defined(__GLIBC__)
+#if __GLIBC_PREREQ(2,33)
+#define OS_HEAP_MALLINFO2
+#endif
+#endif
+
 int32 OS_HeapGetInfo       (OS_heap_prop_t *heap_prop)
 {
+#ifdef OS_HEAP_MALLINFO2
+    struct mallinfo2 info;
+#else
+    struct mallinfo  info;
+#endif
+
     if (heap_prop == NULL)
     {
         return OS_INVALID_POINTER;
     }
-    /*
-    ** Not implemented yet
-    */
-    return (OS_ERR_NOT_IMPLEMENTED);
+
+#ifdef OS_HEAP_MALLINFO2
+    info = mallinfo2();
+#else
+    info = mallinfo();
+#endif
+
+    heap_prop->free_bytes         = (info.fordblks > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)info.fordblks;
+    heap_prop->free_blocks        = (info.ordblks  > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)info.ordblks;
+    heap_prop->largest_free_block = (info.keepcost > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)info.keepcost;
+
+    return (OS_SUCCESS);
 }
+
+/****************************************************************************************
+                                    MEMORY POOL API
+****************************************************************************************/
+
+/*
+** Marks the end of a pool's free list
+*/
+#define OS_MEM_POOL_END       0xFFFFFFFF
+
+/*
+** Blocks are aligned (and sized) for any basic type; the region itself
+** starts on a cache line
+*/
+#define OS_MEM_POOL_ALIGN     16
+#define OS_MEM_POOL_REGION_ALIGN 64
+
 /*---------------------------------------------------------------------------------------
-** Name: OS_Tick2Micros
-**
-** Purpose:
-** This function returns the duration of a system tick in micro seconds.
-**
+    Name: OS_MemPoolCreate
+
+    Purpose: Creates a pool of num_blocks blocks of block_size bytes each.  All of the
+             memory is allocated here, so OS_MemPoolAlloc and OS_MemPoolFree never call
+             the heap and take constant time.
+
+    Returns: OS_INVALID_POINTER if pool_id or pool_name are NULL
+             OS_ERR_NAME_TOO_LONG if the pool_name is too long to be stored
+             OS_ERROR if block_size or num_blocks is zero, flags is not zero, the pool
+                      would be larger than 4GB, or the memory could not be allocated
+             OS_ERR_NO_FREE_IDS if there are no more free pool Ids
+             OS_ERR_NAME_TAKEN if there is already a pool with the same name
+             OS_SUCCESS if success
+
+    Notes: the flags parameter is reserved for future use and must be 0.  The block
+           size is rounded up to a multiple of 16 bytes.
+---------------------------------------------------------------------------------------*/
+int32 OS_MemPoolCreate (uint32 *pool_id, const char *pool_name, uint32 block_size,
+                        uint32 num_blocks, uint32 flags)
+{
+    uint32    possible_poolid;
+    uint32    i;
+    uint64    region_size;
+    void     *region;
+    uint32   *next_free;
+    uint8    *in_use;
+    sigset_t  previous;
+    sigset_t  mask;
+
+    if (pool_id == NULL || pool_name == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    if (strlen(pool_name) >= OS_MAX_API_NAME)
+    {
+        return OS_ERR_NAME_TOO_LONG;
+    }
+
+    if (block_size == 0 || num_blocks == 0 || num_blocks == OS_MEM_POOL_END ||
+        block_size > (0xFFFFFFFF - OS_MEM_POOL_ALIGN) || flags != 0)
+    {
+        return OS_ERROR;
+    }
+
+    block_size  = (block_size + OS_MEM_POOL_ALIGN - 1) & ~(OS_MEM_POOL_ALIGN - 1);
+    region_size = (uint64)block_size * num_blocks;
+    if (region_size > 0xFFFFFFFF)
+    {
+        return OS_ERROR;
+    }
+
+    /*
+    ** Allocate before taking the table lock; the heap may be slow
+    */
+    region    = NULL;
+    next_free = malloc(num_blocks * sizeof(uint32));
+    in_use    = calloc(num_blocks, sizeof(uint8));
+    if (next_free == NULL || in_use == NULL ||
+        posix_memalign(&region, OS_MEM_POOL_REGION_ALIGN, (size_t)region_size) != 0)
+    {
+        free(next_free);
+        free(in_use);
+        return OS_ERROR;
+    }
+
+    /* Chain every block onto the free list, lowest address first */
+    for (i = 0; i < num_blocks; i++)
+    {
+        next_free[i] = i + 1;
+    }
+    next_free[num_blocks - 1] = OS_MEM_POOL_END;
+
+    OS_InterruptSafeLock(&OS_mem_pool_table_mut, &mask, &previous);
+
+    for (possible_poolid = 0; possible_poolid < OS_MAX_MEM_POOLS; possible_poolid++)
+    {
+        if (OS_mem_pool_table[possible_poolid].free == TRUE)
+            break;
+    }
+
+    if (possible_poolid == OS_MAX_MEM_POOLS)
+    {
+        OS_InterruptSafeUnlock(&OS_mem_pool_table_mut, &previous);
+        free(region);
+        free(next_free);
+        free(in_use);
+        return OS_ERR_NO_FREE_IDS;
+    }
+
+    for (i = 0; i < OS_MAX_MEM_POOLS; i++)
+    {
+        if ((OS_mem_pool_table[i].free == FALSE) &&
+                strcmp ((char*) pool_name, OS_mem_pool_table[i].name) == 0)
+        {
+            OS_InterruptSafeUnlock(&OS_mem_pool_table_mut, &previous);
+            free(region);
+            free(next_free);
+            free(in_use);
+            return OS_ERR_NAME_TAKEN;
+        }
+    }
+
+    OS_mem_pool_table[possible_poolid].region          = region;
+    OS_mem_pool_table[possible_poolid].block_size      = block_size;
+    OS_mem_pool_table[possible_poolid].num_blocks      = num_blocks;
+    OS_mem_pool_table[possible_poolid].next_free       = next_free;
+    OS_mem_pool_table[possible_poolid].in_use          = in_use;
+    OS_mem_pool_table[possible_poolid].free_head       = 0;
+    OS_mem_pool_table[possible_poolid].blocks_free     = num_blocks;
+    OS_mem_pool_table[possible_poolid].blocks_used_max = 0;
+    OS_mem_pool_table[possible_poolid].alloc_count     = 0;
+    OS_mem_pool_table[possible_poolid].alloc_failures  = 0;
+    OS_mem_pool_table[possible_poolid].creator         = OS_FindCreator();
+    strcpy(OS_mem_pool_table[possible_poolid].name, (char*) pool_name);
+    OS_mem_pool_table[possible_poolid].free            = FALSE;
+
+    OS_InterruptSafeUnlock(&OS_mem_pool_table_mut, &previous);
+
+    *pool_id = possible_poolid;
+
+    return OS_SUCCESS;
+
+}/* end OS_MemPoolCreate */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_MemPoolDelete
+
+    Purpose: Deletes the specified pool and frees its memory.  Blocks still allocated
+             from the pool become invalid.
+
+    Returns: OS_ERR_INVALID_ID if the id passed in is not a valid pool
+             OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_MemPoolDelete (uint32 pool_id)
+{
+    void     *region;
+    uint32   *next_free;
+    uint8    *in_use;
+    sigset_t  previous;
+    sigset_t  mask;
+
+    OS_InterruptSafeLock(&OS_mem_pool_table_mut, &mask, &previous);
+
+    if (pool_id >= OS_MAX_MEM_POOLS || OS_mem_pool_table[pool_id].free == TRUE)
+    {
+        OS_InterruptSafeUnlock(&OS_mem_pool_table_mut, &previous);
+        return OS_ERR_INVALID_ID;
+    }
+
+    region    = OS_mem_pool_table[pool_id].region;
+    next_free = OS_mem_pool_table[pool_id].next_free;
+    in_use    = OS_mem_pool_table[pool_id].in_use;
+
+    OS_mem_pool_table[pool_id].free      = TRUE;
+    OS_mem_pool_table[pool_id].creator   = UNINITIALIZED;
+    OS_mem_pool_table[pool_id].region    = NULL;
+    OS_mem_pool_table[pool_id].next_free = NULL;
+    OS_mem_pool_table[pool_id].in_use    = NULL;
+    strcpy(OS_mem_pool_table[pool_id].name, "");
+
+    OS_InterruptSafeUnlock(&OS_mem_pool_table_mut, &previous);
+
+    free(region);
+    free(next_free);
+    free(in_use);
+
+    return OS_SUCCESS;
+
+}/* end OS_MemPoolDelete */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_MemPoolAlloc
+
+    Purpose: Takes one block from the pool and passes back its address.  This does not
+             block or take any lock, so it may be called from any task or from a
+             signal handler.
+
+    Returns: OS_INVALID_POINTER if block is NULL
+             OS_ERR_INVALID_ID if the id passed in is not a valid pool
+             OS_ERR_POOL_EMPTY if every block of the pool is allocated
+             OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_MemPoolAlloc (uint32 pool_id, void **block)
+{
+    OS_mem_pool_internal_record_t *pool;
+    uint64  old_head;
+    uint64  new_head;
+    uint32  index;
+    uint32  used;
+    uint32  used_max;
+
+    if (block == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    if (pool_id >= OS_MAX_MEM_POOLS || OS_mem_pool_table[pool_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    pool = &OS_mem_pool_table[pool_id];
+
+    old_head = __atomic_load_n(&pool->free_head, __ATOMIC_ACQUIRE);
+    do
+    {
+        index = (uint32)old_head;
+        if (index == OS_MEM_POOL_END)
+        {
+            __atomic_add_fetch(&pool->alloc_failures, 1, __ATOMIC_RELAXED);
+            return OS_ERR_POOL_EMPTY;
+        }
+        new_head = (((old_head >> 32) + 1) << 32) |
+                   __atomic_load_n(&pool->next_free[index], __ATOMIC_RELAXED);
+    }
+    while (!__atomic_compare_exchange_n(&pool->free_head, &old_head, new_head, TRUE,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    __atomic_store_n(&pool->in_use[index], 1, __ATOMIC_RELAXED);
+
+    /*
+    ** Statistics
+    */
+    __atomic_add_fetch(&pool->alloc_count, 1, __ATOMIC_RELAXED);
+    used = pool->num_blocks - __atomic_sub_fetch(&pool->blocks_free, 1, __ATOMIC_RELAXED);
+    used_max = __atomic_load_n(&pool->blocks_used_max, __ATOMIC_RELAXED);
+    while (used > used_max &&
+           !__atomic_compare_exchange_n(&pool->blocks_used_max, &used_max, used, TRUE,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+
+    *block = pool->region + ((size_t)index * pool->block_size);
+
+    return OS_SUCCESS;
+
+}/* end OS_MemPoolAlloc */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_MemPoolFree
+
+    Purpose: Returns a block obtained from OS_MemPoolAlloc to its pool.  Like
+             OS_MemPoolAlloc this does not block or take any lock.
+
+    Returns: OS_INVALID_POINTER if block is NULL
+             OS_ERR_INVALID_ID if the id passed in is not a valid pool
+             OS_ERROR_ADDRESS_MISALIGNED if block is inside the pool but is not the
+                      start of a block
+             OS_ERROR if block is not from this pool, or is already free
+             OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_MemPoolFree (uint32 pool_id, void *block)
+{
+    OS_mem_pool_internal_record_t *pool;
+    uint64  old_head;
+    uint64  new_head;
+    uint64  offset;
+    uint32  index;
+
+    if (block == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    if (pool_id >= OS_MAX_MEM_POOLS || OS_mem_pool_table[pool_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    pool = &OS_mem_pool_table[pool_id];
+
+    if ((uint8 *)block < pool->region)
+    {
+        return OS_ERROR;
+    }
+    offset = (uint8 *)block - pool->region;
+    if (offset >= (uint64)pool->block_size * pool->num_blocks)
+    {
+        return OS_ERROR;
+    }
+    if ((offset % pool->block_size) != 0)
+    {
+        return OS_ERROR_ADDRESS_MISALIGNED;
+    }
+    index = (uint32)(offset / pool->block_size);
+
+    /* Only one caller can clear the flag, so a double free is caught here */
+    if (__atomic_exchange_n(&pool->in_use[index], 0, __ATOMIC_RELAXED) == 0)
+    {
+        return OS_ERROR;
+    }
+
+    old_head = __atomic_load_n(&pool->free_head, __ATOMIC_RELAXED);
+    do
+    {
+        __atomic_store_n(&pool->next_free[index], (uint32)old_head, __ATOMIC_RELAXED);
+        new_head = (((old_head >> 32) + 1) << 32) | index;
+    }
+    while (!__atomic_compare_exchange_n(&pool->free_head, &old_head, new_head, TRUE,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    __atomic_add_fetch(&pool->blocks_free, 1, __ATOMIC_RELAXED);
+
+    return OS_SUCCESS;
+
+}/* end OS_MemPoolFree */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_MemPoolGetIdByName
+
+    Purpose: This function tries to find a memory pool Id given the name of the pool
+             The id is returned through pool_id
+
+    Returns: OS_INVALID_POINTER is pool_id or pool_name are NULL pointers
+             OS_ERR_NAME_TOO_LONG if the name given is to long to have been stored
+             OS_ERR_NAME_NOT_FOUND if the name was not found in the table
+             OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_MemPoolGetIdByName (uint32 *pool_id, const char *pool_name)
+{
+    uint32 i;
+
+    if (pool_id == NULL || pool_name == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    if (strlen(pool_name) >= OS_MAX_API_NAME)
+    {
+        return OS_ERR_NAME_TOO_LONG;
+    }
+
+    for (i = 0; i < OS_MAX_MEM_POOLS; i++)
+    {
+        if ((OS_mem_pool_table[i].free != TRUE) &&
+           (strcmp (OS_mem_pool_table[i].name, (char*) pool_name) == 0) )
+        {
+            *pool_id = i;
+            return OS_SUCCESS;
+        }
+    }
+
+    return OS_ERR_NAME_NOT_FOUND;
+
+}/* end OS_MemPoolGetIdByName */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_MemPoolGetInfo
+
+    Purpose: This function will pass back the name, creator, geometry and usage
+             statistics of the specified memory pool.
+
+    Returns: OS_ERR_INVALID_ID if the id passed in is not a valid pool
+             OS_INVALID_POINTER if the pool_prop pointer is null
+             OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_MemPoolGetInfo (uint32 pool_id, OS_mem_pool_prop_t *pool_prop)
+{
+    sigset_t  previous;
+    sigset_t  mask;
+
+    if (pool_id >= OS_MAX_MEM_POOLS || OS_mem_pool_table[pool_id].free == TRUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    if (pool_prop == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    OS_InterruptSafeLock(&OS_mem_pool_table_mut, &mask, &previous);
+
+    strcpy(pool_prop->name, OS_mem_pool_table[pool_id].name);
+    pool_prop->creator         = OS_mem_pool_table[pool_id].creator;
+    pool_prop->block_size      = OS_mem_pool_table[pool_id].block_size;
+    pool_prop->num_blocks      = OS_mem_pool_table[pool_id].num_blocks;
+    pool_prop->blocks_free     = __atomic_load_n(&OS_mem_pool_table[pool_id].blocks_free, __ATOMIC_RELAXED);
+    pool_prop->blocks_used_max = __atomic_load_n(&OS_mem_pool_table[pool_id].blocks_used_max, __ATOMIC_RELAXED);
+    pool_prop->alloc_count     = __atomic_load_n(&OS_mem_pool_table[pool_id].alloc_count, __ATOMIC_RELAXED);
+    pool_prop->alloc_failures  = __atomic_load_n(&OS_mem_pool_table[pool_id].alloc_failures, __ATOMIC_RELAXED);
+
+    OS_InterruptSafeUnlock(&OS_mem_pool_table_mut, &previous);
+
+    return OS_SUCCESS;
+
+}/* end OS_MemPoolGetInfo */
+
+/*---------------------------------------------------------------------------------------
+** Name: OS_Tick2Micros
+**
+** Purpose:
+** This function returns the duration of a system tick in micro seconds.
+**
 ** Assumptions and Notes:
 **
 ** Parameters: None
@@ -3853,7 +5194,18 @@ int32 OS_GetLocalTime(OS_time_t *time_struct)
        return OS_INVALID_POINTER;
     }
 
+#ifdef OS_VIRTUAL_TIME
+    /*
+    ** Local time is the virtual clock plus whatever OS_SetLocalTime set
+    */
+    pthread_mutex_lock(&OS_vtime_mut);
+    time.tv_sec  = (OS_vtime_now + OS_vtime_offset) / 1000000000;
+    time.tv_nsec = (OS_vtime_now + OS_vtime_offset) % 1000000000;
+    pthread_mutex_unlock(&OS_vtime_mut);
+    Status = 0;
+#else
     Status = clock_gettime(CLOCK_REALTIME, &time);
+#endif
 
     if (Status == 0)
     {
@@ -3891,7 +5243,14 @@ int32 OS_SetLocalTime(OS_time_t *time_struct)
     time.tv_sec = time_struct -> seconds;
     time.tv_nsec = (time_struct -> microsecs * 1000);
 
+#ifdef OS_VIRTUAL_TIME
+    pthread_mutex_lock(&OS_vtime_mut);
+    OS_vtime_offset = ((int64)time.tv_sec * 1000000000) + time.tv_nsec - (int64)OS_vtime_now;
+    pthread_mutex_unlock(&OS_vtime_mut);
+    Status = 0;
+#else
     Status = clock_settime(CLOCK_REALTIME, &time);
+#endif
 
     if (Status == 0)
     {
@@ -3906,6 +5265,434 @@ int32 OS_SetLocalTime(OS_time_t *time_struct)
 
 } /*end OS_SetLocalTime */
 
+#ifdef OS_USE_TSC_CLOCK
+/*---------------------------------------------------------------------------------------
+ * Name: OS_TscCalibrate
+ * 
+ * Purpose: Measures the TSC rate against CLOCK_MONOTONIC over about 20 msecs, so
+ *          that OS_GetMonotonicTime can scale the TSC instead of calling the kernel.
+ *          Nothing is enabled unless the CPU reports an invariant TSC.
+ * ------------------------------------------------------------------------------------*/
+
+void OS_TscCalibrate(void)
+{
+    unsigned int    eax, ebx, ecx, edx;
+    struct timespec start;
+    struct timespec end;
+    struct timespec delay;
+    uint64          start_tsc;
+    uint64          end_tsc;
+    uint64          elapsed_nsecs;
+
+    OS_tsc_enabled = FALSE;
+
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0 || (edx & (1 << 8)) == 0)
+    {
+        return;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    start_tsc = __rdtsc();
+
+    delay.tv_sec  = 0;
+    delay.tv_nsec = 20000000;
+    nanosleep(&delay, NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    end_tsc = __rdtsc();
+
+    elapsed_nsecs = ((uint64)(end.tv_sec - start.tv_sec) * 1000000000) + end.tv_nsec - start.tv_nsec;
+    if (end_tsc <= start_tsc || elapsed_nsecs == 0)
+    {
+        return;
+    }
+
+    OS_tsc_mult       = (elapsed_nsecs << 32) / (end_tsc - start_tsc);
+    OS_tsc_base       = end_tsc;
+    OS_tsc_base_nsecs = ((uint64)end.tv_sec * 1000000000) + end.tv_nsec;
+    OS_tsc_enabled    = TRUE;
+
+} /* end OS_TscCalibrate */
+#endif
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_GetMonotonicTime
+ * 
+ * Purpose: Returns the time in nanoseconds since an arbitrary fixed point (normally
+ *          boot), from a clock that is never set or slewed backwards. This is the
+ *          clock to measure intervals with; CLOCK_MONOTONIC is read through the vDSO,
+ *          so no system call is made.
+ *
+ *          With OS_MONOTONIC_TSC on x86-64 the TSC is scaled instead, which is
+ *          cheaper still but drifts from CLOCK_MONOTONIC by the calibration error.
+ *          With OS_VIRTUAL_TIME this is the virtual clock, which starts at zero.
+ *
+ * Returns: OS_INVALID_POINTER if time_nsecs is NULL
+ *          OS_ERROR if the clock could not be read
+ *          OS_SUCCESS if success
+ * ------------------------------------------------------------------------------------*/
+
+int32 OS_GetMonotonicTime(uint64 *time_nsecs)
+{
+    struct timespec time;
+
+    if (time_nsecs == NULL)
+    {
+       return OS_INVALID_POINTER;
+    }
+
+#ifdef OS_VIRTUAL_TIME
+    pthread_mutex_lock(&OS_vtime_mut);
+    *time_nsecs = OS_vtime_now;
+    pthread_mutex_unlock(&OS_vtime_mut);
+    return OS_SUCCESS;
+#endif
+
+#ifdef OS_USE_TSC_CLOCK
+    if (OS_tsc_enabled == TRUE)
+    {
+        *time_nsecs = OS_tsc_base_nsecs +
+                      (uint64)(((unsigned __int128)(__rdtsc() - OS_tsc_base) * OS_tsc_mult) >> 32);
+        return OS_SUCCESS;
+    }
+#endif
+
+    if (clock_gettime(CLOCK_MONOTONIC, &time) != 0)
+    {
+        return OS_ERROR;
+    }
+
+    *time_nsecs = ((uint64)time.tv_sec * 1000000000) + time.tv_nsec;
+
+    return OS_SUCCESS;
+
+} /* end OS_GetMonotonicTime */
+
+#ifdef OS_VIRTUAL_TIME
+/*
+**********************************************************************************
+**          VIRTUAL TIME
+**********************************************************************************
+*/
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_VirtualTimeAdvance
+ * 
+ * Purpose: Once no thread is left running, moves the virtual clock to the earliest
+ *          deadline of the waiting threads and wakes every thread that is due.
+ *          If all of them wait without a deadline the clock stays where it is.
+ *          Called with OS_vtime_mut locked.
+ * ------------------------------------------------------------------------------------*/
+
+static void OS_VirtualTimeAdvance(void)
+{
+    OS_vtime_waiter_t *waiter;
+    uint64             next = OS_VTIME_FOREVER;
+
+    if (OS_vtime_running > 0)
+    {
+        return;
+    }
+
+    for (waiter = OS_vtime_waiters; waiter != NULL; waiter = waiter->next)
+    {
+        if (waiter->woken == FALSE && waiter->deadline < next)
+        {
+            next = waiter->deadline;
+        }
+    }
+
+    if (next == OS_VTIME_FOREVER)
+    {
+        return;
+    }
+
+    if (next > OS_vtime_now)
+    {
+        OS_vtime_now = next;
+    }
+
+    for (waiter = OS_vtime_waiters; waiter != NULL; waiter = waiter->next)
+    {
+        if (waiter->woken == FALSE && waiter->deadline <= OS_vtime_now)
+        {
+            waiter->woken     = TRUE;
+            waiter->timed_out = TRUE;
+            OS_vtime_running += waiter->counted;
+        }
+    }
+
+    pthread_cond_broadcast(&OS_vtime_cv);
+
+} /* end OS_VirtualTimeAdvance */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_VirtualTimeWake
+ * 
+ * Purpose: Wakes the oldest thread waiting on object, or all of them. A woken thread
+ *          counts as running straight away, so the clock cannot move before it has
+ *          had a chance to run. Called with OS_vtime_mut locked.
+ * ------------------------------------------------------------------------------------*/
+
+static void OS_VirtualTimeWake(const void *object, uint32 all)
+{
+    OS_vtime_waiter_t *waiter;
+
+    for (waiter = OS_vtime_waiters; waiter != NULL; waiter = waiter->next)
+    {
+        if (waiter->woken == FALSE && waiter->object == object)
+        {
+            waiter->woken = TRUE;
+            OS_vtime_running += waiter->counted;
+            if (all == FALSE)
+            {
+                break;
+            }
+        }
+    }
+
+    pthread_cond_broadcast(&OS_vtime_cv);
+
+} /* end OS_VirtualTimeWake */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_VirtualTimeUnlink
+ * 
+ * Purpose: Takes a waiter off OS_vtime_waiters. Called with OS_vtime_mut locked.
+ * ------------------------------------------------------------------------------------*/
+
+static void OS_VirtualTimeUnlink(OS_vtime_waiter_t *waiter)
+{
+    OS_vtime_waiter_t **link;
+
+    for (link = &OS_vtime_waiters; *link != NULL; link = &((*link)->next))
+    {
+        if (*link == waiter)
+        {
+            *link = waiter->next;
+            break;
+        }
+    }
+
+} /* end OS_VirtualTimeUnlink */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_VirtualTimeWaitCleanup
+ * 
+ * Purpose: Cancellation handler of OS_VirtualTimeCondTimedWait. The thread is counted
+ *          as running again, so that OS_VirtualTimeThreadEnd can take it off.
+ * ------------------------------------------------------------------------------------*/
+
+static void OS_VirtualTimeWaitCleanup(void *arg)
+{
+    OS_vtime_waiter_t *waiter = (OS_vtime_waiter_t *)arg;
+
+    OS_VirtualTimeUnlink(waiter);
+    if (waiter->woken == FALSE)
+    {
+        OS_vtime_running += waiter->counted;
+    }
+    pthread_mutex_unlock(&OS_vtime_mut);
+
+} /* end OS_VirtualTimeWaitCleanup */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_VirtualTimeCondTimedWait
+ * 
+ * Purpose: Stands in for pthread_cond_timedwait with OS_VIRTUAL_TIME. Unlocks mut
+ *          (if not NULL) and waits until cond is signalled with
+ *          OS_VirtualTimeCondSignal/Broadcast, or until the virtual clock reaches
+ *          abstime (a virtual time, NULL to wait forever). mut is locked again before
+ *          returning. The signalling side must signal with mut locked.
+ *
+ * Returns: 0 if signalled, ETIMEDOUT if the deadline was reached
+ * ------------------------------------------------------------------------------------*/
+
+int OS_VirtualTimeCondTimedWait(const void *cond, pthread_mutex_t *mut, const struct timespec *abstime)
+{
+    OS_vtime_waiter_t   waiter;
+    OS_vtime_waiter_t **link;
+    int                 status;
+
+    waiter.next      = NULL;
+    waiter.object    = cond;
+    waiter.counted   = (OS_vtime_idle == FALSE) ? 1 : 0;
+    waiter.woken     = FALSE;
+    waiter.timed_out = FALSE;
+    if (abstime == NULL)
+    {
+        waiter.deadline = OS_VTIME_FOREVER;
+    }
+    else
+    {
+        waiter.deadline = ((uint64)abstime->tv_sec * 1000000000) + abstime->tv_nsec;
+    }
+
+    pthread_mutex_lock(&OS_vtime_mut);
+
+    if (waiter.deadline <= OS_vtime_now)
+    {
+        pthread_mutex_unlock(&OS_vtime_mut);
+        return ETIMEDOUT;
+    }
+
+    /*
+    ** Waiters are kept in arrival order, so signals wake them first come, first served
+    */
+    for (link = &OS_vtime_waiters; *link != NULL; link = &((*link)->next))
+    {
+    }
+    *link = &waiter;
+
+    if (mut != NULL)
+    {
+        pthread_mutex_unlock(mut);
+    }
+
+    OS_vtime_running -= waiter.counted;
+    OS_VirtualTimeAdvance();
+
+    pthread_cleanup_push(OS_VirtualTimeWaitCleanup, &waiter);
+    while (waiter.woken == FALSE)
+    {
+        pthread_cond_wait(&OS_vtime_cv, &OS_vtime_mut);
+    }
+    pthread_cleanup_pop(0);
+
+    OS_VirtualTimeUnlink(&waiter);
+    status = (waiter.timed_out == TRUE) ? ETIMEDOUT : 0;
+
+    pthread_mutex_unlock(&OS_vtime_mut);
+
+    if (mut != NULL)
+    {
+        pthread_mutex_lock(mut);
+    }
+
+    return status;
+
+} /* end OS_VirtualTimeCondTimedWait */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_VirtualTimeCondSignal
+ * 
+ * Purpose: Stands in for pthread_cond_signal with OS_VIRTUAL_TIME
+ *
+ * Returns: 0
+ * ------------------------------------------------------------------------------------*/
+
+int OS_VirtualTimeCondSignal(const void *cond)
+{
+    pthread_mutex_lock(&OS_vtime_mut);
+    OS_VirtualTimeWake(cond, FALSE);
+    pthread_mutex_unlock(&OS_vtime_mut);
+
+    return 0;
+
+} /* end OS_VirtualTimeCondSignal */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_VirtualTimeCondBroadcast
+ * 
+ * Purpose: Stands in for pthread_cond_broadcast with OS_VIRTUAL_TIME
+ *
+ * Returns: 0
+ * ------------------------------------------------------------------------------------*/
+
+int OS_VirtualTimeCondBroadcast(const void *cond)
+{
+    pthread_mutex_lock(&OS_vtime_mut);
+    OS_VirtualTimeWake(cond, TRUE);
+    pthread_mutex_unlock(&OS_vtime_mut);
+
+    return 0;
+
+} /* end OS_VirtualTimeCondBroadcast */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_VirtualTimeSleepUntil
+ * 
+ * Purpose: Waits until the virtual clock reaches deadline, in nanoseconds
+ *
+ * Returns: OS_SUCCESS
+ * ------------------------------------------------------------------------------------*/
+
+int32 OS_VirtualTimeSleepUntil(uint64 deadline)
+{
+    struct timespec abstime;
+
+    abstime.tv_sec  = deadline / 1000000000;
+    abstime.tv_nsec = deadline % 1000000000;
+
+    OS_VirtualTimeCondTimedWait(NULL, NULL, &abstime);
+
+    return OS_SUCCESS;
+
+} /* end OS_VirtualTimeSleepUntil */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_VirtualTimeThreadStart
+ * 
+ * Purpose: Counts a thread that is about to be created as running, so that the clock
+ *          cannot move on before it starts
+ * ------------------------------------------------------------------------------------*/
+
+void OS_VirtualTimeThreadStart(void)
+{
+    pthread_mutex_lock(&OS_vtime_mut);
+    OS_vtime_running++;
+    pthread_mutex_unlock(&OS_vtime_mut);
+
+} /* end OS_VirtualTimeThreadStart */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_VirtualTimeThreadEnd
+ * 
+ * Purpose: Stops counting the calling thread, when it ends or could not be created.
+ *          Also used as a cancellation handler, so it takes an unused argument.
+ * ------------------------------------------------------------------------------------*/
+
+void OS_VirtualTimeThreadEnd(void *arg)
+{
+    pthread_mutex_lock(&OS_vtime_mut);
+    if (OS_vtime_idle == FALSE)
+    {
+        OS_vtime_running--;
+        OS_VirtualTimeAdvance();
+    }
+    OS_vtime_idle = FALSE;
+    pthread_mutex_unlock(&OS_vtime_mut);
+
+} /* end OS_VirtualTimeThreadEnd */
+
+/*---------------------------------------------------------------------------------------
+ * Name: OS_VirtualTimeSetIdle
+ * 
+ * Purpose: Marks the calling thread idle while it blocks on something outside of the
+ *          OSAL, such as the sync source of a time base, so that the virtual clock can
+ *          move on without it. The thread counts as running again once it is not idle.
+ * ------------------------------------------------------------------------------------*/
+
+void OS_VirtualTimeSetIdle(uint32 idle)
+{
+    pthread_mutex_lock(&OS_vtime_mut);
+    if (idle == TRUE && OS_vtime_idle == FALSE)
+    {
+        OS_vtime_idle = TRUE;
+        OS_vtime_running--;
+        OS_VirtualTimeAdvance();
+    }
+    else if (idle == FALSE && OS_vtime_idle == TRUE)
+    {
+        OS_vtime_idle = FALSE;
+        OS_vtime_running++;
+    }
+    pthread_mutex_unlock(&OS_vtime_mut);
+
+} /* end OS_VirtualTimeSetIdle */
+#endif
+
+
 /*---------------------------------------------------------------------------------------
 ** Name: OS_SetMask
 ** Purpose:
@@ -3997,7 +5784,18 @@ uint32 OS_FindCreator(void)
 ---------------------------------------------------------------------------------------*/
 void  OS_CompAbsDelayTime( uint32 msecs, struct timespec * tm)
 {
+#ifdef OS_VIRTUAL_TIME
+    uint64 now;
+
+    /*
+    ** The virtual waits take their deadlines on the virtual clock
+    */
+    OS_GetMonotonicTime(&now);
+    tm->tv_sec  = now / 1000000000;
+    tm->tv_nsec = now % 1000000000;
+#else
     clock_gettime( CLOCK_REALTIME,  tm ); 
+#endif
 
     /* add the delay to the current time */
     tm->tv_sec  += (time_t) (msecs / 1000) ;
@@ -4121,6 +5919,12 @@ int32 OS_GetErrorName(int32 error_num, os_err_name_t * err_name)
             strcpy(local_name,"OS_ERR_SEM_NOT_FULL"); break;
         case OS_ERR_INVALID_PRIORITY:
             strcpy(local_name,"OS_ERR_INVALID_PRIORITY"); break;
+        case OS_ERR_PERIOD_OVERRUN:
+            strcpy(local_name,"OS_ERR_PERIOD_OVERRUN"); break;
+        case OS_ERR_POOL_EMPTY:
+            strcpy(local_name,"OS_ERR_POOL_EMPTY"); break;
+        case OS_ERR_OUTPUT_TRUNCATED:
+            strcpy(local_name,"OS_ERR_OUTPUT_TRUNCATED"); break;
 
         default: strcpy(local_name,"ERROR_UNKNOWN");
                  return_code = OS_ERROR;
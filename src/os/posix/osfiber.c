@@ -0,0 +1,595 @@
+/*
+** File   : osfiber.c
+**
+**      Copyright (c) 2004-2006, United States government as represented by the
+**      administrator of the National Aeronautics Space Administration.
+**      All rights reserved. This software was created at NASAs Goddard
+**      Space Flight Center pursuant to government contracts.
+**
+**      This is governed by the NASA Open Source Agreement and may be used,
+**      distributed and modified only pursuant to the terms of that agreement.
+**
+** Purpose: This file contains the OSAL Fiber API for POSIX systems.
+**
+**          A fiber is a user-space context with its own (small) stack. The fibers
+**          created by a task all run on that task, one at a time, when it calls
+**          OS_FiberRun. Switching between fibers is a ucontext swap, with no
+**          kernel scheduling involved, so a task can host hundreds of them.
+**
+**          A fiber gives up the CPU only when it calls OS_FiberYield, one of the
+**          OS_Fiber*Wait functions, or returns from its entry point.
+*/
+
+/****************************************************************************************
+                                    INCLUDE FILES
+****************************************************************************************/
+
+#include "common_types.h"
+#include "osapi.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdio.h>
+#include <time.h>
+#include <errno.h>
+#include <signal.h>
+#include <ucontext.h>
+#include <pthread.h>
+
+/****************************************************************************************
+                                EXTERNAL FUNCTION PROTOTYPES
+****************************************************************************************/
+
+extern uint32 OS_FindCreator(void);
+extern int    OS_InterruptSafeLock(pthread_mutex_t *lock, sigset_t *set, sigset_t *previous);
+extern void   OS_InterruptSafeUnlock(pthread_mutex_t *lock, sigset_t *previous);
+#ifdef OS_VIRTUAL_TIME
+extern int32  OS_VirtualTimeSleepUntil(uint64 deadline);
+#endif
+
+/****************************************************************************************
+                                INTERNAL FUNCTION PROTOTYPES
+****************************************************************************************/
+
+int32 OS_FiberAPIInit(void);
+
+/****************************************************************************************
+                                     DEFINES
+****************************************************************************************/
+
+/*
+** Smallest stack given to a fiber. The C library (printf in particular)
+** needs a few kilobytes, and signal handlers also run on the fiber stack.
+*/
+#define OS_FIBER_MIN_STACK_SIZE   8192
+
+/*
+** How long OS_FiberRun sleeps when every fiber is waiting, so that a task
+** full of waiting fibers does not spin on the CPU
+*/
+#define OS_FIBER_IDLE_USECS       1000
+
+#define UNINITIALIZED 0
+
+/****************************************************************************************
+                                    LOCAL TYPEDEFS
+****************************************************************************************/
+
+typedef struct
+{
+   uint32              free;
+   char                name[OS_MAX_API_NAME];
+   uint32              creator;
+   OS_FiberEntry_t     entry_point;
+   void               *arg;
+   void               *stack;
+   uint32              done;      /* entry point has returned */
+   uint32              waiting;   /* last gave up the CPU because it is waiting */
+   int32               next;      /* next fiber run by the same task, -1 at the end */
+   ucontext_t          context;
+
+} OS_fiber_internal_record_t;
+
+/****************************************************************************************
+                                   GLOBAL DATA
+****************************************************************************************/
+
+OS_fiber_internal_record_t OS_fiber_table[OS_MAX_FIBERS];
+
+/*
+** The Mutex for protecting the above table
+*/
+pthread_mutex_t    OS_fiber_table_mut;
+
+/*
+** Per-task scheduler state. Only the owning task touches its fibers once they are
+** created, so the run list and the switches need no locking.
+*/
+static __thread ucontext_t  OS_fiber_scheduler_context;
+static __thread int32       OS_fiber_current = -1;
+static __thread int32       OS_fiber_head    = -1;
+static __thread int32       OS_fiber_tail    = -1;
+
+/****************************************************************************************
+                                INITIALIZATION FUNCTION
+****************************************************************************************/
+int32 OS_FiberAPIInit(void)
+{
+   int    i;
+
+   for ( i = 0; i < OS_MAX_FIBERS; i++ )
+   {
+      OS_fiber_table[i].free        = TRUE;
+      OS_fiber_table[i].creator     = UNINITIALIZED;
+      OS_fiber_table[i].stack       = NULL;
+      OS_fiber_table[i].next        = -1;
+      strcpy(OS_fiber_table[i].name,"");
+   }
+
+   if ( pthread_mutex_init((pthread_mutex_t *) &OS_fiber_table_mut, NULL) != 0 )
+   {
+      return OS_ERROR;
+   }
+
+   return OS_SUCCESS;
+}
+
+/****************************************************************************************
+                                   LOCAL FUNCTIONS
+****************************************************************************************/
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberStart
+
+   Purpose: First function run on a new fiber stack. Calls the user entry point,
+            then marks the fiber done and goes back to the scheduler for good.
+---------------------------------------------------------------------------------------*/
+static void OS_FiberStart(int fiber_id)
+{
+   (*OS_fiber_table[fiber_id].entry_point)(OS_fiber_table[fiber_id].arg);
+
+   OS_fiber_table[fiber_id].done = TRUE;
+   setcontext(&OS_fiber_scheduler_context);
+}
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberBlock
+
+   Purpose: Gives up the CPU because the current fiber is waiting for something.
+            If every fiber is waiting, OS_FiberRun will idle briefly.
+---------------------------------------------------------------------------------------*/
+static void OS_FiberBlock(void)
+{
+   OS_fiber_table[OS_fiber_current].waiting = TRUE;
+   swapcontext(&OS_fiber_table[OS_fiber_current].context, &OS_fiber_scheduler_context);
+}
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberNowMsecs
+
+   Purpose: Returns a monotonic time in milliseconds, for the wait timeouts
+---------------------------------------------------------------------------------------*/
+static uint64 OS_FiberNowMsecs(void)
+{
+   uint64 now = 0;
+
+   OS_GetMonotonicTime(&now);
+
+   return now / 1000000;
+}
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberRelease
+
+   Purpose: Frees the stack and table entry of a fiber that has finished
+---------------------------------------------------------------------------------------*/
+static void OS_FiberRelease(int32 fiber_id)
+{
+   sigset_t  previous;
+   sigset_t  mask;
+
+   free(OS_fiber_table[fiber_id].stack);
+
+   OS_InterruptSafeLock(&OS_fiber_table_mut, &mask, &previous);
+
+   OS_fiber_table[fiber_id].free    = TRUE;
+   OS_fiber_table[fiber_id].creator = UNINITIALIZED;
+   OS_fiber_table[fiber_id].stack   = NULL;
+   OS_fiber_table[fiber_id].next    = -1;
+   strcpy(OS_fiber_table[fiber_id].name, "");
+
+   OS_InterruptSafeUnlock(&OS_fiber_table_mut, &previous);
+}
+
+/****************************************************************************************
+                                   FIBER API
+****************************************************************************************/
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberCreate
+
+   Purpose: Creates a fiber owned by the calling task. The fiber first runs when
+            the task calls OS_FiberRun (or, if the caller is itself a fiber, on the
+            next pass of the running scheduler).
+
+   returns: OS_INVALID_POINTER if any of the necessary pointers are NULL
+            OS_ERR_NAME_TOO_LONG if the name of the fiber is too long to be copied
+            OS_ERR_NAME_TAKEN if the name specified is already used by a fiber
+            OS_ERR_NO_FREE_IDS if there can be no more fibers created
+            OS_ERROR if the stack cannot be allocated or the context set up
+            OS_SUCCESS if success
+
+   NOTES: stack_size is rounded up to OS_FIBER_MIN_STACK_SIZE.
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberCreate (uint32 *fiber_id, const char *fiber_name, OS_FiberEntry_t entry_point,
+                      void *arg, uint32 stack_size)
+{
+   int32     possible_fiberid;
+   int32     i;
+   void     *stack;
+   sigset_t  previous;
+   sigset_t  mask;
+
+   if ( fiber_id == NULL || fiber_name == NULL || entry_point == NULL )
+   {
+      return OS_INVALID_POINTER;
+   }
+
+   if ( strlen(fiber_name) >= OS_MAX_API_NAME )
+   {
+      return OS_ERR_NAME_TOO_LONG;
+   }
+
+   if ( stack_size < OS_FIBER_MIN_STACK_SIZE )
+   {
+      stack_size = OS_FIBER_MIN_STACK_SIZE;
+   }
+
+   OS_InterruptSafeLock(&OS_fiber_table_mut, &mask, &previous);
+
+   possible_fiberid = OS_MAX_FIBERS;
+   for ( i = 0; i < OS_MAX_FIBERS; i++ )
+   {
+      if ( OS_fiber_table[i].free == TRUE )
+      {
+         if ( possible_fiberid == OS_MAX_FIBERS )
+         {
+            possible_fiberid = i;
+         }
+      }
+      else if ( strcmp(fiber_name, OS_fiber_table[i].name) == 0 )
+      {
+         OS_InterruptSafeUnlock(&OS_fiber_table_mut, &previous);
+         return OS_ERR_NAME_TAKEN;
+      }
+   }
+
+   if ( possible_fiberid >= OS_MAX_FIBERS )
+   {
+      OS_InterruptSafeUnlock(&OS_fiber_table_mut, &previous);
+      return OS_ERR_NO_FREE_IDS;
+   }
+
+   OS_fiber_table[possible_fiberid].free = FALSE;
+   strcpy(OS_fiber_table[possible_fiberid].name, fiber_name);
+   OS_fiber_table[possible_fiberid].creator = OS_FindCreator();
+
+   OS_InterruptSafeUnlock(&OS_fiber_table_mut, &previous);
+
+   stack = malloc(stack_size);
+   if ( stack == NULL || getcontext(&OS_fiber_table[possible_fiberid].context) != 0 )
+   {
+      OS_fiber_table[possible_fiberid].stack = stack;
+      OS_FiberRelease(possible_fiberid);
+      return OS_ERROR;
+   }
+
+   OS_fiber_table[possible_fiberid].entry_point = entry_point;
+   OS_fiber_table[possible_fiberid].arg         = arg;
+   OS_fiber_table[possible_fiberid].stack       = stack;
+   OS_fiber_table[possible_fiberid].done        = FALSE;
+   OS_fiber_table[possible_fiberid].waiting     = FALSE;
+   OS_fiber_table[possible_fiberid].next        = -1;
+
+   OS_fiber_table[possible_fiberid].context.uc_stack.ss_sp   = stack;
+   OS_fiber_table[possible_fiberid].context.uc_stack.ss_size = stack_size;
+   OS_fiber_table[possible_fiberid].context.uc_link          = NULL;
+   makecontext(&OS_fiber_table[possible_fiberid].context, (void (*)(void))OS_FiberStart,
+               1, (int)possible_fiberid);
+
+   /*
+   ** Add it to the end of the calling task's run list
+   */
+   if ( OS_fiber_tail < 0 )
+   {
+      OS_fiber_head = possible_fiberid;
+   }
+   else
+   {
+      OS_fiber_table[OS_fiber_tail].next = possible_fiberid;
+   }
+   OS_fiber_tail = possible_fiberid;
+
+   *fiber_id = possible_fiberid;
+
+   return OS_SUCCESS;
+
+}/* end OS_FiberCreate */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberRun
+
+   Purpose: Runs the fibers created by the calling task, round robin, until all of
+            them have returned from their entry points. When every fiber is waiting
+            the task sleeps for OS_FIBER_IDLE_USECS between passes.
+
+   returns: OS_ERROR if called from inside a fiber
+            OS_SUCCESS once all the fibers have finished
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberRun (void)
+{
+   int32            fiber_id;
+   int32            prev;
+   int32            next;
+   uint32           all_waiting;
+#ifdef OS_VIRTUAL_TIME
+   uint64           idle_until;
+#else
+   struct timespec  idle;
+#endif
+
+   if ( OS_fiber_current >= 0 )
+   {
+      return OS_ERROR;
+   }
+
+   while ( OS_fiber_head >= 0 )
+   {
+      all_waiting = TRUE;
+      prev = -1;
+
+      for ( fiber_id = OS_fiber_head; fiber_id >= 0; fiber_id = next )
+      {
+         OS_fiber_table[fiber_id].waiting = FALSE;
+
+         OS_fiber_current = fiber_id;
+         swapcontext(&OS_fiber_scheduler_context, &OS_fiber_table[fiber_id].context);
+         OS_fiber_current = -1;
+
+         next = OS_fiber_table[fiber_id].next;
+
+         if ( OS_fiber_table[fiber_id].done == TRUE )
+         {
+            if ( prev < 0 )
+            {
+               OS_fiber_head = next;
+            }
+            else
+            {
+               OS_fiber_table[prev].next = next;
+            }
+            if ( OS_fiber_tail == fiber_id )
+            {
+               OS_fiber_tail = prev;
+            }
+
+            OS_FiberRelease(fiber_id);
+         }
+         else
+         {
+            if ( OS_fiber_table[fiber_id].waiting == FALSE )
+            {
+               all_waiting = FALSE;
+            }
+            prev = fiber_id;
+         }
+      }
+
+      if ( all_waiting == TRUE && OS_fiber_head >= 0 )
+      {
+#ifdef OS_VIRTUAL_TIME
+         OS_GetMonotonicTime(&idle_until);
+         OS_VirtualTimeSleepUntil(idle_until + (OS_FIBER_IDLE_USECS * 1000));
+#else
+         idle.tv_sec  = 0;
+         idle.tv_nsec = OS_FIBER_IDLE_USECS * 1000;
+         nanosleep(&idle, NULL);
+#endif
+      }
+   }
+
+   return OS_SUCCESS;
+
+}/* end OS_FiberRun */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberYield
+
+   Purpose: Lets the other fibers of the task run before the calling fiber continues
+
+   returns: OS_ERR_INVALID_ID if the caller is not a fiber
+            OS_SUCCESS once the fiber is running again
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberYield (void)
+{
+   if ( OS_fiber_current < 0 )
+   {
+      return OS_ERR_INVALID_ID;
+   }
+
+   swapcontext(&OS_fiber_table[OS_fiber_current].context, &OS_fiber_scheduler_context);
+
+   return OS_SUCCESS;
+
+}/* end OS_FiberYield */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberGetId
+
+   Purpose: Passes back the id of the calling fiber
+
+   returns: OS_INVALID_POINTER if fiber_id is NULL
+            OS_ERR_INVALID_ID if the caller is not a fiber
+            OS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberGetId (uint32 *fiber_id)
+{
+   if ( fiber_id == NULL )
+   {
+      return OS_INVALID_POINTER;
+   }
+
+   if ( OS_fiber_current < 0 )
+   {
+      return OS_ERR_INVALID_ID;
+   }
+
+   *fiber_id = OS_fiber_current;
+
+   return OS_SUCCESS;
+
+}/* end OS_FiberGetId */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberQueueGet
+
+   Purpose: OS_QueueGet for fibers. Instead of blocking the whole task, the calling
+            fiber lets the other fibers run until a message arrives or the timeout
+            (OS_PEND, OS_CHECK or milliseconds) passes.
+            When not called from a fiber this is the same as OS_QueueGet.
+
+   returns: the OS_QueueGet return codes
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberQueueGet (uint32 queue_id, void *data, uint32 size, uint32 *size_copied,
+                        int32 timeout)
+{
+   int32   status;
+   uint64  deadline = 0;
+
+   if ( OS_fiber_current < 0 )
+   {
+      return OS_QueueGet(queue_id, data, size, size_copied, timeout);
+   }
+
+   if ( timeout > 0 )
+   {
+      deadline = OS_FiberNowMsecs() + timeout;
+   }
+
+   while (1)
+   {
+      status = OS_QueueGet(queue_id, data, size, size_copied, OS_CHECK);
+      if ( status != OS_QUEUE_EMPTY || timeout == OS_CHECK )
+      {
+         return status;
+      }
+
+      if ( timeout > 0 && OS_FiberNowMsecs() >= deadline )
+      {
+         return OS_QUEUE_TIMEOUT;
+      }
+
+      OS_FiberBlock();
+   }
+
+}/* end OS_FiberQueueGet */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberBinSemWait
+
+   Purpose: Takes a binary semaphore from a fiber. Instead of blocking the whole task,
+            the calling fiber lets the other fibers run until the semaphore is given
+            or the timeout (OS_PEND, OS_CHECK or milliseconds) passes.
+            When not called from a fiber this blocks like OS_BinSemTake /
+            OS_BinSemTimedWait.
+
+   returns: OS_SEM_TIMEOUT if the semaphore was not given in time
+            otherwise the OS_BinSemTimedWait return codes
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberBinSemWait (uint32 sem_id, int32 timeout)
+{
+   int32   status;
+   uint64  deadline = 0;
+
+   if ( OS_fiber_current < 0 )
+   {
+      if ( timeout < 0 )
+      {
+         return OS_BinSemTake(sem_id);
+      }
+      return OS_BinSemTimedWait(sem_id, timeout);
+   }
+
+   if ( timeout > 0 )
+   {
+      deadline = OS_FiberNowMsecs() + timeout;
+   }
+
+   while (1)
+   {
+      status = OS_BinSemTimedWait(sem_id, 0);
+      if ( status != OS_SEM_TIMEOUT || timeout == OS_CHECK )
+      {
+         return status;
+      }
+
+      if ( timeout > 0 && OS_FiberNowMsecs() >= deadline )
+      {
+         return OS_SEM_TIMEOUT;
+      }
+
+      OS_FiberBlock();
+   }
+
+}/* end OS_FiberBinSemWait */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_FiberCountSemWait
+
+   Purpose: Takes a counting semaphore from a fiber. Instead of blocking the whole
+            task, the calling fiber lets the other fibers run until the semaphore is
+            given or the timeout (OS_PEND, OS_CHECK or milliseconds) passes.
+            When not called from a fiber this blocks like OS_CountSemTake /
+            OS_CountSemTimedWait.
+
+   returns: OS_SEM_TIMEOUT if the semaphore was not given in time
+            otherwise the OS_CountSemTimedWait return codes
+---------------------------------------------------------------------------------------*/
+int32 OS_FiberCountSemWait (uint32 sem_id, int32 timeout)
+{
+   int32   status;
+   uint64  deadline = 0;
+
+   if ( OS_fiber_current < 0 )
+   {
+      if ( timeout < 0 )
+      {
+         return OS_CountSemTake(sem_id);
+      }
+      return OS_CountSemTimedWait(sem_id, timeout);
+   }
+
+   if ( timeout > 0 )
+   {
+      deadline = OS_FiberNowMsecs() + timeout;
+   }
+
+   while (1)
+   {
+      status = OS_CountSemTimedWait(sem_id, 0);
+      if ( status != OS_SEM_TIMEOUT || timeout == OS_CHECK )
+      {
+         return status;
+      }
+
+      if ( timeout > 0 && OS_FiberNowMsecs() >= deadline )
+      {
+         return OS_SEM_TIMEOUT;
+      }
+
+      OS_FiberBlock();
+   }
+
+}/* end OS_FiberCountSemWait */
@@ -75,6 +75,13 @@
                                     INCLUDE FILES
 ****************************************************************************************/
 
+/*
+** _GNU_SOURCE is needed for copy_file_range(), which OS_cp uses to copy
+** file data inside the kernel
+*/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
 
 #include "stdio.h"
 #include "stdlib.h"
@@ -88,7 +95,29 @@
 
 #include "dirent.h"
 #include "sys/stat.h"
+#include "sys/sendfile.h"
+#include "sys/uio.h"
+#include "sys/wait.h"
 #include "signal.h"
+#include "spawn.h"
+#include "poll.h"
+#include "time.h"
+
+#include "sys/syscall.h"
+#include "sys/mman.h"
+#include "sys/eventfd.h"
+
+/*
+** Asynchronous I/O uses io_uring when the kernel headers have its plain
+** read/write opcodes (Linux 5.6); the running kernel is checked when each
+** queue is created
+*/
+#ifdef __NR_io_uring_setup
+#include "linux/io_uring.h"
+#ifdef IORING_FEAT_RW_CUR_POS
+#define OS_ASYNC_IO_URING
+#endif
+#endif
 
 #include "common_types.h"
 #include "osapi.h"
@@ -100,6 +129,128 @@
 #define ERROR -1
 #define OS_REDIRECTSTRSIZE 15
 
+/*
+** Number of bytes OS_cp moves per kernel call, which is also how often
+** the progress callback of OS_cpProgress is called
+*/
+#define OS_CP_CHUNK_SIZE   (1024 * 1024)
+
+/*
+** Size of the stack buffer used when data has to be copied between
+** descriptors by hand
+*/
+#define OS_COPY_BUFFER_SIZE 4096
+
+/*
+** Largest count passed to a single read or write call by OS_read64 and
+** OS_write64; Linux transfers a little under 2 GB per call at most
+*/
+#define OS_IO64_CHUNK_SIZE  0x40000000
+
+/*
+** Size of the stack buffer OS_ReadDirBatch reads raw directory entries into
+*/
+#define OS_READDIR_BUFFER_SIZE  4096
+
+/*
+** Asynchronous I/O request types
+*/
+#define OS_ASYNC_OP_READ    1
+#define OS_ASYNC_OP_WRITE   2
+#define OS_ASYNC_OP_FSYNC   3
+
+/****************************************************************************************
+                                    TYPEDEFS
+****************************************************************************************/
+
+typedef struct
+{
+    uint32    opcode;
+    int       fd;
+    void     *buffer;
+    uint32    nbytes;
+    int64     offset;
+    void     *user_data;
+} OS_async_request_t;
+
+typedef struct
+{
+    int                    free;
+    char                   name[OS_MAX_API_NAME];
+    uint32                 creator;
+    uint32                 outstanding;      /* submitted, not yet returned by OS_AsyncWait */
+    uint32                 shutdown;         /* tells the workers to exit */
+    uint32                 deleting;         /* OS_AsyncQueueDelete is running */
+    uint32                 waiters;          /* tasks inside OS_AsyncWait */
+
+    /*
+    ** Worker pool: requests not started yet, finished requests, and the
+    ** threads; all protected by lock
+    */
+    OS_async_request_t     pending[OS_ASYNC_QUEUE_DEPTH];
+    uint32                 pending_head;
+    uint32                 pending_count;
+    OS_async_completion_t  done[OS_ASYNC_QUEUE_DEPTH];
+    uint32                 done_head;
+    uint32                 done_count;
+    uint32                 num_workers;
+    pthread_t              workers[OS_ASYNC_WORKERS];
+
+    pthread_mutex_t        lock;
+    pthread_cond_t         work_cv;
+    pthread_cond_t         done_cv;
+
+#ifdef OS_ASYNC_IO_URING
+    /*
+    ** io_uring instance and its shared rings; ring_fd is -1 when the
+    ** queue uses the worker pool
+    */
+    int                    ring_fd;
+    int                    wake_fd;          /* eventfd polled with ring_fd, to wake waiters on delete */
+    void                  *sq_map;
+    size_t                 sq_map_size;
+    void                  *cq_map;
+    size_t                 cq_map_size;
+    struct io_uring_sqe   *sqes;
+    size_t                 sqes_size;
+    unsigned              *sq_head;
+    unsigned              *sq_tail;
+    unsigned              *sq_mask;
+    unsigned              *sq_array;
+    unsigned              *cq_head;
+    unsigned              *cq_tail;
+    unsigned              *cq_mask;
+    struct io_uring_cqe   *cqes;
+#endif
+} OS_async_queue_record_t;
+
+typedef struct
+{
+    int                    free;
+    int32                  filedes;
+    uint32                 flags;
+    char                  *buffer;
+    uint32                 buffer_size;
+    uint32                 used;             /* bytes waiting in buffer */
+    uint32                 flush_msecs;
+    struct timespec        flush_deadline;   /* CLOCK_MONOTONIC, valid while used > 0 */
+    pthread_mutex_t        lock;
+} OS_stream_record_t;
+
+typedef struct
+{
+    int                    free;
+    uint32                 flags;
+    uint32                 flush_msecs;
+    uint32                 max_pending;
+    uint32                 num_pending;
+    int32                  pending[OS_MAX_NUM_OPEN_FILES];    /* files waiting for a sync */
+    uint8                  is_pending[OS_MAX_NUM_OPEN_FILES]; /* by file descriptor */
+    struct timespec        flush_deadline;   /* CLOCK_MONOTONIC, valid while num_pending > 0 */
+    pthread_mutex_t        lock;             /* protects the fields above */
+    pthread_mutex_t        commit_lock;      /* held for a whole commit */
+} OS_sync_group_record_t;
+
 
 /***************************************************************************************
                                  FUNCTION PROTOTYPES
@@ -109,6 +260,7 @@ int32         OS_check_name_length(const char *path);
 extern uint32 OS_FindCreator(void);
 extern int    OS_InterruptSafeLock(pthread_mutex_t *lock, sigset_t *set, sigset_t *previous);
 extern void   OS_InterruptSafeUnlock(pthread_mutex_t *lock, sigset_t *previous);
+extern char **environ;
 
 /****************************************************************************************
                                    GLOBAL DATA
@@ -116,6 +268,43 @@ extern void   OS_InterruptSafeUnlock(pthread_mutex_t *lock, sigset_t *previous);
 
 OS_FDTableEntry OS_FDTable[OS_MAX_NUM_OPEN_FILES];
 pthread_mutex_t OS_FDTableMutex;
+
+/*
+** Open-file path index: the valid OS_FDTable slots chained by the hash of
+** their Path, so that looking up a path does not compare it against every
+** slot. Several slots may have the same path. Protected by OS_FDTableMutex.
+*/
+#define OS_FD_PATH_NOT_INDEXED  (-2)
+
+static int32  OS_FDPathBucket[OS_MAX_NUM_OPEN_FILES];
+static int32  OS_FDPathNext[OS_MAX_NUM_OPEN_FILES];
+static uint32 OS_FDPathHash[OS_MAX_NUM_OPEN_FILES];
+
+OS_async_queue_record_t OS_async_queue_table[OS_MAX_ASYNC_QUEUES];
+pthread_mutex_t         OS_async_queue_table_mut;
+
+OS_stream_record_t      OS_stream_table[OS_MAX_STREAMS];
+pthread_mutex_t         OS_stream_table_mut;
+
+/*
+** The stream flusher thread sleeps on OS_stream_flush_cv until the next
+** flush deadline of any stream
+*/
+pthread_mutex_t         OS_stream_flush_mut;
+pthread_cond_t          OS_stream_flush_cv;
+int                     OS_stream_flusher_started;
+
+OS_sync_group_record_t  OS_sync_group_table[OS_MAX_SYNC_GROUPS];
+pthread_mutex_t         OS_sync_group_table_mut;
+
+/*
+** The sync group flusher thread sleeps on OS_sync_group_flush_cv until the
+** next flush deadline of any group
+*/
+pthread_mutex_t         OS_sync_group_flush_mut;
+pthread_cond_t          OS_sync_group_flush_cv;
+int                     OS_sync_group_flusher_started;
+
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
 ****************************************************************************************/
@@ -123,6 +312,7 @@ int32 OS_FS_Init(void)
 {
     int i;
     int ret;	
+    pthread_condattr_t cond_attr;
 
     /* Initialize the file system constructs */
     for (i =0; i < OS_MAX_NUM_OPEN_FILES; i++)
@@ -131,6 +321,9 @@ int32 OS_FS_Init(void)
         strcpy(OS_FDTable[i].Path, "\0");
         OS_FDTable[i].User =       0;
         OS_FDTable[i].IsValid =    FALSE;
+
+        OS_FDPathBucket[i] = -1;
+        OS_FDPathNext[i]   = OS_FD_PATH_NOT_INDEXED;
     }
     
     ret = pthread_mutex_init((pthread_mutex_t *) & OS_FDTableMutex,NULL); 
@@ -139,6 +332,97 @@ int32 OS_FS_Init(void)
     {
         return(OS_ERROR);
     }
+
+    /*
+    ** Asynchronous I/O queues wait against CLOCK_MONOTONIC
+    */
+    ret = pthread_mutex_init(&OS_async_queue_table_mut, NULL);
+    if (ret == 0)
+    {
+        ret = pthread_condattr_init(&cond_attr);
+    }
+    if (ret == 0)
+    {
+        ret = pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    }
+
+    for (i = 0; ret == 0 && i < OS_MAX_ASYNC_QUEUES; i++)
+    {
+        memset(&OS_async_queue_table[i], 0, sizeof(OS_async_queue_table[i]));
+        OS_async_queue_table[i].free    = TRUE;
+        OS_async_queue_table[i].creator = 0;
+#ifdef OS_ASYNC_IO_URING
+        OS_async_queue_table[i].ring_fd = -1;
+        OS_async_queue_table[i].wake_fd = -1;
+#endif
+        ret = pthread_mutex_init(&OS_async_queue_table[i].lock, NULL);
+        if (ret == 0)
+        {
+            ret = pthread_cond_init(&OS_async_queue_table[i].work_cv, &cond_attr);
+        }
+        if (ret == 0)
+        {
+            ret = pthread_cond_init(&OS_async_queue_table[i].done_cv, &cond_attr);
+        }
+    }
+
+    /*
+    ** Buffered streams
+    */
+    if (ret == 0)
+    {
+        ret = pthread_mutex_init(&OS_stream_table_mut, NULL);
+    }
+    if (ret == 0)
+    {
+        ret = pthread_mutex_init(&OS_stream_flush_mut, NULL);
+    }
+    if (ret == 0)
+    {
+        ret = pthread_cond_init(&OS_stream_flush_cv, &cond_attr);
+    }
+    OS_stream_flusher_started = FALSE;
+
+    for (i = 0; ret == 0 && i < OS_MAX_STREAMS; i++)
+    {
+        memset(&OS_stream_table[i], 0, sizeof(OS_stream_table[i]));
+        OS_stream_table[i].free    = TRUE;
+        OS_stream_table[i].filedes = -1;
+        ret = pthread_mutex_init(&OS_stream_table[i].lock, NULL);
+    }
+
+    /*
+    ** Sync groups
+    */
+    if (ret == 0)
+    {
+        ret = pthread_mutex_init(&OS_sync_group_table_mut, NULL);
+    }
+    if (ret == 0)
+    {
+        ret = pthread_mutex_init(&OS_sync_group_flush_mut, NULL);
+    }
+    if (ret == 0)
+    {
+        ret = pthread_cond_init(&OS_sync_group_flush_cv, &cond_attr);
+    }
+    OS_sync_group_flusher_started = FALSE;
+
+    for (i = 0; ret == 0 && i < OS_MAX_SYNC_GROUPS; i++)
+    {
+        memset(&OS_sync_group_table[i], 0, sizeof(OS_sync_group_table[i]));
+        OS_sync_group_table[i].free = TRUE;
+        ret = pthread_mutex_init(&OS_sync_group_table[i].lock, NULL);
+        if (ret == 0)
+        {
+            ret = pthread_mutex_init(&OS_sync_group_table[i].commit_lock, NULL);
+        }
+    }
+
+    if ( ret != 0 )
+    {
+        return(OS_ERROR);
+    }
     else
     {
         return(OS_SUCCESS);
@@ -153,6 +437,118 @@ int32 OS_FS_Init(void)
 ** Standard File system API
 */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDPathHashOf
+
+    Purpose: Hashes a path for the open-file path index (FNV-1a)
+---------------------------------------------------------------------------------------*/
+static uint32 OS_FDPathHashOf(const char *path)
+{
+    uint32 hash = 2166136261U;
+
+    while (*path != '\0')
+    {
+        hash ^= (uint8)*path++;
+        hash *= 16777619U;
+    }
+
+    return hash;
+
+}/* end OS_FDPathHashOf */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDPathInsert
+
+    Purpose: Adds a slot to the open-file path index under its current Path.
+             The caller holds OS_FDTableMutex.
+---------------------------------------------------------------------------------------*/
+static void OS_FDPathInsert(int32 filedes)
+{
+    uint32 bucket;
+
+    OS_FDPathHash[filedes]   = OS_FDPathHashOf(OS_FDTable[filedes].Path);
+    bucket                   = OS_FDPathHash[filedes] % OS_MAX_NUM_OPEN_FILES;
+    OS_FDPathNext[filedes]   = OS_FDPathBucket[bucket];
+    OS_FDPathBucket[bucket]  = filedes;
+
+}/* end OS_FDPathInsert */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDPathRemove
+
+    Purpose: Takes a slot out of the open-file path index, if it is in it.
+             The caller holds OS_FDTableMutex.
+---------------------------------------------------------------------------------------*/
+static void OS_FDPathRemove(int32 filedes)
+{
+    int32 *link;
+
+    if (OS_FDPathNext[filedes] == OS_FD_PATH_NOT_INDEXED)
+    {
+        return;
+    }
+
+    link = &OS_FDPathBucket[OS_FDPathHash[filedes] % OS_MAX_NUM_OPEN_FILES];
+    while (*link != filedes)
+    {
+        link = &OS_FDPathNext[*link];
+    }
+
+    *link = OS_FDPathNext[filedes];
+    OS_FDPathNext[filedes] = OS_FD_PATH_NOT_INDEXED;
+
+}/* end OS_FDPathRemove */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDPathFind
+
+    Purpose: Looks up a slot that was opened with the given path.
+             The caller holds OS_FDTableMutex.
+
+    Returns: the file descriptor, or -1 if the path is not open
+---------------------------------------------------------------------------------------*/
+static int32 OS_FDPathFind(const char *path)
+{
+    uint32 hash;
+    int32  filedes;
+
+    hash = OS_FDPathHashOf(path);
+
+    for (filedes = OS_FDPathBucket[hash % OS_MAX_NUM_OPEN_FILES];
+         filedes >= 0;
+         filedes = OS_FDPathNext[filedes])
+    {
+        if (OS_FDPathHash[filedes] == hash && strcmp(OS_FDTable[filedes].Path, path) == 0)
+        {
+            break;
+        }
+    }
+
+    return filedes;
+
+}/* end OS_FDPathFind */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_FDPathIsOpen
+
+    Purpose: Checks whether the OSAL has a file open under the given path
+
+    Returns: TRUE if the path is open, FALSE if not
+---------------------------------------------------------------------------------------*/
+static int OS_FDPathIsOpen(const char *path)
+{
+    int32     filedes;
+    sigset_t  previous;
+    sigset_t  mask;
+
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+    filedes = OS_FDPathFind(path);
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+    return (filedes >= 0);
+
+}/* end OS_FDPathIsOpen */
+
 /*--------------------------------------------------------------------------------------
     Name: OS_creat
     
@@ -263,6 +659,7 @@ int32 OS_creat  (const char *path, int32  access)
         OS_FDTable[PossibleFD].OSfd =       status;
         strncpy(OS_FDTable[PossibleFD].Path, path, OS_MAX_PATH_LEN);
         OS_FDTable[PossibleFD].User =       OS_FindCreator();
+        OS_FDPathInsert(PossibleFD);
         OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
         return PossibleFD;
     }
@@ -384,6 +781,7 @@ int32 OS_open   (const char *path,  int32 access,  uint32  mode)
         OS_FDTable[PossibleFD].OSfd =       status;
         strncpy(OS_FDTable[PossibleFD].Path, path, OS_MAX_PATH_LEN);
         OS_FDTable[PossibleFD].User =       OS_FindCreator();
+        OS_FDPathInsert(PossibleFD);
         OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
         
         return PossibleFD;
@@ -398,6 +796,34 @@ int32 OS_open   (const char *path,  int32 access,  uint32  mode)
  
 } /* end OS_open */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_openPrealloc
+
+    Purpose: opens a file like OS_open, then allocates blocks for the first
+             size_hint bytes of it without changing its size. A file that is
+             appended to up to about that size then never waits for the file
+             system to allocate blocks, and its blocks tend to be contiguous.
+             The size is only a hint: the file is opened even if the blocks
+             cannot be allocated.
+
+    Returns: as for OS_open
+---------------------------------------------------------------------------------------*/
+
+int32 OS_openPrealloc (const char *path, int32 access, uint32 mode, int64 size_hint)
+{
+    int32 filedes;
+
+    filedes = OS_open(path, access, mode);
+
+    if (filedes >= 0 && access != OS_READ_ONLY && size_hint > 0)
+    {
+        fallocate64(OS_FDTable[filedes].OSfd, FALLOC_FL_KEEP_SIZE, 0, (off64_t)size_hint);
+    }
+
+    return filedes;
+
+} /* end OS_openPrealloc */
+
 
 /*--------------------------------------------------------------------------------------
     Name: OS_close
@@ -439,6 +865,7 @@ int32 OS_close (int32  filedes)
             */
             /* fill in the table before returning */
             OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+            OS_FDPathRemove(filedes);
             OS_FDTable[filedes].OSfd =       -1;
             strcpy(OS_FDTable[filedes].Path, "\0");
             OS_FDTable[filedes].User =       0;
@@ -451,6 +878,7 @@ int32 OS_close (int32  filedes)
         {
             /* fill in the table before returning */
             OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+            OS_FDPathRemove(filedes);
             OS_FDTable[filedes].OSfd =       -1;
             strcpy(OS_FDTable[filedes].Path, "\0");
             OS_FDTable[filedes].User =       0;
@@ -534,81 +962,60 @@ int32 OS_write (int32  filedes, void *buffer, uint32 nbytes)
     
 }/* end OS_write */
 
-
 /*--------------------------------------------------------------------------------------
-    Name: OS_chmod
-
-    Notes: This is not going to be implemented because there is no use for this function.
----------------------------------------------------------------------------------------*/
-
-int32 OS_chmod  (const char *path, uint32 access)
-{    
-    return OS_FS_UNIMPLEMENTED;
-} /* end OS_chmod */
+    Name: OS_readv
 
-/*--------------------------------------------------------------------------------------
-    Name: OS_stat
-    
-    Purpose: returns information about a file or directory in a os_fs_stat structure
-    
-    Returns: OS_FS_ERR_INVALID_POINTER if path or filestats is NULL
-             OS_FS_ERR_PATH_TOO_LONG if the path is too long to be stored locally
-*****        OS_FS_ERR_NAME_TOO_LONG if the name of the file is too long to be stored
-             OS_FS_ERR_PATH_INVALID if path cannot be parsed
-             OS_FS_ERROR id the OS call failed
-             OS_FS_SUCCESS if success
+    Purpose: reads from the file described in filedes into the iovcnt buffers
+             described by iov, filling each one before moving on to the next
 
-    Note: The information returned is in the structure pointed to by filestats         
+    Returns: OS_FS_ERR_INVALID_POINTER if iov is NULL
+             OS_FS_ERROR if OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes read if success
 ---------------------------------------------------------------------------------------*/
 
-int32 OS_stat   (const char *path, os_fstat_t  *filestats)
+int32 OS_readv (int32  filedes, const os_iovec_t *iov, int32 iovcnt)
 {
-    int ret_val;
-    char local_path[OS_MAX_LOCAL_PATH_LEN];
-  
-    /*
-    ** Check to see if the file pointers are NULL
-    */
-    if (path == NULL || filestats == NULL)
+    int32 status;
+
+    if (iov == NULL)
         return OS_FS_ERR_INVALID_POINTER;
-        
-    /*
-    ** Check to see if the path is too long
-    */
-    if (strlen(path) >= OS_MAX_PATH_LEN)
-        return OS_FS_ERR_PATH_TOO_LONG;
 
-    /*
-    ** Translate the path
-    */
-    if ( OS_TranslatePath(path, (char *)local_path) != OS_FS_SUCCESS )
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
     {
-        return OS_FS_ERR_PATH_INVALID;
+        return OS_FS_ERR_INVALID_FD;
     }
-
-    ret_val = stat( (char*) local_path, filestats);
-    if (ret_val == ERROR)
-        return OS_FS_ERROR;
     else
-        return OS_FS_SUCCESS;
-    
-} /* end OS_stat */
+    {
+        status = readv(OS_FDTable[filedes].OSfd, iov, iovcnt);
+
+        if (status == ERROR)
+            return OS_FS_ERROR;
+    }
+
+    return status;
+
+}/* end OS_readv */
 
 /*--------------------------------------------------------------------------------------
-    Name: OS_lseek
+    Name: OS_writev
 
-    Purpose: sets the read/write pointer to a specific offset in a specific file. 
-             Whence is either OS_SEEK_SET,OS_SEEK_CUR, or OS_SEEK_END
+    Purpose: writes the iovcnt buffers described by iov to the file described in
+             filedes, in order, as a single write
 
-    Returns: the new offset from the beginning of the file
-             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+    Returns: OS_FS_ERR_INVALID_POINTER if iov is NULL
              OS_FS_ERROR if OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes written if success
 ---------------------------------------------------------------------------------------*/
 
-int32 OS_lseek  (int32  filedes, int32 offset, uint32 whence)
+int32 OS_writev (int32  filedes, const os_iovec_t *iov, int32 iovcnt)
 {
-     off_t status;
-     int where;
+    int32 status;
+
+    if (iov == NULL)
+        return OS_FS_ERR_INVALID_POINTER;
 
     /* Make sure the file descriptor is legit before using it */
     if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
@@ -617,88 +1024,246 @@ int32 OS_lseek  (int32  filedes, int32 offset, uint32 whence)
     }
     else
     {
-        switch(whence)
-        {
-            case OS_SEEK_SET:
-                where = SEEK_SET;
-                break;
-            case OS_SEEK_CUR:
-                where = SEEK_CUR;
-                break;
-            case OS_SEEK_END:
-                where = SEEK_END;
-                break;
-            default:
-                return OS_FS_ERROR;
-        }
+        status = writev(OS_FDTable[filedes].OSfd, iov, iovcnt);
 
-    
-        status = lseek( OS_FDTable[filedes].OSfd, (off_t) offset, (int) where );
-
-        if ( (int) status != ERROR)
-            return (int32) status;
+        if (status != ERROR)
+            return  status;
         else
             return OS_FS_ERROR;
     }
- 
-}/* end OS_lseek */
+
+}/* end OS_writev */
 
 /*--------------------------------------------------------------------------------------
-    Name: OS_remove
+    Name: OS_pread
 
-    Purpose: removes a given filename from the drive
- 
-    Returns: OS_FS_SUCCESS if the driver returns OK
-             OS_FS_ERROR if there is no device or the driver returns error
-             OS_FS_ERR_INVALID_POINTER if path is NULL
-             OS_FS_ERR_PATH_TOO_LONG if path is too long to be stored locally
-             OS_FS_ERR_PATH_INVALID if path cannot be parsed
-             OS_FS_ERR_NAME_TOO_LONG if the name of the file to remove is too long to be
-             stored locally
+    Purpose: reads up to nbytes from the file described in filedes, starting at
+             offset, and puts them into buffer. The file pointer is not used or
+             moved, so tasks sharing a file descriptor need no locking around it.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if buffer is NULL
+             OS_FS_ERROR if OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes read if success
 ---------------------------------------------------------------------------------------*/
 
-int32 OS_remove (const char *path)
+int32 OS_pread (int32  filedes, void *buffer, uint32 nbytes, int64 offset)
 {
-    int  i;
-    int  status;
-    char local_path[OS_MAX_LOCAL_PATH_LEN];
+    int32 status;
 
-    /*
-    ** Check to see if the path pointer is NULL
-    */
-    if (path == NULL)
+    if (buffer == NULL)
+        return OS_FS_ERR_INVALID_POINTER;
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+    else
     {
+        status = pread64(OS_FDTable[filedes].OSfd, buffer, nbytes, (off64_t)offset);
+
+        if (status == ERROR)
+            return OS_FS_ERROR;
+    }
+
+    return status;
+
+}/* end OS_pread */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_pwrite
+
+    Purpose: writes up to nbytes of buffer to the file described in filedes, starting
+             at offset. The file pointer is not used or moved.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if buffer is NULL
+             OS_FS_ERROR if OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes written if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_pwrite (int32  filedes, void *buffer, uint32 nbytes, int64 offset)
+{
+    int32 status;
+
+    if (buffer == NULL)
         return OS_FS_ERR_INVALID_POINTER;
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
     }
-   
-    /*
-    ** Check to see if the path is too long
-    */
-    if (strlen(path) >= OS_MAX_PATH_LEN)
+    else
     {
-        return OS_FS_ERR_PATH_TOO_LONG;
+        status = pwrite64(OS_FDTable[filedes].OSfd, buffer, nbytes, (off64_t)offset);
+
+        if (status != ERROR)
+            return  status;
+        else
+            return OS_FS_ERROR;
     }
 
-    /* 
-    ** check if the name of the file is too long 
-    */
-    if (OS_check_name_length(path) != OS_FS_SUCCESS)
+}/* end OS_pwrite */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_fsync
+
+    Purpose: waits until the data and metadata of the file described in filedes
+             have reached the device
+
+    Returns: OS_FS_ERROR if OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_fsync (int32  filedes)
+{
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
     {
-        return OS_FS_ERR_NAME_TOO_LONG;
+        return OS_FS_ERR_INVALID_FD;
     }
 
-    /*
-    ** Make sure the file is not open by the OSAL before deleting it 
-    */
-    for ( i =0; i < OS_MAX_NUM_OPEN_FILES; i++)
+    if (fsync(OS_FDTable[filedes].OSfd) == ERROR)
+        return OS_FS_ERROR;
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_fsync */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_fdatasync
+
+    Purpose: waits until the data of the file described in filedes has reached the
+             device. Metadata such as the modification time is only synced when it
+             is needed to read the data back, which saves a write on most devices.
+
+    Returns: OS_FS_ERROR if OS call failed
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_fdatasync (int32  filedes)
+{
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
     {
-       if ((OS_FDTable[i].IsValid == TRUE) &&
-          (strcmp(OS_FDTable[i].Path, path) == 0))
-       {
-          return OS_FS_ERROR;
-       }
+        return OS_FS_ERR_INVALID_FD;
     }
- 
+
+    if (fdatasync(OS_FDTable[filedes].OSfd) == ERROR)
+        return OS_FS_ERROR;
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_fdatasync */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_fallocate
+
+    Purpose: allocates the blocks for length bytes of the file described in filedes,
+             starting at offset, so later writes to that range do not have to wait
+             for the file system. With mode 0 the file grows to cover the range if
+             needed. OS_FALLOC_KEEP_SIZE allocates the blocks without changing the
+             file size, and OS_FALLOC_PUNCH_HOLE frees the blocks of the range
+             instead, which then reads back as zeros.
+
+             If the file system cannot allocate blocks directly, mode 0 falls back
+             to posix_fallocate, which writes the range out. The other modes fail
+             on such a file system.
+
+    Returns: OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if the mode or range is invalid or the OS call failed
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_fallocate (int32  filedes, uint32 mode, int64 offset, int64 length)
+{
+    int os_mode;
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    if (offset < 0 || length <= 0 ||
+        (mode & ~(OS_FALLOC_KEEP_SIZE | OS_FALLOC_PUNCH_HOLE)) != 0)
+    {
+        return OS_FS_ERROR;
+    }
+
+    os_mode = 0;
+    if ((mode & OS_FALLOC_PUNCH_HOLE) != 0)
+    {
+        os_mode = FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE;
+    }
+    else if ((mode & OS_FALLOC_KEEP_SIZE) != 0)
+    {
+        os_mode = FALLOC_FL_KEEP_SIZE;
+    }
+
+    if (fallocate64(OS_FDTable[filedes].OSfd, os_mode, (off64_t)offset, (off64_t)length) == 0)
+    {
+        return OS_FS_SUCCESS;
+    }
+
+    if (os_mode == 0 && errno == EOPNOTSUPP &&
+        posix_fallocate64(OS_FDTable[filedes].OSfd, (off64_t)offset, (off64_t)length) == 0)
+    {
+        return OS_FS_SUCCESS;
+    }
+
+    return OS_FS_ERROR;
+
+}/* end OS_fallocate */
+
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_chmod
+
+    Notes: This is not going to be implemented because there is no use for this function.
+---------------------------------------------------------------------------------------*/
+
+int32 OS_chmod  (const char *path, uint32 access)
+{    
+    return OS_FS_UNIMPLEMENTED;
+} /* end OS_chmod */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_stat
+    
+    Purpose: returns information about a file or directory in a os_fs_stat structure
+    
+    Returns: OS_FS_ERR_INVALID_POINTER if path or filestats is NULL
+             OS_FS_ERR_PATH_TOO_LONG if the path is too long to be stored locally
+*****        OS_FS_ERR_NAME_TOO_LONG if the name of the file is too long to be stored
+             OS_FS_ERR_PATH_INVALID if path cannot be parsed
+             OS_FS_ERROR id the OS call failed
+             OS_FS_SUCCESS if success
+
+    Note: The information returned is in the structure pointed to by filestats         
+---------------------------------------------------------------------------------------*/
+
+int32 OS_stat   (const char *path, os_fstat_t  *filestats)
+{
+    int ret_val;
+    char local_path[OS_MAX_LOCAL_PATH_LEN];
+  
+    /*
+    ** Check to see if the file pointers are NULL
+    */
+    if (path == NULL || filestats == NULL)
+        return OS_FS_ERR_INVALID_POINTER;
+        
+    /*
+    ** Check to see if the path is too long
+    */
+    if (strlen(path) >= OS_MAX_PATH_LEN)
+        return OS_FS_ERR_PATH_TOO_LONG;
+
     /*
     ** Translate the path
     */
@@ -707,23 +1272,336 @@ int32 OS_remove (const char *path)
         return OS_FS_ERR_PATH_INVALID;
     }
 
-    /*
-    ** Call the system to remove the file
-    */
-    status = remove (local_path);
-    if (status == 0)
-    {
+    ret_val = stat( (char*) local_path, filestats);
+    if (ret_val == ERROR)
+        return OS_FS_ERROR;
+    else
         return OS_FS_SUCCESS;
+    
+} /* end OS_stat */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_lseek
+
+    Purpose: sets the read/write pointer to a specific offset in a specific file. 
+             Whence is either OS_SEEK_SET,OS_SEEK_CUR, or OS_SEEK_END
+
+    Returns: the new offset from the beginning of the file
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if OS call failed
+---------------------------------------------------------------------------------------*/
+
+int32 OS_lseek  (int32  filedes, int32 offset, uint32 whence)
+{
+     off_t status;
+     int where;
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
     }
     else
     {
-        return OS_FS_ERROR;
-    }
-    
-} /* end OS_remove */
+        switch(whence)
+        {
+            case OS_SEEK_SET:
+                where = SEEK_SET;
+                break;
+            case OS_SEEK_CUR:
+                where = SEEK_CUR;
+                break;
+            case OS_SEEK_END:
+                where = SEEK_END;
+                break;
+            default:
+                return OS_FS_ERROR;
+        }
 
-/*--------------------------------------------------------------------------------------
-    Name: OS_rename
+    
+        status = lseek( OS_FDTable[filedes].OSfd, (off_t) offset, (int) where );
+
+        if ( (int) status != ERROR)
+            return (int32) status;
+        else
+            return OS_FS_ERROR;
+    }
+ 
+}/* end OS_lseek */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_read64
+
+    Purpose: reads up to nbytes from a file, and puts them into buffer. Large
+             counts are split into several calls; the read stops early at end of
+             file or when the OS returns fewer bytes than asked for.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if buffer is a null pointer
+             OS_FS_ERROR if OS call failed before any data was read
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes read if success
+---------------------------------------------------------------------------------------*/
+
+int64 OS_read64 (int32  filedes, void *buffer, uint64 nbytes)
+{
+    uint64  done;
+    size_t  chunk;
+    ssize_t status;
+
+    if (buffer == NULL)
+        return OS_FS_ERR_INVALID_POINTER;
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    done = 0;
+    while (done < nbytes)
+    {
+        chunk = OS_IO64_CHUNK_SIZE;
+        if (nbytes - done < chunk)
+        {
+            chunk = nbytes - done;
+        }
+
+        status = read(OS_FDTable[filedes].OSfd, (char *)buffer + done, chunk);
+        if (status == ERROR)
+        {
+            if (done == 0)
+                return OS_FS_ERROR;
+            break;
+        }
+
+        done += status;
+        if ((size_t)status < chunk)
+        {
+            break;
+        }
+    }
+
+    return (int64)done;
+
+}/* end OS_read64 */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_write64
+
+    Purpose: writes up to nbytes of buffer to the file described in filedes. Large
+             counts are split into several calls; the write stops early when the
+             OS accepts fewer bytes than asked for.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if buffer is NULL
+             OS_FS_ERROR if OS call failed before any data was written
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             number of bytes written if success
+---------------------------------------------------------------------------------------*/
+
+int64 OS_write64 (int32  filedes, void *buffer, uint64 nbytes)
+{
+    uint64  done;
+    size_t  chunk;
+    ssize_t status;
+
+    if (buffer == NULL)
+        return OS_FS_ERR_INVALID_POINTER;
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    done = 0;
+    while (done < nbytes)
+    {
+        chunk = OS_IO64_CHUNK_SIZE;
+        if (nbytes - done < chunk)
+        {
+            chunk = nbytes - done;
+        }
+
+        status = write(OS_FDTable[filedes].OSfd, (char *)buffer + done, chunk);
+        if (status == ERROR)
+        {
+            if (done == 0)
+                return OS_FS_ERROR;
+            break;
+        }
+
+        done += status;
+        if ((size_t)status < chunk)
+        {
+            break;
+        }
+    }
+
+    return (int64)done;
+
+}/* end OS_write64 */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_stat64
+
+    Purpose: returns the size, mode and modification time of a file or directory,
+             with a size that is not limited by the width of off_t
+
+    Returns: OS_FS_ERR_INVALID_POINTER if path or filestats is NULL
+             OS_FS_ERR_PATH_TOO_LONG if the path is too long to be stored locally
+             OS_FS_ERR_PATH_INVALID if path cannot be parsed
+             OS_FS_ERROR id the OS call failed
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_stat64 (const char *path, os_fstat64_t *filestats)
+{
+    struct stat64 st;
+    char local_path[OS_MAX_LOCAL_PATH_LEN];
+
+    if (path == NULL || filestats == NULL)
+        return OS_FS_ERR_INVALID_POINTER;
+
+    if (strlen(path) >= OS_MAX_PATH_LEN)
+        return OS_FS_ERR_PATH_TOO_LONG;
+
+    if ( OS_TranslatePath(path, (char *)local_path) != OS_FS_SUCCESS )
+    {
+        return OS_FS_ERR_PATH_INVALID;
+    }
+
+    if (stat64(local_path, &st) == ERROR)
+        return OS_FS_ERROR;
+
+    filestats->FileSize     = (uint64)st.st_size;
+    filestats->FileModeBits = (uint32)st.st_mode;
+    filestats->FileTime     = (int64)st.st_mtime;
+
+    return OS_FS_SUCCESS;
+
+} /* end OS_stat64 */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_lseek64
+
+    Purpose: sets the read/write pointer to a specific 64-bit offset in a specific
+             file. Whence is either OS_SEEK_SET,OS_SEEK_CUR, or OS_SEEK_END
+
+    Returns: the new offset from the beginning of the file
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if OS call failed
+---------------------------------------------------------------------------------------*/
+
+int64 OS_lseek64 (int32  filedes, int64 offset, uint32 whence)
+{
+    off64_t status;
+    int where;
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    switch(whence)
+    {
+        case OS_SEEK_SET:
+            where = SEEK_SET;
+            break;
+        case OS_SEEK_CUR:
+            where = SEEK_CUR;
+            break;
+        case OS_SEEK_END:
+            where = SEEK_END;
+            break;
+        default:
+            return OS_FS_ERROR;
+    }
+
+    status = lseek64(OS_FDTable[filedes].OSfd, (off64_t)offset, where);
+    if (status == ERROR)
+        return OS_FS_ERROR;
+
+    return (int64)status;
+
+}/* end OS_lseek64 */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_remove
+
+    Purpose: removes a given filename from the drive
+ 
+    Returns: OS_FS_SUCCESS if the driver returns OK
+             OS_FS_ERROR if there is no device or the driver returns error
+             OS_FS_ERR_INVALID_POINTER if path is NULL
+             OS_FS_ERR_PATH_TOO_LONG if path is too long to be stored locally
+             OS_FS_ERR_PATH_INVALID if path cannot be parsed
+             OS_FS_ERR_NAME_TOO_LONG if the name of the file to remove is too long to be
+             stored locally
+---------------------------------------------------------------------------------------*/
+
+int32 OS_remove (const char *path)
+{
+    int  status;
+    char local_path[OS_MAX_LOCAL_PATH_LEN];
+
+    /*
+    ** Check to see if the path pointer is NULL
+    */
+    if (path == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+   
+    /*
+    ** Check to see if the path is too long
+    */
+    if (strlen(path) >= OS_MAX_PATH_LEN)
+    {
+        return OS_FS_ERR_PATH_TOO_LONG;
+    }
+
+    /* 
+    ** check if the name of the file is too long 
+    */
+    if (OS_check_name_length(path) != OS_FS_SUCCESS)
+    {
+        return OS_FS_ERR_NAME_TOO_LONG;
+    }
+
+    /*
+    ** Make sure the file is not open by the OSAL before deleting it 
+    */
+    if (OS_FDPathIsOpen(path))
+    {
+       return OS_FS_ERROR;
+    }
+ 
+    /*
+    ** Translate the path
+    */
+    if ( OS_TranslatePath(path, (char *)local_path) != OS_FS_SUCCESS )
+    {
+        return OS_FS_ERR_PATH_INVALID;
+    }
+
+    /*
+    ** Call the system to remove the file
+    */
+    status = remove (local_path);
+    if (status == 0)
+    {
+        return OS_FS_SUCCESS;
+    }
+    else
+    {
+        return OS_FS_ERROR;
+    }
+    
+} /* end OS_remove */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_rename
     
     Purpose: renames a file
 
@@ -735,789 +1613,3347 @@ int32 OS_remove (const char *path)
              OS_FS_ERR_NAME_TOO_LONG if the new name is too long to be stored locally
 ---------------------------------------------------------------------------------------*/
 
-int32 OS_rename (const char *old, const char *new)
+int32 OS_rename (const char *old, const char *new)
+{
+    int status;
+    int32 i;
+    char old_path[OS_MAX_LOCAL_PATH_LEN];
+    char new_path[OS_MAX_LOCAL_PATH_LEN];
+    sigset_t  previous;
+    sigset_t  mask;
+
+    /*
+    ** Check to see if the path pointers are NULL
+    */    
+    if (old == NULL || new == NULL)
+        return OS_FS_ERR_INVALID_POINTER;
+
+    /*
+    ** Check to see if the paths are too long
+    */
+    if (strlen(old) >= OS_MAX_PATH_LEN)
+        return OS_FS_ERR_PATH_TOO_LONG;
+    
+    if (strlen(new) >= OS_MAX_PATH_LEN)
+        return OS_FS_ERR_PATH_TOO_LONG;
+
+    /* 
+    ** check if the names of the files are too long 
+    */
+    if (OS_check_name_length(old) != OS_FS_SUCCESS)
+        return OS_FS_ERR_NAME_TOO_LONG;
+
+    if (OS_check_name_length(new) != OS_FS_SUCCESS)
+        return OS_FS_ERR_NAME_TOO_LONG;
+
+
+    /*
+    ** Translate the path
+    */
+    if ( OS_TranslatePath(old, (char *)old_path) != OS_FS_SUCCESS )
+    {
+        return OS_FS_ERR_PATH_INVALID;
+    }
+
+    /*
+    ** Translate the path
+    */
+    if ( OS_TranslatePath(new, (char *)new_path) != OS_FS_SUCCESS )
+    {
+        return OS_FS_ERR_PATH_INVALID;
+    }
+     
+    status = rename (old_path, new_path);
+    if (status == 0)
+    {
+        /*
+        ** Files open under the old name now go by the new one. Renaming a
+        ** file to its own name leaves them alone, as the search for the old
+        ** name would keep finding the slot just re-keyed.
+        */
+        if (strcmp(old, new) == 0)
+        {
+            return OS_FS_SUCCESS;
+        }
+
+        OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+        while ((i = OS_FDPathFind(old)) >= 0)
+        {
+            OS_FDPathRemove(i);
+            strncpy (OS_FDTable[i].Path, new, OS_MAX_PATH_LEN);  
+            OS_FDPathInsert(i);
+        }
+        OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+        return OS_FS_SUCCESS;
+    }
+    else
+    {
+        return OS_FS_ERROR;
+    }
+     
+}/*end OS_rename */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_CopyFileData
+
+    Purpose: Copies src_fd to dest_fd up to end of file. The data is moved inside
+             the kernel with copy_file_range where the file systems support it, then
+             sendfile, and finally with a plain read/write loop.
+
+    Returns: OS_FS_SUCCESS if all of the data was copied
+             OS_FS_ERROR if a read or write failed
+---------------------------------------------------------------------------------------*/
+
+static int32 OS_CopyFileData(int src_fd, int dest_fd, uint64 total_bytes,
+                             OS_FileProgress_t callback, void *arg)
+{
+    uint64  copied;
+    size_t  chunk;
+    ssize_t count;
+    ssize_t written;
+    ssize_t done;
+    int     use_copy_range;
+    int     use_sendfile;
+    char    buffer[OS_COPY_BUFFER_SIZE];
+
+    copied         = 0;
+    use_copy_range = TRUE;
+    use_sendfile   = TRUE;
+
+    /*
+    ** Copy up to end of file rather than total_bytes, which is only used for
+    ** the progress report: some files (e.g. under /proc) report a size of 0
+    */
+    while (TRUE)
+    {
+        chunk = OS_CP_CHUNK_SIZE;
+        count = -1;
+
+        if (use_copy_range)
+        {
+            count = copy_file_range(src_fd, NULL, dest_fd, NULL, chunk, 0);
+            if (count < 0 && errno != EINTR)
+            {
+                /*
+                ** ENOSYS, EXDEV, EINVAL and friends all mean the kernel or the
+                ** file systems cannot do it; drop to the next method for the
+                ** rest of the file
+                */
+                use_copy_range = FALSE;
+            }
+            else if (count == 0 && copied == 0)
+            {
+                /*
+                ** Pseudo files may give nothing here; confirm the end of
+                ** file with a plain read
+                */
+                use_copy_range = FALSE;
+                use_sendfile   = FALSE;
+                count          = -1;
+            }
+        }
+        else if (use_sendfile)
+        {
+            count = sendfile(dest_fd, src_fd, NULL, chunk);
+            if (count < 0 && errno != EINTR)
+            {
+                use_sendfile = FALSE;
+            }
+        }
+        else
+        {
+            if (chunk > sizeof(buffer))
+            {
+                chunk = sizeof(buffer);
+            }
+
+            count = read(src_fd, buffer, chunk);
+            if (count < 0 && errno != EINTR)
+            {
+                return OS_FS_ERROR;
+            }
+
+            for (done = 0; done < count; done += written)
+            {
+                written = write(dest_fd, buffer + done, count - done);
+                if (written < 0)
+                {
+                    if (errno != EINTR)
+                    {
+                        return OS_FS_ERROR;
+                    }
+                    written = 0;
+                }
+            }
+        }
+
+        if (count == 0)
+        {
+            break;
+        }
+
+        if (count > 0)
+        {
+            copied += count;
+
+            if (callback != NULL)
+            {
+                callback(copied, total_bytes, arg);
+            }
+        }
+    }
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_CopyFileData */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_cpProgress
+    
+    Purpose: Copies a single file from src to dest, keeping the permission bits of
+             src. If callback is not NULL it is called after each chunk of the copy
+             with the number of bytes copied so far, the size of the file and arg.
+
+    Returns: OS_FS_SUCCESS if the operation worked
+             OS_FS_ERROR if the file could not be accessed, or src and dest are the
+                         same file
+             OS_FS_ERR_INVALID_POINTER if src or dest are NULL
+             OS_FS_ERR_PATH_INVALID if path cannot be parsed
+             OS_FS_ERR_PATH_TOO_LONG if the paths given are too long to be stored locally
+             OS_FS_ERR_NAME_TOO_LONG if the dest name is too long to be stored locally
+
+---------------------------------------------------------------------------------------*/
+
+int32 OS_cpProgress (const char *src, const char *dest, OS_FileProgress_t callback, void *arg)
+{
+    int         src_fd;
+    int         dest_fd;
+    int32       status;
+    struct stat src_stat;
+    struct stat dest_stat;
+    char        src_path[OS_MAX_LOCAL_PATH_LEN];
+    char        dest_path[OS_MAX_LOCAL_PATH_LEN];
+
+    /*
+    ** Check to see if the path pointers are NULL
+    */    
+    if (src == NULL || dest == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    /*
+    ** Check to see if the paths are too long
+    */
+    if (strlen(src) >= OS_MAX_PATH_LEN)
+    {
+        return OS_FS_ERR_PATH_TOO_LONG;
+    }
+    
+    if (strlen(dest) >= OS_MAX_PATH_LEN)
+    {
+        return OS_FS_ERR_PATH_TOO_LONG;
+    }
+
+    /* 
+    ** check if the names of the files are too long 
+    */
+    if (OS_check_name_length(src) != OS_FS_SUCCESS)
+    {
+        return OS_FS_ERR_NAME_TOO_LONG;
+    }
+
+    if (OS_check_name_length(dest) != OS_FS_SUCCESS)
+    {
+        return OS_FS_ERR_NAME_TOO_LONG;
+    }
+
+    /*
+    ** Make sure the destintation file is not open by the OSAL before doing the copy 
+    ** This may be caught by the host OS call but it does not hurt to 
+    ** be consistent 
+    */
+    if (OS_FDPathIsOpen(dest))
+    {
+       return OS_FS_ERROR;
+    }
+
+    /*
+    ** Translate the path
+    */
+    if ( OS_TranslatePath(src, (char *)src_path) != OS_FS_SUCCESS )
+    {
+        return OS_FS_ERR_PATH_INVALID;
+    }
+
+    /*
+    ** Translate the path
+    */
+    if ( OS_TranslatePath(dest, (char *)dest_path) != OS_FS_SUCCESS )
+    {
+        return OS_FS_ERR_PATH_INVALID;
+    }
+
+    src_fd = open(src_path, O_RDONLY);
+    if (src_fd < 0)
+    {
+        return OS_FS_ERROR;
+    }
+
+    if (fstat(src_fd, &src_stat) != 0 || !S_ISREG(src_stat.st_mode))
+    {
+        close(src_fd);
+        return OS_FS_ERROR;
+    }
+
+    dest_fd = open(dest_path, O_WRONLY | O_CREAT, src_stat.st_mode & 07777);
+    if (dest_fd < 0)
+    {
+        close(src_fd);
+        return OS_FS_ERROR;
+    }
+
+    /*
+    ** Only truncate dest once it is known not to be src itself, under this
+    ** or any other name; copying a file onto itself is an error
+    */
+    if (fstat(dest_fd, &dest_stat) != 0 ||
+        (dest_stat.st_dev == src_stat.st_dev && dest_stat.st_ino == src_stat.st_ino) ||
+        ftruncate(dest_fd, 0) != 0)
+    {
+        close(src_fd);
+        close(dest_fd);
+        return OS_FS_ERROR;
+    }
+
+    status = OS_CopyFileData(src_fd, dest_fd, (uint64)src_stat.st_size, callback, arg);
+
+    /*
+    ** The mode given to open() only applies to a new file and is filtered
+    ** by the umask, so set it explicitly
+    */
+    if (status == OS_FS_SUCCESS && fchmod(dest_fd, src_stat.st_mode & 07777) != 0)
+    {
+        status = OS_FS_ERROR;
+    }
+
+    close(src_fd);
+    if (close(dest_fd) != 0)
+    {
+        status = OS_FS_ERROR;
+    }
+
+    return status;
+     
+}/*end OS_cpProgress */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_cp
+    
+    Purpose: Copies a single file from src to dest
+
+    Returns: OS_FS_SUCCESS if the operation worked
+             OS_FS_ERROR if the file could not be accessed
+             OS_FS_ERR_INVALID_POINTER if src or dest are NULL
+             OS_FS_ERR_PATH_INVALID if path cannot be parsed
+             OS_FS_ERR_PATH_TOO_LONG if the paths given are too long to be stored locally
+             OS_FS_ERR_NAME_TOO_LONG if the dest name is too long to be stored locally
+
+---------------------------------------------------------------------------------------*/
+
+int32 OS_cp (const char *src, const char *dest)
+{
+    return OS_cpProgress(src, dest, NULL, NULL);
+     
+}/*end OS_cp */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_mv
+    
+    Purpose: moves a single file from src to dest
+
+    Returns: OS_FS_SUCCESS if the rename works
+             OS_FS_ERROR if the file could not be opened or renamed.
+             OS_FS_ERR_INVALID_POINTER if src or dest are NULL
+             OS_FS_ERR_PATH_INVALID if path cannot be parsed
+             OS_FS_ERR_PATH_TOO_LONG if the paths given are too long to be stored locally
+             OS_FS_ERR_NAME_TOO_LONG if the dest name is too long to be stored locally
+---------------------------------------------------------------------------------------*/
+
+int32 OS_mv (const char *src, const char *dest)
+{
+   int32 status;
+
+   /*
+   ** Validate the source and destination
+   ** These checks may seem redundant because OS_cp and OS_remove also do 
+   ** the same checks, but this call needs to abort before doing a copy
+   ** in some cases.
+   */
+
+   /*
+   ** Check to see if the path pointers are NULL
+   */
+   if (src == NULL || dest == NULL)
+   {
+        return OS_FS_ERR_INVALID_POINTER;
+   }
+
+   /*
+   ** Check to see if the paths are too long
+   */
+   if (strlen(src) >= OS_MAX_PATH_LEN)
+   {
+       return OS_FS_ERR_PATH_TOO_LONG;
+   }
+
+   if (strlen(dest) >= OS_MAX_PATH_LEN)
+   {
+       return OS_FS_ERR_PATH_TOO_LONG;
+   }
+
+   /* 
+   ** check if the names of the files are too long 
+   */
+   if (OS_check_name_length(src) != OS_FS_SUCCESS)
+   {
+       return OS_FS_ERR_NAME_TOO_LONG;
+   }
+
+   if (OS_check_name_length(dest) != OS_FS_SUCCESS)
+   {
+       return OS_FS_ERR_NAME_TOO_LONG;
+   }
+
+   /*
+   ** Make sure the source file is not open by the OSAL before doing the move 
+   */
+   if (OS_FDPathIsOpen(src))
+   {
+      return OS_FS_ERROR;
+   }
+
+   status = OS_cp (src, dest);
+   if ( status == OS_FS_SUCCESS )
+   {
+      status = OS_remove(src);
+   }
+
+   return ( status);
+}/*end OS_mv */
+
+/*
+** Directory API 
+*/
+/*--------------------------------------------------------------------------------------
+    Name: OS_mkdir
+
+    Purpose: makes a directory specified by path.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if path is NULL
+             OS_FS_ERR_PATH_TOO_LONG if the path is too long to be stored locally
+             OS_FS_ERR_PATH_INVALID if path cannot be parsed
+             OS_FS_ERROR if the OS call fails
+             OS_FS_SUCCESS if success
+
+    Note: The access parameter is currently unused.
+---------------------------------------------------------------------------------------*/
+
+int32 OS_mkdir (const char *path, uint32 access)
+{
+   int status;
+   mode_t mode;
+   char local_path[OS_MAX_LOCAL_PATH_LEN];
+
+    /*
+    ** Check to see if the path pointer is NULL
+    */    
+    if (path == NULL)
+        return OS_FS_ERR_INVALID_POINTER;
+
+    /*
+    ** Check to see if the path is too long
+    */      
+    if (strlen(path) >= OS_MAX_PATH_LEN)
+        return OS_FS_ERR_PATH_TOO_LONG;
+
+
+    /*
+    ** Translate the path
+    */
+    if ( OS_TranslatePath(path, (char *)local_path) != OS_FS_SUCCESS )
+    {
+        return OS_FS_ERR_PATH_INVALID;
+    }
+    
+    mode = S_IFDIR |S_IRWXU | S_IRWXG | S_IRWXO;
+    status = mkdir(local_path, mode);
+
+    if (status == 0)
+    {
+        return OS_FS_SUCCESS;
+    }
+    else
+    {
+        return OS_FS_ERROR;
+    }
+    
+}/* end OS_mkdir */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_opendir
+
+    Purpose: opens a directory for searching
+
+    Returns: NULL if there is an error  
+             a pointer to a directory if success
+             
+---------------------------------------------------------------------------------------*/
+
+os_dirp_t OS_opendir (const char *path)
+{
+
+    os_dirp_t dirdescptr;
+    char local_path[OS_MAX_LOCAL_PATH_LEN];
+
+    /*
+    ** Check to see if the path pointer is NULL
+    */        
+    if (path == NULL)
+    {
+        return NULL;
+    }
+
+    /*
+    ** Check to see if the path is too long
+    */      
+    if (strlen(path) > OS_MAX_PATH_LEN)
+    {
+        return NULL;
+    }
+   
+    /*
+    ** Translate the path
+    */
+    if ( OS_TranslatePath(path, (char *)local_path) != OS_FS_SUCCESS )
+    {
+        return NULL;
+    }
+   
+    dirdescptr = opendir( (char*) local_path);
+    
+    if (dirdescptr == NULL)
+    {
+        return NULL;
+    }
+    else
+    {
+        return dirdescptr;
+    }
+    
+} /* end OS_opendir */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_closedir
+    
+    Purpose: closes a directory
+
+    Returns: OS_FS_SUCCESS if success
+             OS_FS_ERROR if close failed
+---------------------------------------------------------------------------------------*/
+
+int32 OS_closedir (os_dirp_t directory)
+{ 
+    int status;
+
+    if (directory == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    status = closedir(directory);
+    if (status != ERROR)
+    {
+        return OS_FS_SUCCESS;
+    }
+    else
+    {
+        return OS_FS_ERROR;
+    }
+
+} /* end OS_closedir */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_readdir
+
+    Purpose: obtains directory entry data for the next file from an open directory
+
+    Returns: a pointer to the next entry for success
+             NULL if error or end of directory is reached
+---------------------------------------------------------------------------------------*/
+os_dirent_t *  OS_readdir (os_dirp_t directory)
+{ 
+    os_dirent_t *tempptr;
+
+    if (directory == NULL)
+        return NULL;
+
+    tempptr = readdir( directory);
+    
+    if (tempptr != NULL)
+    {
+        return tempptr;
+    }
+    else
+    {
+        return NULL;
+    }
+        
+} /* end OS_readdir */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_rewinddir
+
+    Purpose: Rewinds the directory pointer
+
+    Returns: N/A
+---------------------------------------------------------------------------------------*/
+void  OS_rewinddir (os_dirp_t directory )
+{
+    if (directory != NULL)
+    {
+       rewinddir( directory);
+    }
+}
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_ReadDirBatch
+
+    Purpose: reads up to max_entries entries from an open directory, together with
+             their type, size and modification time. The entries are read straight
+             from the kernel and stat'ed relative to the directory, so no path is
+             translated or looked up from the root again.
+
+             This reads the directory through its own file descriptor, so it should
+             not be mixed with OS_readdir on the same directory other than right after
+             OS_opendir or OS_rewinddir.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if directory or entries is NULL
+             OS_FS_ERROR if the OS call failed before any entry was read
+             the number of entries filled in, 0 at the end of the directory
+---------------------------------------------------------------------------------------*/
+int32 OS_ReadDirBatch (os_dirp_t directory, os_dirent_info_t *entries, uint32 max_entries)
+{
+    char             buffer[OS_READDIR_BUFFER_SIZE];
+    struct dirent64 *rec;
+    struct stat64    st;
+    int              dir_fd;
+    long             nread;
+    long             pos;
+    uint32           count;
+
+    if (directory == NULL || entries == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    dir_fd = dirfd(directory);
+    if (dir_fd < 0)
+    {
+        return OS_FS_ERROR;
+    }
+
+    count = 0;
+    while (count < max_entries)
+    {
+        nread = syscall(SYS_getdents64, dir_fd, buffer, sizeof(buffer));
+        if (nread < 0)
+        {
+            if (count == 0)
+                return OS_FS_ERROR;
+            break;
+        }
+        if (nread == 0)
+        {
+            break;
+        }
+
+        for (pos = 0; pos < nread && count < max_entries; pos += rec->d_reclen)
+        {
+            rec = (struct dirent64 *)(buffer + pos);
+
+            strncpy(entries[count].FileName, rec->d_name, sizeof(entries[count].FileName) - 1);
+            entries[count].FileName[sizeof(entries[count].FileName) - 1] = '\0';
+
+            if (fstatat64(dir_fd, rec->d_name, &st, 0) == 0)
+            {
+                if (S_ISREG(st.st_mode))
+                    entries[count].FileType = OS_DIRENT_TYPE_FILE;
+                else if (S_ISDIR(st.st_mode))
+                    entries[count].FileType = OS_DIRENT_TYPE_DIR;
+                else
+                    entries[count].FileType = OS_DIRENT_TYPE_OTHER;
+                entries[count].FileSize = (uint64)st.st_size;
+                entries[count].FileTime = (int64)st.st_mtime;
+            }
+            else
+            {
+                /* The entry went away since it was read; report what the kernel gave */
+                if (rec->d_type == DT_REG)
+                    entries[count].FileType = OS_DIRENT_TYPE_FILE;
+                else if (rec->d_type == DT_DIR)
+                    entries[count].FileType = OS_DIRENT_TYPE_DIR;
+                else if (rec->d_type == DT_UNKNOWN)
+                    entries[count].FileType = OS_DIRENT_TYPE_UNKNOWN;
+                else
+                    entries[count].FileType = OS_DIRENT_TYPE_OTHER;
+                entries[count].FileSize = 0;
+                entries[count].FileTime = 0;
+            }
+
+            ++count;
+        }
+
+        /*
+        ** If the caller's array filled up part way through the buffer, move the
+        ** directory back to just after the last entry returned, so the next call
+        ** starts there
+        */
+        if (pos < nread)
+        {
+            lseek64(dir_fd, rec->d_off, SEEK_SET);
+            break;
+        }
+    }
+
+    return (int32)count;
+
+} /* end OS_ReadDirBatch */
+/*--------------------------------------------------------------------------------------
+    Name: OS_rmdir
+    
+    Purpose: removes a directory from  the structure (must be an empty directory)
+
+    Returns: OS_FS_ERR_INVALID_POINTER if path is NULL
+             OS_FS_ERR_PATH_INVALID if path cannot be parsed    
+             OS_FS_ER_PATH_TOO_LONG
+             OS_FS_SUCCESS on success
+             OS_FS_ERROR if the directory remove operation failed
+---------------------------------------------------------------------------------------*/
+
+int32  OS_rmdir (const char *path)
+{
+    int status;
+    char local_path [OS_MAX_LOCAL_PATH_LEN];
+
+    /*
+    ** Check to see if the path pointer is NULL
+    */            
+    if (path == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    /*
+    ** Check to see if the path is too long
+    */      
+    if (strlen(path) >= OS_MAX_PATH_LEN)
+    {
+        return OS_FS_ERR_PATH_TOO_LONG;
+    }
+
+    /*
+    ** Translate the path
+    */
+    if ( OS_TranslatePath(path, (char *)local_path) != OS_FS_SUCCESS )
+    {
+        return OS_FS_ERR_PATH_INVALID;
+    }
+    
+    status = rmdir(local_path);
+    
+    if (status == 0)
+    {
+        return OS_FS_SUCCESS;
+    }
+    else
+    {
+        return OS_FS_ERROR;
+    }
+    
+}/* end OS_rmdir */
+
+/* --------------------------------------------------------------------------------------
+    Name: OS_check_name_length
+    
+    Purpose: Checks the length of the file name at the end of the path.
+    
+    Returns: OS_FS_ERROR if path is NULL, path is too long, there is no '/' in the path
+             name, the name is too long
+             OS_SUCCESS if success
+            
+    NOTE: This is only an internal function and is not intended for use by the user
+ ---------------------------------------------------------------------------------------*/
+
+int32 OS_check_name_length(const char *path)
+{
+    char* name_ptr;
+
+    if (path == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    if (strlen(path) > OS_MAX_PATH_LEN)
+    {
+        return OS_FS_ERROR;
+    }
+
+    /*
+     * All names passed into this function are REQUIRED to contain at
+     * least one directory separator. Find the last one.
+     */
+    name_ptr = strrchr(path, '/');
+    if (name_ptr == NULL)
+    {
+        return OS_FS_ERROR;
+    }
+
+    /*
+     * Advance the pointer past the directory separator so that it
+     * indicates the final component of the path.
+     */
+    name_ptr ++;
+
+    /*
+     * Reject paths whose final component is too long.
+     */
+    if( strlen(name_ptr) > OS_MAX_FILE_NAME)
+    {
+        return OS_FS_ERROR;
+    }
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_check_name_length */
+/* --------------------------------------------------------------------------------------
+    Name: OS_ShellSpawn
+    
+    Purpose: Starts "/bin/sh -c Cmd" with its stdout and stderr going to out_fd.
+             posix_spawn does not copy the address space of the calling process
+             (glibc uses a vfork style clone), so this stays cheap however large
+             or locked the process is. The child is put in its own process group
+             so that it can be stopped along with anything it starts.
+    
+    Returns: OS_FS_SUCCESS if the shell was started, with its process id in *pid
+             OS_FS_ERROR otherwise
+ ---------------------------------------------------------------------------------------*/
+static int32 OS_ShellSpawn(char *Cmd, int out_fd, pid_t *pid)
+{
+    posix_spawn_file_actions_t actions;
+    posix_spawnattr_t          attr;
+    sigset_t                   mask;
+    char                      *argv[4];
+    int                        status;
+
+    argv[0] = "sh";
+    argv[1] = "-c";
+    argv[2] = Cmd;
+    argv[3] = NULL;
+
+    if (posix_spawn_file_actions_init(&actions) != 0)
+    {
+        return OS_FS_ERROR;
+    }
+
+    if (posix_spawnattr_init(&attr) != 0)
+    {
+        posix_spawn_file_actions_destroy(&actions);
+        return OS_FS_ERROR;
+    }
+
+    /*
+    ** OSAL tasks run with most signals blocked; the command should not
+    */
+    sigemptyset(&mask);
+
+    status = posix_spawn_file_actions_adddup2(&actions, out_fd, STDOUT_FILENO);
+    if (status == 0)
+    {
+        status = posix_spawn_file_actions_adddup2(&actions, out_fd, STDERR_FILENO);
+    }
+    if (status == 0)
+    {
+        status = posix_spawnattr_setsigmask(&attr, &mask);
+    }
+    if (status == 0)
+    {
+        status = posix_spawnattr_setpgroup(&attr, 0);
+    }
+    if (status == 0)
+    {
+        status = posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETPGROUP);
+    }
+    if (status == 0)
+    {
+        status = posix_spawn(pid, "/bin/sh", &actions, &attr, argv, environ);
+    }
+
+    posix_spawnattr_destroy(&attr);
+    posix_spawn_file_actions_destroy(&actions);
+
+    if (status != 0)
+    {
+        return OS_FS_ERROR;
+    }
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_ShellSpawn */
+
+/* --------------------------------------------------------------------------------------
+    Name: OS_ShellRemainingMsecs
+    
+    Purpose: Works out how long is left until a CLOCK_MONOTONIC deadline, rounded up
+             and clamped so that it fits the timeout of poll
+    
+    Returns: The number of msecs left, or 0 if the deadline has passed
+ ---------------------------------------------------------------------------------------*/
+static int OS_ShellRemainingMsecs(const struct timespec *deadline)
+{
+    struct timespec now;
+    int64           msecs;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (now.tv_sec > deadline->tv_sec ||
+       (now.tv_sec == deadline->tv_sec && now.tv_nsec >= deadline->tv_nsec))
+    {
+        return 0;
+    }
+
+    msecs = ((int64)(deadline->tv_sec - now.tv_sec) * 1000) +
+            ((deadline->tv_nsec - now.tv_nsec) / 1000000) + 1;
+    if (msecs > 0x7FFFFFFF)
+    {
+        msecs = 0x7FFFFFFF;
+    }
+
+    return (int)msecs;
+
+}/* end OS_ShellRemainingMsecs */
+
+/* --------------------------------------------------------------------------------------
+    Name: OS_ShellWait
+    
+    Purpose: Waits for the shell started by OS_ShellSpawn to exit. If deadline is not
+             NULL the wait gives up at that CLOCK_MONOTONIC time, leaving the shell
+             to be killed and reaped by the caller.
+    
+    Returns: OS_FS_SUCCESS if the command exited with status 0
+             OS_ERROR_TIMEOUT if the command was still running at the deadline
+             OS_FS_ERROR otherwise
+ ---------------------------------------------------------------------------------------*/
+static int32 OS_ShellWait(pid_t pid, const struct timespec *deadline)
+{
+    struct timespec delay;
+    pid_t           result;
+    int             wait_msecs;
+    int             status;
+
+    while (1)
+    {
+        result = waitpid(pid, &status, (deadline != NULL) ? WNOHANG : 0);
+        if (result == pid)
+        {
+            break;
+        }
+        if (result < 0)
+        {
+            if (errno != EINTR)
+            {
+                return OS_FS_ERROR;
+            }
+            continue;
+        }
+
+        /*
+        ** Still running: check again every few msecs until the deadline
+        */
+        wait_msecs = OS_ShellRemainingMsecs(deadline);
+        if (wait_msecs == 0)
+        {
+            return OS_ERROR_TIMEOUT;
+        }
+        if (wait_msecs > 10)
+        {
+            wait_msecs = 10;
+        }
+        delay.tv_sec  = 0;
+        delay.tv_nsec = wait_msecs * 1000000;
+        nanosleep(&delay, NULL);
+    }
+
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 0)
+    {
+        return OS_FS_SUCCESS;
+    }
+
+    return OS_FS_ERROR;
+
+}/* end OS_ShellWait */
+
+/* --------------------------------------------------------------------------------------
+    Name: OS_ShellOutputToFile
+    
+    Purpose: Takes a shell command in and writes the output of that command to the specified file
+    
+    Returns: OS_FS_ERROR if the command was not executed properly
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+int32 OS_ShellOutputToFile(char* Cmd, int32 OS_fd)
+{
+    return OS_ShellOutputToFileLimited(Cmd, OS_fd, 0, 0);
+
+}/* end OS_ShellOutputToFile */
+
+/* --------------------------------------------------------------------------------------
+    Name: OS_ShellOutputToFileLimited
+    
+    Purpose: Takes a shell command in and writes the output of that command to the
+             specified file, like OS_ShellOutputToFile. If timeout_msecs is not 0 the
+             command is killed when it runs for longer than that; if max_bytes is not
+             0 at most that many bytes of output are written and the command is
+             killed when it produces more.
+    
+    Returns: OS_FS_ERROR if the command was not executed properly
+             OS_FS_ERR_INVALID_POINTER if Cmd is NULL
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_ERROR_TIMEOUT if the command did not finish within timeout_msecs
+             OS_ERR_OUTPUT_TRUNCATED if the command wrote more than max_bytes
+             OS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+int32 OS_ShellOutputToFileLimited(char* Cmd, int32 OS_fd, uint32 timeout_msecs, uint32 max_bytes)
+{
+    int             pipe_fds[2];
+    int             wait_msecs;
+    pid_t           pid;
+    int32           ReturnCode;
+    uint32          total;
+    ssize_t         count;
+    ssize_t         written;
+    ssize_t         done;
+    struct pollfd   pfd;
+    struct timespec deadline;
+    char            buffer[OS_COPY_BUFFER_SIZE];
+
+    /*
+    ** Check parameters
+    */
+    if (Cmd == NULL)
+    {
+        return(OS_FS_ERR_INVALID_POINTER);
+    }
+
+    /* 
+    ** Make sure the file descriptor is valid before using it 
+    */
+    if (OS_fd < 0 || OS_fd >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[OS_fd].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    /* Make sure that we are able to access this file */
+    fchmod(OS_FDTable[OS_fd].OSfd,0777);
+
+    /*
+    ** Without limits the command writes straight into the file
+    */
+    if (timeout_msecs == 0 && max_bytes == 0)
+    {
+        if (OS_ShellSpawn(Cmd, OS_FDTable[OS_fd].OSfd, &pid) != OS_FS_SUCCESS)
+        {
+            return OS_FS_ERROR;
+        }
+
+        return OS_ShellWait(pid, NULL);
+    }
+
+    /*
+    ** Otherwise the output goes through a pipe so it can be counted, and
+    ** the pipe is polled so the run time can be bounded
+    */
+    if (pipe2(pipe_fds, O_CLOEXEC) != 0)
+    {
+        return OS_FS_ERROR;
+    }
+
+    ReturnCode = OS_ShellSpawn(Cmd, pipe_fds[1], &pid);
+    close(pipe_fds[1]);
+    if (ReturnCode != OS_FS_SUCCESS)
+    {
+        close(pipe_fds[0]);
+        return OS_FS_ERROR;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec  += timeout_msecs / 1000;
+    deadline.tv_nsec += (timeout_msecs % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000)
+    {
+        deadline.tv_nsec -= 1000000000;
+        ++deadline.tv_sec;
+    }
+
+    pfd.fd     = pipe_fds[0];
+    pfd.events = POLLIN;
+    total      = 0;
+    ReturnCode = OS_FS_SUCCESS;
+
+    while (ReturnCode == OS_FS_SUCCESS)
+    {
+        wait_msecs = -1;
+        if (timeout_msecs != 0)
+        {
+            wait_msecs = OS_ShellRemainingMsecs(&deadline);
+            if (wait_msecs == 0)
+            {
+                ReturnCode = OS_ERROR_TIMEOUT;
+                break;
+            }
+        }
+
+        if (poll(&pfd, 1, wait_msecs) < 0)
+        {
+            if (errno != EINTR)
+            {
+                ReturnCode = OS_FS_ERROR;
+            }
+            continue;
+        }
+
+        if (pfd.revents == 0)
+        {
+            continue;
+        }
+
+        count = read(pipe_fds[0], buffer, sizeof(buffer));
+        if (count == 0)
+        {
+            /*
+            ** Every writer has closed the pipe, so the command is done
+            */
+            break;
+        }
+        if (count < 0)
+        {
+            if (errno != EINTR)
+            {
+                ReturnCode = OS_FS_ERROR;
+            }
+            continue;
+        }
+
+        if (max_bytes != 0 && count > (max_bytes - total))
+        {
+            count      = max_bytes - total;
+            ReturnCode = OS_ERR_OUTPUT_TRUNCATED;
+        }
+
+        for (done = 0; done < count; done += written)
+        {
+            written = write(OS_FDTable[OS_fd].OSfd, buffer + done, count - done);
+            if (written < 0)
+            {
+                if (errno != EINTR)
+                {
+                    ReturnCode = OS_FS_ERROR;
+                    break;
+                }
+                written = 0;
+            }
+        }
+
+        total += count;
+    }
+
+    close(pipe_fds[0]);
+
+    /*
+    ** The command may close its output and keep running, so the wait for
+    ** it to exit is bounded by the same deadline
+    */
+    if (ReturnCode == OS_FS_SUCCESS)
+    {
+        ReturnCode = OS_ShellWait(pid, (timeout_msecs != 0) ? &deadline : NULL);
+        if (ReturnCode != OS_ERROR_TIMEOUT)
+        {
+            return ReturnCode;
+        }
+    }
+
+    /*
+    ** Stop the shell and anything it started, then reap it
+    */
+    kill(-pid, SIGKILL);
+    OS_ShellWait(pid, NULL);
+
+    return ReturnCode;
+
+}/* end OS_ShellOutputToFileLimited */
+
+/* --------------------------------------------------------------------------------------
+Name: OS_FDGetInfo
+    
+Purpose: Copies the information of the given file descriptor into a structure passed in
+    
+Returns: OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+         OS_FS_SUCCESS if the copying was successfull
+ ---------------------------------------------------------------------------------------*/
+
+int32 OS_FDGetInfo (int32 filedes, OS_FDTableEntry *fd_prop)
+{
+
+    if (fd_prop == NULL)
+    {
+        return(OS_FS_ERR_INVALID_POINTER);
+    }
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+       (*(fd_prop)).IsValid = FALSE; 
+        return OS_FS_ERR_INVALID_FD;
+    }
+    else
+    { 
+        *fd_prop = OS_FDTable[filedes];
+        return OS_FS_SUCCESS;
+    }
+
+}/* end OS_FDGetInfo */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_FileOpenCheck
+    
+   Purpose: Checks to see if a file is open 
+    
+   Returns: OS_FS_ERROR if the file is not open 
+            OS_FS_SUCCESS if the file is open 
+ ---------------------------------------------------------------------------------------*/
+int32 OS_FileOpenCheck(char *Filename)
+{
+    if (Filename == NULL)
+    {
+        return(OS_FS_ERR_INVALID_POINTER);
+    }
+
+    if (OS_FDPathIsOpen(Filename))
+    {
+        return(OS_FS_SUCCESS);
+    }
+
+    return OS_FS_ERROR;
+
+}/* end OS_FileOpenCheck */
+
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_CloseFileByName
+
+   Purpose: Allows a file to be closed by name.
+            This will only work if the name passed in is the same name used to open 
+            the file.
+
+   Returns: OS_FS_ERR_PATH_INVALID if the file is not found 
+            OS_FS_ERROR   if the file close returned an error
+            OS_FS_SUCCESS if the file close suceeded  
+ ---------------------------------------------------------------------------------------*/
+int32 OS_CloseFileByName(char *Filename)
+{
+    int32     i;
+    int       status;
+    sigset_t  previous;
+    sigset_t  mask;
+
+    if (Filename == NULL)
+    {
+        return(OS_FS_ERR_INVALID_POINTER);
+    }
+
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+
+    i = OS_FDPathFind(Filename);
+    if (i >= 0)
+    {
+       /*
+       ** Close the file
+       */
+       status = close ((int) OS_FDTable[i].OSfd);
+
+       /*
+       ** Next, remove the file from the OSAL list
+       ** to free up that slot
+       */
+       OS_FDPathRemove(i);
+       OS_FDTable[i].OSfd =       -1;
+       strcpy(OS_FDTable[i].Path, "\0");
+       OS_FDTable[i].User =       0;
+       OS_FDTable[i].IsValid =    FALSE;
+       OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+       if (status == 0)
+       {
+          return(OS_FS_SUCCESS);
+       }
+       else
+       {
+          return(OS_FS_ERROR);
+       }
+    }
+
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+
+    return (OS_FS_ERR_PATH_INVALID);
+
+}/* end OS_CloseFileByName */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_CloseAllFiles
+
+   Purpose: Closes All open files that were opened through the OSAL 
+
+   Returns: OS_FS_ERROR   if one or more file close returned an error
+            OS_FS_SUCCESS if the files were all closed without error
+ ---------------------------------------------------------------------------------------*/
+int32 OS_CloseAllFiles(void)
+{
+    uint32    i;
+    int32     return_status = OS_FS_SUCCESS;
+    int       status;
+    sigset_t  previous;
+    sigset_t  mask;
+    
+    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+
+    for ( i = 0; i < OS_MAX_NUM_OPEN_FILES; i++)
+    {
+        if ( OS_FDTable[i].IsValid == TRUE )
+        {
+           /*
+           ** Close the file
+           */
+           status = close ((int) OS_FDTable[i].OSfd);
+
+           /*
+           ** Next, remove the file from the OSAL list
+           ** to free up that slot
+           */
+           OS_FDPathRemove(i);
+           OS_FDTable[i].OSfd =       -1;
+           strcpy(OS_FDTable[i].Path, "\0");
+           OS_FDTable[i].User =       0;
+           OS_FDTable[i].IsValid =    FALSE;
+           if (status == ERROR)
+           {
+              return_status = OS_FS_ERROR;
+           }
+        }
+
+    }/* end for */
+
+    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+    return (return_status);
+
+}/* end OS_CloseAllFiles */
+
+/****************************************************************************************
+                                  ASYNCHRONOUS I/O
+****************************************************************************************/
+
+#ifdef OS_ASYNC_IO_URING
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_AsyncRingClose
+
+   Purpose: Unmaps the rings of the io_uring instance of a queue and closes it
+ ---------------------------------------------------------------------------------------*/
+static void OS_AsyncRingClose(OS_async_queue_record_t *queue)
+{
+    if (queue->sqes != NULL && queue->sqes != MAP_FAILED)
+    {
+        munmap(queue->sqes, queue->sqes_size);
+    }
+    if (queue->cq_map != NULL && queue->cq_map != MAP_FAILED && queue->cq_map != queue->sq_map)
+    {
+        munmap(queue->cq_map, queue->cq_map_size);
+    }
+    if (queue->sq_map != NULL && queue->sq_map != MAP_FAILED)
+    {
+        munmap(queue->sq_map, queue->sq_map_size);
+    }
+    if (queue->ring_fd >= 0)
+    {
+        close(queue->ring_fd);
+    }
+    if (queue->wake_fd >= 0)
+    {
+        close(queue->wake_fd);
+    }
+
+    queue->ring_fd = -1;
+    queue->wake_fd = -1;
+    queue->sq_map  = NULL;
+    queue->cq_map  = NULL;
+    queue->sqes    = NULL;
+
+}/* end OS_AsyncRingClose */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_AsyncRingSetup
+
+   Purpose: Creates an io_uring instance for a queue and maps its rings. The
+            completion ring is twice the depth of the queue, so with at most
+            OS_ASYNC_QUEUE_DEPTH requests outstanding it can never overflow.
+
+   Returns: OS_FS_SUCCESS if the queue can use io_uring
+            OS_FS_ERROR if the kernel does not support it (or is older than 5.6)
+ ---------------------------------------------------------------------------------------*/
+static int32 OS_AsyncRingSetup(OS_async_queue_record_t *queue)
+{
+    struct io_uring_params params;
+    int                    fd;
+
+    memset(&params, 0, sizeof(params));
+    fd = syscall(__NR_io_uring_setup, OS_ASYNC_QUEUE_DEPTH, &params);
+    if (fd < 0)
+    {
+        return OS_FS_ERROR;
+    }
+
+    queue->ring_fd = fd;
+
+    if ((params.features & IORING_FEAT_RW_CUR_POS) == 0)
+    {
+        /* No IORING_OP_READ/WRITE in this kernel */
+        OS_AsyncRingClose(queue);
+        return OS_FS_ERROR;
+    }
+
+    queue->sq_map_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    queue->cq_map_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    queue->sqes_size   = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (queue->cq_map_size > queue->sq_map_size)
+        {
+            queue->sq_map_size = queue->cq_map_size;
+        }
+        queue->cq_map_size = queue->sq_map_size;
+    }
+
+    queue->sq_map = mmap(NULL, queue->sq_map_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        queue->cq_map = queue->sq_map;
+    }
+    else
+    {
+        queue->cq_map = mmap(NULL, queue->cq_map_size, PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    }
+    queue->sqes = mmap(NULL, queue->sqes_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+
+    if (queue->sq_map == MAP_FAILED || queue->cq_map == MAP_FAILED || queue->sqes == MAP_FAILED)
+    {
+        OS_AsyncRingClose(queue);
+        return OS_FS_ERROR;
+    }
+
+    queue->sq_head  = (unsigned *)((char *)queue->sq_map + params.sq_off.head);
+    queue->sq_tail  = (unsigned *)((char *)queue->sq_map + params.sq_off.tail);
+    queue->sq_mask  = (unsigned *)((char *)queue->sq_map + params.sq_off.ring_mask);
+    queue->sq_array = (unsigned *)((char *)queue->sq_map + params.sq_off.array);
+    queue->cq_head  = (unsigned *)((char *)queue->cq_map + params.cq_off.head);
+    queue->cq_tail  = (unsigned *)((char *)queue->cq_map + params.cq_off.tail);
+    queue->cq_mask  = (unsigned *)((char *)queue->cq_map + params.cq_off.ring_mask);
+    queue->cqes     = (struct io_uring_cqe *)((char *)queue->cq_map + params.cq_off.cqes);
+
+    queue->wake_fd = eventfd(0, EFD_CLOEXEC);
+    if (queue->wake_fd < 0)
+    {
+        OS_AsyncRingClose(queue);
+        return OS_FS_ERROR;
+    }
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_AsyncRingSetup */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_AsyncRingSubmit
+
+   Purpose: Puts a request on the submission ring and hands it to the kernel.
+            Called with the queue locked.
+
+   Returns: OS_FS_SUCCESS if the kernel took the request
+            OS_FS_ERROR otherwise
+ ---------------------------------------------------------------------------------------*/
+static int32 OS_AsyncRingSubmit(OS_async_queue_record_t *queue, const OS_async_request_t *request)
+{
+    struct io_uring_sqe *sqe;
+    unsigned             tail;
+    unsigned             index;
+    int                  ret;
+
+    tail  = *queue->sq_tail;
+    index = tail & *queue->sq_mask;
+    sqe   = &queue->sqes[index];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->fd        = request->fd;
+    sqe->user_data = (cpuaddr)request->user_data;
+
+    switch (request->opcode)
+    {
+        case OS_ASYNC_OP_READ:
+            sqe->opcode = IORING_OP_READ;
+            break;
+        case OS_ASYNC_OP_WRITE:
+            sqe->opcode = IORING_OP_WRITE;
+            break;
+        default:
+            sqe->opcode = IORING_OP_FSYNC;
+            break;
+    }
+
+    if (request->opcode != OS_ASYNC_OP_FSYNC)
+    {
+        sqe->addr = (cpuaddr)request->buffer;
+        sqe->len  = request->nbytes;
+        sqe->off  = request->offset;
+    }
+
+    queue->sq_array[index] = index;
+    __atomic_store_n(queue->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+    do
+    {
+        ret = syscall(__NR_io_uring_enter, queue->ring_fd, 1, 0, 0, NULL, 0);
+    } while (ret < 0 && errno == EINTR);
+
+    if (ret != 1)
+    {
+        /*
+        ** The kernel did not consume the entry, so take it back
+        */
+        if (__atomic_load_n(queue->sq_head, __ATOMIC_ACQUIRE) == tail)
+        {
+            __atomic_store_n(queue->sq_tail, tail, __ATOMIC_RELEASE);
+        }
+        return OS_FS_ERROR;
+    }
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_AsyncRingSubmit */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_AsyncRingReap
+
+   Purpose: Takes the next entry off the completion ring. Called with the
+            queue locked.
+
+   Returns: TRUE if there was a completion, FALSE if the ring was empty
+ ---------------------------------------------------------------------------------------*/
+static int OS_AsyncRingReap(OS_async_queue_record_t *queue, OS_async_completion_t *completion)
+{
+    struct io_uring_cqe *cqe;
+    unsigned             head;
+
+    head = *queue->cq_head;
+    if (head == __atomic_load_n(queue->cq_tail, __ATOMIC_ACQUIRE))
+    {
+        return FALSE;
+    }
+
+    cqe = &queue->cqes[head & *queue->cq_mask];
+    completion->user_data = (void *)(cpuaddr)cqe->user_data;
+    completion->result    = (cqe->res < 0) ? OS_FS_ERROR : cqe->res;
+
+    __atomic_store_n(queue->cq_head, head + 1, __ATOMIC_RELEASE);
+
+    return TRUE;
+
+}/* end OS_AsyncRingReap */
+
+#endif /* OS_ASYNC_IO_URING */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_AsyncWorker
+
+   Purpose: Thread that runs the requests of a queue without io_uring. It exits
+            once the queue is shutting down and no requests are left.
+ ---------------------------------------------------------------------------------------*/
+static void *OS_AsyncWorker(void *arg)
+{
+    OS_async_queue_record_t *queue;
+    OS_async_request_t       request;
+    OS_async_completion_t   *completion;
+    sigset_t                 mask;
+    ssize_t                  result;
+
+    queue = &OS_async_queue_table[(cpuaddr)arg];
+
+    /* Signals are for the OSAL tasks */
+    sigfillset(&mask);
+    pthread_sigmask(SIG_SETMASK, &mask, NULL);
+
+    pthread_mutex_lock(&queue->lock);
+
+    while (TRUE)
+    {
+        while (queue->pending_count == 0 && !queue->shutdown)
+        {
+            pthread_cond_wait(&queue->work_cv, &queue->lock);
+        }
+
+        if (queue->pending_count == 0)
+        {
+            break;
+        }
+
+        request = queue->pending[queue->pending_head];
+        queue->pending_head = (queue->pending_head + 1) % OS_ASYNC_QUEUE_DEPTH;
+        --queue->pending_count;
+
+        pthread_mutex_unlock(&queue->lock);
+
+        switch (request.opcode)
+        {
+            case OS_ASYNC_OP_READ:
+                result = pread64(request.fd, request.buffer, request.nbytes, (off64_t)request.offset);
+                break;
+            case OS_ASYNC_OP_WRITE:
+                result = pwrite64(request.fd, request.buffer, request.nbytes, (off64_t)request.offset);
+                break;
+            default:
+                result = fsync(request.fd);
+                break;
+        }
+
+        pthread_mutex_lock(&queue->lock);
+
+        completion = &queue->done[(queue->done_head + queue->done_count) % OS_ASYNC_QUEUE_DEPTH];
+        completion->user_data = request.user_data;
+        completion->result    = (result < 0) ? OS_FS_ERROR : (int32)result;
+        ++queue->done_count;
+
+        pthread_cond_signal(&queue->done_cv);
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return NULL;
+
+}/* end OS_AsyncWorker */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_AsyncStopWorkers
+
+   Purpose: Lets the workers of a queue finish the requests they have and waits
+            for them to exit
+ ---------------------------------------------------------------------------------------*/
+static void OS_AsyncStopWorkers(OS_async_queue_record_t *queue)
+{
+    uint32 i;
+
+    pthread_mutex_lock(&queue->lock);
+    queue->shutdown = TRUE;
+    pthread_cond_broadcast(&queue->work_cv);
+    pthread_mutex_unlock(&queue->lock);
+
+    for (i = 0; i < queue->num_workers; i++)
+    {
+        pthread_join(queue->workers[i], NULL);
+    }
+
+    queue->num_workers = 0;
+
+}/* end OS_AsyncStopWorkers */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_AsyncQueueCreate
+
+   Purpose: Creates a queue that asynchronous read, write and fsync requests are
+            submitted to and that OS_AsyncWait returns their results from. The queue
+            is backed by an io_uring instance when the kernel supports it, otherwise
+            (or with the OS_ASYNC_WORKER_POOL flag) by OS_ASYNC_WORKERS threads.
+
+   Returns: OS_FS_ERR_INVALID_POINTER if queue_id or queue_name are NULL
+            OS_ERR_NAME_TOO_LONG if the name is too long to be stored
+            OS_ERR_NO_FREE_IDS if there are no more free queue Ids
+            OS_ERR_NAME_TAKEN if there is already a queue with the same name
+            OS_FS_ERROR if neither io_uring nor the worker threads could be started
+            OS_FS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+int32 OS_AsyncQueueCreate (uint32 *queue_id, const char *queue_name, uint32 flags)
+{
+    OS_async_queue_record_t *queue;
+    uint32                   possible_id;
+    uint32                   i;
+    sigset_t                 previous;
+    sigset_t                 mask;
+
+    if (queue_id == NULL || queue_name == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    if (strlen(queue_name) >= OS_MAX_API_NAME)
+    {
+        return OS_ERR_NAME_TOO_LONG;
+    }
+
+    OS_InterruptSafeLock(&OS_async_queue_table_mut, &mask, &previous);
+
+    for (possible_id = 0; possible_id < OS_MAX_ASYNC_QUEUES; possible_id++)
+    {
+        if (OS_async_queue_table[possible_id].free == TRUE)
+            break;
+    }
+
+    if (possible_id == OS_MAX_ASYNC_QUEUES)
+    {
+        OS_InterruptSafeUnlock(&OS_async_queue_table_mut, &previous);
+        return OS_ERR_NO_FREE_IDS;
+    }
+
+    for (i = 0; i < OS_MAX_ASYNC_QUEUES; i++)
+    {
+        if ((OS_async_queue_table[i].free == FALSE) &&
+                strcmp ((char*) queue_name, OS_async_queue_table[i].name) == 0)
+        {
+            OS_InterruptSafeUnlock(&OS_async_queue_table_mut, &previous);
+            return OS_ERR_NAME_TAKEN;
+        }
+    }
+
+    queue = &OS_async_queue_table[possible_id];
+
+    queue->outstanding   = 0;
+    queue->shutdown      = FALSE;
+    queue->deleting      = FALSE;
+    queue->waiters       = 0;
+    queue->pending_head  = 0;
+    queue->pending_count = 0;
+    queue->done_head     = 0;
+    queue->done_count    = 0;
+    queue->num_workers   = 0;
+
+#ifdef OS_ASYNC_IO_URING
+    queue->ring_fd = -1;
+    queue->wake_fd = -1;
+    if ((flags & OS_ASYNC_WORKER_POOL) == 0)
+    {
+        OS_AsyncRingSetup(queue);
+    }
+
+    if (queue->ring_fd < 0)
+#endif
+    {
+        /*
+        ** The workers inherit the signal mask blocked by the table lock
+        */
+        for (i = 0; i < OS_ASYNC_WORKERS; i++)
+        {
+            if (pthread_create(&queue->workers[i], NULL, OS_AsyncWorker, (void *)(cpuaddr)possible_id) != 0)
+            {
+                break;
+            }
+            ++queue->num_workers;
+        }
+
+        if (queue->num_workers == 0)
+        {
+            OS_InterruptSafeUnlock(&OS_async_queue_table_mut, &previous);
+            return OS_FS_ERROR;
+        }
+    }
+
+    pthread_mutex_lock(&queue->lock);
+    queue->creator = OS_FindCreator();
+    strcpy(queue->name, (char*) queue_name);
+    queue->free = FALSE;
+    pthread_mutex_unlock(&queue->lock);
+
+    OS_InterruptSafeUnlock(&OS_async_queue_table_mut, &previous);
+
+    *queue_id = possible_id;
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_AsyncQueueCreate */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_AsyncQueueDelete
+
+   Purpose: Waits for every request submitted to the queue to finish, then deletes
+            it. Results not yet collected with OS_AsyncWait are dropped. Tasks
+            waiting in OS_AsyncWait are woken up and get OS_ERR_INVALID_ID, and the
+            queue is only torn down once they have all left.
+
+   Returns: OS_ERR_INVALID_ID if the id passed in is not a valid queue
+            OS_FS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+int32 OS_AsyncQueueDelete (uint32 queue_id)
+{
+    OS_async_queue_record_t *queue;
+    sigset_t                 previous;
+    sigset_t                 mask;
+#ifdef OS_ASYNC_IO_URING
+    unsigned                 ready;
+#endif
+
+    if (queue_id >= OS_MAX_ASYNC_QUEUES)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    queue = &OS_async_queue_table[queue_id];
+
+    pthread_mutex_lock(&queue->lock);
+    if (queue->free == TRUE || queue->deleting == TRUE)
+    {
+        pthread_mutex_unlock(&queue->lock);
+        return OS_ERR_INVALID_ID;
+    }
+
+    /*
+    ** From here on nothing new is submitted. Wake up the waiters, and wait
+    ** for them to leave before the ring they may be polling goes away.
+    */
+    queue->deleting = TRUE;
+    pthread_cond_broadcast(&queue->done_cv);
+#ifdef OS_ASYNC_IO_URING
+    if (queue->wake_fd >= 0)
+    {
+        eventfd_write(queue->wake_fd, 1);
+    }
+#endif
+    while (queue->waiters > 0)
+    {
+        pthread_cond_wait(&queue->done_cv, &queue->lock);
+    }
+
+#ifdef OS_ASYNC_IO_URING
+    if (queue->ring_fd >= 0)
+    {
+        /*
+        ** The buffers of the outstanding requests belong to the caller, so
+        ** wait until the kernel is done with all of them
+        */
+        ready = __atomic_load_n(queue->cq_tail, __ATOMIC_ACQUIRE) - *queue->cq_head;
+        if (ready < queue->outstanding)
+        {
+            while (syscall(__NR_io_uring_enter, queue->ring_fd, 0, queue->outstanding,
+                           IORING_ENTER_GETEVENTS, NULL, 0) < 0 && errno == EINTR)
+            {
+            }
+        }
+        OS_AsyncRingClose(queue);
+        pthread_mutex_unlock(&queue->lock);
+    }
+    else
+#endif
+    {
+        pthread_mutex_unlock(&queue->lock);
+        OS_AsyncStopWorkers(queue);
+    }
+
+    OS_InterruptSafeLock(&OS_async_queue_table_mut, &mask, &previous);
+    pthread_mutex_lock(&queue->lock);
+
+    queue->free        = TRUE;
+    queue->deleting    = FALSE;
+    queue->creator     = 0;
+    queue->outstanding = 0;
+    queue->done_count  = 0;
+    strcpy(queue->name, "");
+
+    pthread_mutex_unlock(&queue->lock);
+    OS_InterruptSafeUnlock(&OS_async_queue_table_mut, &previous);
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_AsyncQueueDelete */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_AsyncSubmit
+
+   Purpose: Common code of OS_AsyncRead, OS_AsyncWrite and OS_AsyncFsync
+
+   Returns: see OS_AsyncRead
+ ---------------------------------------------------------------------------------------*/
+static int32 OS_AsyncSubmit(uint32 queue_id, uint32 opcode, int32 filedes, void *buffer,
+                            uint32 nbytes, int64 offset, void *user_data)
+{
+    OS_async_queue_record_t *queue;
+    OS_async_request_t       request;
+    int32                    status;
+
+    if (queue_id >= OS_MAX_ASYNC_QUEUES)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    if (opcode != OS_ASYNC_OP_FSYNC && buffer == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    request.opcode    = opcode;
+    request.fd        = OS_FDTable[filedes].OSfd;
+    request.buffer    = buffer;
+    request.nbytes    = nbytes;
+    request.offset    = offset;
+    request.user_data = user_data;
+
+    queue = &OS_async_queue_table[queue_id];
+
+    pthread_mutex_lock(&queue->lock);
+
+    if (queue->free == TRUE || queue->deleting == TRUE)
+    {
+        pthread_mutex_unlock(&queue->lock);
+        return OS_ERR_INVALID_ID;
+    }
+
+    if (queue->outstanding >= OS_ASYNC_QUEUE_DEPTH)
+    {
+        pthread_mutex_unlock(&queue->lock);
+        return OS_QUEUE_FULL;
+    }
+
+#ifdef OS_ASYNC_IO_URING
+    if (queue->ring_fd >= 0)
+    {
+        status = OS_AsyncRingSubmit(queue, &request);
+    }
+    else
+#endif
+    {
+        queue->pending[(queue->pending_head + queue->pending_count) % OS_ASYNC_QUEUE_DEPTH] = request;
+        ++queue->pending_count;
+        pthread_cond_signal(&queue->work_cv);
+        status = OS_FS_SUCCESS;
+    }
+
+    if (status == OS_FS_SUCCESS)
+    {
+        ++queue->outstanding;
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return status;
+
+}/* end OS_AsyncSubmit */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_AsyncRead
+
+   Purpose: Starts reading up to nbytes from the file at offset into buffer. The
+            buffer must stay valid until OS_AsyncWait returns the completion
+            carrying user_data.
+
+   Returns: OS_ERR_INVALID_ID if the id passed in is not a valid queue
+            OS_FS_ERR_INVALID_POINTER if buffer is NULL
+            OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+            OS_QUEUE_FULL if OS_ASYNC_QUEUE_DEPTH requests are already outstanding
+            OS_FS_ERROR if the request could not be submitted
+            OS_FS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+int32 OS_AsyncRead (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                    int64 offset, void *user_data)
+{
+    return OS_AsyncSubmit(queue_id, OS_ASYNC_OP_READ, filedes, buffer, nbytes, offset, user_data);
+
+}/* end OS_AsyncRead */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_AsyncWrite
+
+   Purpose: Starts writing nbytes of buffer to the file at offset. The buffer must
+            stay valid until OS_AsyncWait returns the completion carrying user_data.
+            Requests on a queue may complete in any order.
+
+   Returns: see OS_AsyncRead
+ ---------------------------------------------------------------------------------------*/
+int32 OS_AsyncWrite (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                     int64 offset, void *user_data)
+{
+    return OS_AsyncSubmit(queue_id, OS_ASYNC_OP_WRITE, filedes, buffer, nbytes, offset, user_data);
+
+}/* end OS_AsyncWrite */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_AsyncFsync
+
+   Purpose: Starts flushing the file to its device. It is not ordered against other
+            requests on the queue: wait for the writes it should cover first.
+
+   Returns: see OS_AsyncRead
+ ---------------------------------------------------------------------------------------*/
+int32 OS_AsyncFsync (uint32 queue_id, int32 filedes, void *user_data)
+{
+    return OS_AsyncSubmit(queue_id, OS_ASYNC_OP_FSYNC, filedes, NULL, 0, 0, user_data);
+
+}/* end OS_AsyncFsync */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_AsyncWait
+
+   Purpose: Passes back the next finished request of the queue. msecs may be
+            OS_PEND to wait as long as it takes, OS_CHECK to not wait, or a time
+            in milliseconds.
+
+   Returns: OS_FS_ERR_INVALID_POINTER if completion is NULL
+            OS_ERR_INVALID_ID if the id passed in is not a valid queue, or the
+            queue is deleted while waiting
+            OS_ERROR_TIMEOUT if no request finished in time
+            OS_FS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+int32 OS_AsyncWait (uint32 queue_id, OS_async_completion_t *completion, int32 msecs)
+{
+    OS_async_queue_record_t *queue;
+    struct timespec          deadline;
+    struct timespec          now;
+    int32                    status;
+    int                      found;
+#ifdef OS_ASYNC_IO_URING
+    struct pollfd            pfd[2];
+    int64                    wait_msecs;
+#endif
+
+    if (completion == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    if (queue_id >= OS_MAX_ASYNC_QUEUES)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    if (msecs > 0)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec  += msecs / 1000;
+        deadline.tv_nsec += (msecs % 1000) * 1000000;
+        if (deadline.tv_nsec >= 1000000000)
+        {
+            deadline.tv_nsec -= 1000000000;
+            ++deadline.tv_sec;
+        }
+    }
+
+    queue = &OS_async_queue_table[queue_id];
+
+    pthread_mutex_lock(&queue->lock);
+
+    if (queue->free == TRUE || queue->deleting == TRUE)
+    {
+        pthread_mutex_unlock(&queue->lock);
+        return OS_ERR_INVALID_ID;
+    }
+
+    ++queue->waiters;
+    status = OS_ERROR_TIMEOUT;
+
+    while (TRUE)
+    {
+        if (queue->deleting == TRUE)
+        {
+            status = OS_ERR_INVALID_ID;
+            break;
+        }
+
+#ifdef OS_ASYNC_IO_URING
+        if (queue->ring_fd >= 0)
+        {
+            found = OS_AsyncRingReap(queue, completion);
+        }
+        else
+#endif
+        {
+            found = (queue->done_count > 0);
+            if (found)
+            {
+                *completion = queue->done[queue->done_head];
+                queue->done_head = (queue->done_head + 1) % OS_ASYNC_QUEUE_DEPTH;
+                --queue->done_count;
+            }
+        }
+
+        if (found)
+        {
+            --queue->outstanding;
+            status = OS_FS_SUCCESS;
+            break;
+        }
+
+        if (msecs == OS_CHECK)
+        {
+            break;
+        }
+
+        if (msecs > 0)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            if (now.tv_sec > deadline.tv_sec ||
+               (now.tv_sec == deadline.tv_sec && now.tv_nsec >= deadline.tv_nsec))
+            {
+                break;
+            }
+        }
+
+#ifdef OS_ASYNC_IO_URING
+        if (queue->ring_fd >= 0)
+        {
+            /*
+            ** The ring fd polls readable while completions are waiting, and
+            ** the wake fd once the queue is being deleted. Both stay open
+            ** until this task has left, as it is counted in waiters.
+            */
+            wait_msecs = -1;
+            if (msecs > 0)
+            {
+                wait_msecs = ((int64)(deadline.tv_sec - now.tv_sec) * 1000) +
+                             ((deadline.tv_nsec - now.tv_nsec) / 1000000) + 1;
+                if (wait_msecs > 0x7FFFFFFF)
+                {
+                    wait_msecs = 0x7FFFFFFF;
+                }
+            }
+
+            pfd[0].fd     = queue->ring_fd;
+            pfd[0].events = POLLIN;
+            pfd[1].fd     = queue->wake_fd;
+            pfd[1].events = POLLIN;
+
+            pthread_mutex_unlock(&queue->lock);
+            poll(pfd, 2, (int)wait_msecs);
+            pthread_mutex_lock(&queue->lock);
+        }
+        else
+#endif
+        if (msecs > 0)
+        {
+            pthread_cond_timedwait(&queue->done_cv, &queue->lock, &deadline);
+        }
+        else
+        {
+            pthread_cond_wait(&queue->done_cv, &queue->lock);
+        }
+    }
+
+    --queue->waiters;
+    if (queue->deleting == TRUE && queue->waiters == 0)
+    {
+        /* OS_AsyncQueueDelete waits for the last waiter to leave */
+        pthread_cond_broadcast(&queue->done_cv);
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return status;
+
+}/* end OS_AsyncWait */
+
+/****************************************************************************************
+                                 MEMORY-MAPPED FILES
+****************************************************************************************/
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_MapAlign
+
+   Purpose: Widens a range to the page boundaries that mmap and its friends need.
+            OS_mmap hands out addresses that may be inside a page when the file
+            offset was not page aligned, so the other calls align them back down.
+ ---------------------------------------------------------------------------------------*/
+static void OS_MapAlign(void *addr, uint32 length, void **base, size_t *span)
+{
+    cpuaddr page_size = (cpuaddr)sysconf(_SC_PAGESIZE);
+    cpuaddr start     = (cpuaddr)addr & ~(page_size - 1);
+
+    *base = (void *)start;
+    *span = ((cpuaddr)addr - start) + length;
+
+}/* end OS_MapAlign */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_MapFd
+
+   Purpose: Maps length bytes of a host file descriptor, starting at offset
+
+   Returns: OS_FS_ERROR if the access mode is not supported or the OS call failed
+            OS_FS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+static int32 OS_MapFd(int fd, int64 offset, uint32 length, int32 access, void **addr)
+{
+    long   page_size = sysconf(_SC_PAGESIZE);
+    int64  delta;
+    int    prot;
+    void  *base;
+
+    switch(access)
+    {
+        case OS_READ_ONLY:
+            prot = PROT_READ;
+            break;
+        case OS_READ_WRITE:
+            prot = PROT_READ | PROT_WRITE;
+            break;
+        default:
+            /* a mapping always needs the file to be readable */
+            return OS_FS_ERROR;
+    }
+
+    /*
+    ** mmap only takes page aligned offsets, so map from the start of the
+    ** page and return a pointer to the byte that was asked for
+    */
+    delta = offset % page_size;
+
+    base = mmap64(NULL, (size_t)(length + delta), prot, MAP_SHARED, fd, (off64_t)(offset - delta));
+    if (base == MAP_FAILED)
+    {
+        return OS_FS_ERROR;
+    }
+
+    *addr = (char *)base + delta;
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_MapFd */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_mmap
+
+    Purpose: maps length bytes of the file described by filedes, starting at offset,
+             into memory and returns their address in addr. The file can be closed
+             while the mapping is in use. OS_READ_ONLY gives a read-only mapping,
+             OS_READ_WRITE a shared one whose stores reach the file; the file must
+             have been opened with OS_READ_WRITE for the latter.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if addr is NULL
+             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+             OS_FS_ERROR if the length, offset or access mode is invalid, or the
+             OS call failed
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_mmap (int32 filedes, int64 offset, uint32 length, int32 access, void **addr)
+{
+    if (addr == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
+
+    if (length == 0 || offset < 0)
+    {
+        return OS_FS_ERROR;
+    }
+
+    return OS_MapFd(OS_FDTable[filedes].OSfd, offset, length, access, addr);
+
+}/* end OS_mmap */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_mmapFile
+
+    Purpose: maps the whole file given by path into memory and returns its address
+             in addr and its size in length. No OSAL file descriptor is used.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if a pointer passed in is NULL
+             OS_FS_ERR_PATH_TOO_LONG if path is too long
+             OS_FS_ERR_NAME_TOO_LONG if the name of the file is too long
+             OS_FS_ERR_PATH_INVALID if path cannot be parsed
+             OS_FS_ERROR if the file is empty, too big to map or cannot be opened,
+             the access mode is invalid or the OS call failed
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_mmapFile (const char *path, int32 access, void **addr, uint32 *length)
 {
-    int status,i;
-    char old_path[OS_MAX_LOCAL_PATH_LEN];
-    char new_path[OS_MAX_LOCAL_PATH_LEN];
+    char          local_path[OS_MAX_LOCAL_PATH_LEN];
+    struct stat64 st;
+    int           fd;
+    int32         status;
 
-    /*
-    ** Check to see if the path pointers are NULL
-    */    
-    if (old == NULL || new == NULL)
+    if (path == NULL || addr == NULL || length == NULL)
+    {
         return OS_FS_ERR_INVALID_POINTER;
+    }
 
-    /*
-    ** Check to see if the paths are too long
-    */
-    if (strlen(old) >= OS_MAX_PATH_LEN)
-        return OS_FS_ERR_PATH_TOO_LONG;
-    
-    if (strlen(new) >= OS_MAX_PATH_LEN)
+    if (strlen(path) >= OS_MAX_PATH_LEN)
+    {
         return OS_FS_ERR_PATH_TOO_LONG;
+    }
 
-    /* 
-    ** check if the names of the files are too long 
-    */
-    if (OS_check_name_length(old) != OS_FS_SUCCESS)
-        return OS_FS_ERR_NAME_TOO_LONG;
-
-    if (OS_check_name_length(new) != OS_FS_SUCCESS)
+    if (OS_check_name_length(path) != OS_FS_SUCCESS)
+    {
         return OS_FS_ERR_NAME_TOO_LONG;
+    }
 
-
-    /*
-    ** Translate the path
-    */
-    if ( OS_TranslatePath(old, (char *)old_path) != OS_FS_SUCCESS )
+    if (OS_TranslatePath(path, (char *)local_path) != OS_FS_SUCCESS)
     {
         return OS_FS_ERR_PATH_INVALID;
     }
 
-    /*
-    ** Translate the path
-    */
-    if ( OS_TranslatePath(new, (char *)new_path) != OS_FS_SUCCESS )
+    fd = open(local_path, (access == OS_READ_WRITE ? O_RDWR : O_RDONLY) | O_CLOEXEC);
+    if (fd < 0)
     {
-        return OS_FS_ERR_PATH_INVALID;
+        return OS_FS_ERROR;
     }
-     
-    status = rename (old_path, new_path);
-    if (status == 0)
+
+    status = OS_FS_ERROR;
+    if (fstat64(fd, &st) == 0 && st.st_size > 0 && st.st_size <= 0xFFFFFFFF)
     {
-        for ( i =0; i < OS_MAX_NUM_OPEN_FILES; i++) 
+        status = OS_MapFd(fd, 0, (uint32)st.st_size, access, addr);
+        if (status == OS_FS_SUCCESS)
         {
-            if (strcmp(OS_FDTable[i].Path, old) == 0 &&
-                OS_FDTable[i].IsValid == TRUE)
-            {
-                strncpy (OS_FDTable[i].Path, new, OS_MAX_PATH_LEN);  
-            } 
+            *length = (uint32)st.st_size;
         }
-        return OS_FS_SUCCESS;
     }
-    else
+
+    /* the mapping keeps its own reference to the file */
+    close(fd);
+
+    return status;
+
+}/* end OS_mmapFile */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_munmap
+
+    Purpose: unmaps memory returned by OS_mmap or OS_mmapFile. addr and length must
+             be the ones the mapping was created with.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if addr is NULL
+             OS_FS_ERROR if the OS call failed
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_munmap (void *addr, uint32 length)
+{
+    void   *base;
+    size_t  span;
+
+    if (addr == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
+
+    OS_MapAlign(addr, length, &base, &span);
+
+    if (munmap(base, span) != 0)
     {
         return OS_FS_ERROR;
     }
-     
-}/*end OS_rename */
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_munmap */
 
 /*--------------------------------------------------------------------------------------
-    Name: OS_cp
-    
-    Purpose: Copies a single file from src to dest
+    Name: OS_msync
 
-    Returns: OS_FS_SUCCESS if the operation worked
-             OS_FS_ERROR if the file could not be accessed
-             OS_FS_ERR_INVALID_POINTER if src or dest are NULL
-             OS_FS_ERR_PATH_INVALID if path cannot be parsed
-             OS_FS_ERR_PATH_TOO_LONG if the paths given are too long to be stored locally
-             OS_FS_ERR_NAME_TOO_LONG if the dest name is too long to be stored locally
+    Purpose: writes the modified pages of a shared mapping in the given range back
+             to the file, and waits for the writes to finish
 
+    Returns: OS_FS_ERR_INVALID_POINTER if addr is NULL
+             OS_FS_ERROR if the range is not mapped or the OS call failed
+             OS_FS_SUCCESS if success
 ---------------------------------------------------------------------------------------*/
 
-int32 OS_cp (const char *src, const char *dest)
+int32 OS_msync (void *addr, uint32 length)
 {
-    int  i;
-    int  status;
-    char src_path[OS_MAX_LOCAL_PATH_LEN];
-    char dest_path[OS_MAX_LOCAL_PATH_LEN];
+    void   *base;
+    size_t  span;
 
-    /* leave enough space for the two paths and the command */
-    char command [OS_MAX_PATH_LEN * 2 + 5];
-    
-    /*
-    ** Check to see if the path pointers are NULL
-    */    
-    if (src == NULL || dest == NULL)
+    if (addr == NULL)
     {
         return OS_FS_ERR_INVALID_POINTER;
     }
 
-    /*
-    ** Check to see if the paths are too long
-    */
-    if (strlen(src) >= OS_MAX_PATH_LEN)
+    OS_MapAlign(addr, length, &base, &span);
+
+    if (msync(base, span, MS_SYNC) != 0)
     {
-        return OS_FS_ERR_PATH_TOO_LONG;
+        return OS_FS_ERROR;
     }
-    
-    if (strlen(dest) >= OS_MAX_PATH_LEN)
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_msync */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_madvise
+
+    Purpose: tells the kernel how the given range of a mapping is going to be
+             accessed, so it can read ahead or drop pages accordingly. advice is
+             one of the OS_MADV_ values. The call is only a hint.
+
+    Returns: OS_FS_ERR_INVALID_POINTER if addr is NULL
+             OS_FS_ERROR if advice is unknown, the range is not mapped or the OS
+             call failed
+             OS_FS_SUCCESS if success
+---------------------------------------------------------------------------------------*/
+
+int32 OS_madvise (void *addr, uint32 length, uint32 advice)
+{
+    void   *base;
+    size_t  span;
+    int     host_advice;
+
+    if (addr == NULL)
     {
-        return OS_FS_ERR_PATH_TOO_LONG;
+        return OS_FS_ERR_INVALID_POINTER;
     }
 
-    /* 
-    ** check if the names of the files are too long 
-    */
-    if (OS_check_name_length(src) != OS_FS_SUCCESS)
+    switch(advice)
     {
-        return OS_FS_ERR_NAME_TOO_LONG;
+        case OS_MADV_NORMAL:
+            host_advice = MADV_NORMAL;
+            break;
+        case OS_MADV_SEQUENTIAL:
+            host_advice = MADV_SEQUENTIAL;
+            break;
+        case OS_MADV_RANDOM:
+            host_advice = MADV_RANDOM;
+            break;
+        case OS_MADV_WILLNEED:
+            host_advice = MADV_WILLNEED;
+            break;
+        case OS_MADV_DONTNEED:
+            host_advice = MADV_DONTNEED;
+            break;
+        default:
+            return OS_FS_ERROR;
     }
 
-    if (OS_check_name_length(dest) != OS_FS_SUCCESS)
+    OS_MapAlign(addr, length, &base, &span);
+
+    if (madvise(base, span, host_advice) != 0)
     {
-        return OS_FS_ERR_NAME_TOO_LONG;
+        return OS_FS_ERROR;
     }
 
-    /*
-    ** Make sure the destintation file is not open by the OSAL before doing the copy 
-    ** This may be caught by the host OS call but it does not hurt to 
-    ** be consistent 
-    */
-    for ( i =0; i < OS_MAX_NUM_OPEN_FILES; i++)
+    return OS_FS_SUCCESS;
+
+}/* end OS_madvise */
+
+/****************************************************************************************
+                                  BUFFERED STREAMS
+****************************************************************************************/
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_StreamWriteOut
+
+   Purpose: Writes nbytes of buffer to the file of a stream, retrying short writes.
+            The number of bytes that made it is returned in written. With
+            OS_STREAM_SYNC the data is also synced to the device.
+
+   Returns: OS_FS_ERROR if the file could not be written
+            OS_FS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+static int32 OS_StreamWriteOut(OS_stream_record_t *stream, const char *buffer, uint32 nbytes,
+                               uint32 *written)
+{
+    int32 status;
+
+    *written = 0;
+    while (*written < nbytes)
     {
-        if ((OS_FDTable[i].IsValid == TRUE) &&
-           (strcmp(OS_FDTable[i].Path, dest) == 0))
+        status = OS_write(stream->filedes, (void *)(buffer + *written), nbytes - *written);
+        if (status <= 0)
         {
-           return OS_FS_ERROR;
+            return OS_FS_ERROR;
         }
+        *written += status;
     }
 
-    /*
-    ** Translate the path
-    */
-    if ( OS_TranslatePath(src, (char *)src_path) != OS_FS_SUCCESS )
+    if ((stream->flags & OS_STREAM_SYNC) != 0 &&
+        fdatasync(OS_FDTable[stream->filedes].OSfd) != 0)
     {
-        return OS_FS_ERR_PATH_INVALID;
+        return OS_FS_ERROR;
     }
 
-    /*
-    ** Translate the path
-    */
-    if ( OS_TranslatePath(dest, (char *)dest_path) != OS_FS_SUCCESS )
+    return OS_FS_SUCCESS;
+
+}/* end OS_StreamWriteOut */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_StreamDrain
+
+   Purpose: Writes the buffered data of a stream to its file. The caller holds the
+            stream lock. Whatever could not be written stays buffered.
+ ---------------------------------------------------------------------------------------*/
+static int32 OS_StreamDrain(OS_stream_record_t *stream)
+{
+    int32  status;
+    uint32 written;
+
+    if (stream->used == 0)
     {
-        return OS_FS_ERR_PATH_INVALID;
+        return OS_FS_SUCCESS;
     }
 
-    sprintf(command,"cp %s %s",src_path, dest_path);
-     
-     status = system(command);
-     if (status == 0)
-     {
-         return OS_FS_SUCCESS;
-     }
-     else
-     {
-         return OS_FS_ERROR;
-     }
-     
-}/*end OS_cp */
+    status = OS_StreamWriteOut(stream, stream->buffer, stream->used, &written);
 
-/*--------------------------------------------------------------------------------------
-    Name: OS_mv
-    
-    Purpose: moves a single file from src to dest
+    if (written < stream->used)
+    {
+        memmove(stream->buffer, stream->buffer + written, stream->used - written);
+    }
+    stream->used -= written;
 
-    Returns: OS_FS_SUCCESS if the rename works
-             OS_FS_ERROR if the file could not be opened or renamed.
-             OS_FS_ERR_INVALID_POINTER if src or dest are NULL
-             OS_FS_ERR_PATH_INVALID if path cannot be parsed
-             OS_FS_ERR_PATH_TOO_LONG if the paths given are too long to be stored locally
-             OS_FS_ERR_NAME_TOO_LONG if the dest name is too long to be stored locally
----------------------------------------------------------------------------------------*/
+    return status;
 
-int32 OS_mv (const char *src, const char *dest)
-{
-   int i;
-   int32 status;
+}/* end OS_StreamDrain */
 
-   /*
-   ** Validate the source and destination
-   ** These checks may seem redundant because OS_cp and OS_remove also do 
-   ** the same checks, but this call needs to abort before doing a copy
-   ** in some cases.
-   */
+/* --------------------------------------------------------------------------------------
+   Name: OS_StreamSetDeadline
 
-   /*
-   ** Check to see if the path pointers are NULL
-   */
-   if (src == NULL || dest == NULL)
-   {
-        return OS_FS_ERR_INVALID_POINTER;
-   }
+   Purpose: Sets the time at which the flusher writes out a stream to flush_msecs
+            from now. The caller holds the stream lock.
+ ---------------------------------------------------------------------------------------*/
+static void OS_StreamSetDeadline(OS_stream_record_t *stream)
+{
+    clock_gettime(CLOCK_MONOTONIC, &stream->flush_deadline);
+    stream->flush_deadline.tv_sec  += stream->flush_msecs / 1000;
+    stream->flush_deadline.tv_nsec += (stream->flush_msecs % 1000) * 1000000;
+    if (stream->flush_deadline.tv_nsec >= 1000000000)
+    {
+        stream->flush_deadline.tv_nsec -= 1000000000;
+        ++stream->flush_deadline.tv_sec;
+    }
 
-   /*
-   ** Check to see if the paths are too long
-   */
-   if (strlen(src) >= OS_MAX_PATH_LEN)
-   {
-       return OS_FS_ERR_PATH_TOO_LONG;
-   }
+}/* end OS_StreamSetDeadline */
 
-   if (strlen(dest) >= OS_MAX_PATH_LEN)
-   {
-       return OS_FS_ERR_PATH_TOO_LONG;
-   }
+/* --------------------------------------------------------------------------------------
+   Name: OS_StreamFlusher
 
-   /* 
-   ** check if the names of the files are too long 
-   */
-   if (OS_check_name_length(src) != OS_FS_SUCCESS)
-   {
-       return OS_FS_ERR_NAME_TOO_LONG;
-   }
+   Purpose: Thread that flushes the streams whose flush_msecs have passed since
+            their oldest buffered write. It is started by the first stream opened
+            with a flush time and stays around for the next ones.
+ ---------------------------------------------------------------------------------------*/
+static void *OS_StreamFlusher(void *arg)
+{
+    OS_stream_record_t *stream;
+    struct timespec     now;
+    struct timespec     next;
+    int                 have_next;
+    sigset_t            mask;
+    uint32              i;
 
-   if (OS_check_name_length(dest) != OS_FS_SUCCESS)
-   {
-       return OS_FS_ERR_NAME_TOO_LONG;
-   }
+    /* Signals are for the OSAL tasks */
+    sigfillset(&mask);
+    pthread_sigmask(SIG_SETMASK, &mask, NULL);
 
-   /*
-   ** Make sure the source file is not open by the OSAL before doing the move 
-   */
-   for ( i =0; i < OS_MAX_NUM_OPEN_FILES; i++)
-   {
-       if ((OS_FDTable[i].IsValid == TRUE) &&
-          (strcmp(OS_FDTable[i].Path, src) == 0))
-       {
-          return OS_FS_ERROR;
-       }
-   }
+    pthread_mutex_lock(&OS_stream_flush_mut);
 
-   status = OS_cp (src, dest);
-   if ( status == OS_FS_SUCCESS )
-   {
-      status = OS_remove(src);
-   }
+    while (TRUE)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        have_next = FALSE;
 
-   return ( status);
-}/*end OS_mv */
+        for (i = 0; i < OS_MAX_STREAMS; i++)
+        {
+            stream = &OS_stream_table[i];
 
-/*
-** Directory API 
-*/
-/*--------------------------------------------------------------------------------------
-    Name: OS_mkdir
+            pthread_mutex_lock(&stream->lock);
+            if (stream->free == FALSE && stream->used > 0 && stream->flush_msecs > 0)
+            {
+                if (now.tv_sec > stream->flush_deadline.tv_sec ||
+                   (now.tv_sec == stream->flush_deadline.tv_sec &&
+                    now.tv_nsec >= stream->flush_deadline.tv_nsec))
+                {
+                    OS_StreamDrain(stream);
+
+                    /* Whatever could not be written is tried again flush_msecs later */
+                    if (stream->used > 0)
+                    {
+                        OS_StreamSetDeadline(stream);
+                    }
+                }
+
+                if (stream->used > 0 &&
+                   (!have_next || stream->flush_deadline.tv_sec < next.tv_sec ||
+                   (stream->flush_deadline.tv_sec == next.tv_sec &&
+                    stream->flush_deadline.tv_nsec < next.tv_nsec)))
+                {
+                    next      = stream->flush_deadline;
+                    have_next = TRUE;
+                }
+            }
+            pthread_mutex_unlock(&stream->lock);
+        }
 
-    Purpose: makes a directory specified by path.
+        if (have_next)
+        {
+            pthread_cond_timedwait(&OS_stream_flush_cv, &OS_stream_flush_mut, &next);
+        }
+        else
+        {
+            pthread_cond_wait(&OS_stream_flush_cv, &OS_stream_flush_mut);
+        }
+    }
 
-    Returns: OS_FS_ERR_INVALID_POINTER if path is NULL
-             OS_FS_ERR_PATH_TOO_LONG if the path is too long to be stored locally
-             OS_FS_ERR_PATH_INVALID if path cannot be parsed
-             OS_FS_ERROR if the OS call fails
-             OS_FS_SUCCESS if success
+    return NULL;
 
-    Note: The access parameter is currently unused.
----------------------------------------------------------------------------------------*/
+}/* end OS_StreamFlusher */
 
-int32 OS_mkdir (const char *path, uint32 access)
+/* --------------------------------------------------------------------------------------
+   Name: OS_StreamOpen
+
+   Purpose: Puts a buffer of buffer_size bytes (OS_STREAM_DEFAULT_BUFFER_SIZE if 0)
+            in front of the open file filedes, so that small records written with
+            OS_StreamWrite are collected and reach the file in few system calls.
+            The buffer is written out when it is full, flush_msecs after the
+            oldest data in it was written (never if 0), and on OS_StreamFlush and
+            OS_StreamClose. A timed flush that fails is tried again flush_msecs
+            later. With OS_STREAM_SYNC every flush also waits for the data to reach
+            the device.
+
+            The stream takes over filedes: it should only be written through the
+            stream, and OS_StreamClose closes it.
+
+   Returns: OS_FS_ERR_INVALID_POINTER if stream_id is NULL
+            OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+            OS_ERR_NO_FREE_IDS if there are no more free stream Ids
+            OS_FS_ERROR if the buffer or the flusher thread could not be created
+            OS_FS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+int32 OS_StreamOpen (uint32 *stream_id, int32 filedes, uint32 buffer_size,
+                     uint32 flush_msecs, uint32 flags)
 {
-   int status;
-   mode_t mode;
-   char local_path[OS_MAX_LOCAL_PATH_LEN];
-
-    /*
-    ** Check to see if the path pointer is NULL
-    */    
-    if (path == NULL)
+    OS_stream_record_t *stream;
+    uint32              possible_id;
+    pthread_t           flusher;
+    pthread_attr_t      attr;
+    sigset_t            previous;
+    sigset_t            mask;
+
+    if (stream_id == NULL)
+    {
         return OS_FS_ERR_INVALID_POINTER;
+    }
 
-    /*
-    ** Check to see if the path is too long
-    */      
-    if (strlen(path) >= OS_MAX_PATH_LEN)
-        return OS_FS_ERR_PATH_TOO_LONG;
+    /* Make sure the file descriptor is legit before using it */
+    if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
+    {
+        return OS_FS_ERR_INVALID_FD;
+    }
 
+    if (buffer_size == 0)
+    {
+        buffer_size = OS_STREAM_DEFAULT_BUFFER_SIZE;
+    }
 
-    /*
-    ** Translate the path
-    */
-    if ( OS_TranslatePath(path, (char *)local_path) != OS_FS_SUCCESS )
+    OS_InterruptSafeLock(&OS_stream_table_mut, &mask, &previous);
+
+    for (possible_id = 0; possible_id < OS_MAX_STREAMS; possible_id++)
     {
-        return OS_FS_ERR_PATH_INVALID;
+        if (OS_stream_table[possible_id].free == TRUE)
+            break;
     }
-    
-    mode = S_IFDIR |S_IRWXU | S_IRWXG | S_IRWXO;
-    status = mkdir(local_path, mode);
 
-    if (status == 0)
+    if (possible_id == OS_MAX_STREAMS)
     {
-        return OS_FS_SUCCESS;
+        OS_InterruptSafeUnlock(&OS_stream_table_mut, &previous);
+        return OS_ERR_NO_FREE_IDS;
     }
-    else
+
+    if (flush_msecs > 0 && OS_stream_flusher_started == FALSE)
     {
+        /*
+        ** The flusher inherits the signal mask blocked by the table lock
+        */
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        if (pthread_create(&flusher, &attr, OS_StreamFlusher, NULL) != 0)
+        {
+            pthread_attr_destroy(&attr);
+            OS_InterruptSafeUnlock(&OS_stream_table_mut, &previous);
+            return OS_FS_ERROR;
+        }
+        pthread_attr_destroy(&attr);
+        OS_stream_flusher_started = TRUE;
+    }
+
+    stream = &OS_stream_table[possible_id];
+
+    pthread_mutex_lock(&stream->lock);
+
+    stream->buffer = malloc(buffer_size);
+    if (stream->buffer == NULL)
+    {
+        pthread_mutex_unlock(&stream->lock);
+        OS_InterruptSafeUnlock(&OS_stream_table_mut, &previous);
         return OS_FS_ERROR;
     }
-    
-}/* end OS_mkdir */
 
-/*--------------------------------------------------------------------------------------
-    Name: OS_opendir
+    stream->filedes     = filedes;
+    stream->flags       = flags;
+    stream->buffer_size = buffer_size;
+    stream->used        = 0;
+    stream->flush_msecs = flush_msecs;
+    stream->free        = FALSE;
 
-    Purpose: opens a directory for searching
+    pthread_mutex_unlock(&stream->lock);
 
-    Returns: NULL if there is an error  
-             a pointer to a directory if success
-             
----------------------------------------------------------------------------------------*/
+    OS_InterruptSafeUnlock(&OS_stream_table_mut, &previous);
 
-os_dirp_t OS_opendir (const char *path)
-{
+    *stream_id = possible_id;
 
-    os_dirp_t dirdescptr;
-    char local_path[OS_MAX_LOCAL_PATH_LEN];
+    return OS_FS_SUCCESS;
 
-    /*
-    ** Check to see if the path pointer is NULL
-    */        
-    if (path == NULL)
-    {
-        return NULL;
-    }
+}/* end OS_StreamOpen */
 
-    /*
-    ** Check to see if the path is too long
-    */      
-    if (strlen(path) > OS_MAX_PATH_LEN)
+/* --------------------------------------------------------------------------------------
+   Name: OS_StreamWrite
+
+   Purpose: Adds nbytes of buffer to a stream. The buffered data is written out
+            first if the new data does not fit; data as large as the whole buffer
+            goes straight to the file.
+
+   Returns: OS_FS_ERR_INVALID_POINTER if buffer is NULL
+            OS_ERR_INVALID_ID if the id passed in is not an open stream
+            OS_FS_ERROR if the buffered data could not be written out
+            nbytes if success
+ ---------------------------------------------------------------------------------------*/
+int32 OS_StreamWrite (uint32 stream_id, const void *buffer, uint32 nbytes)
+{
+    OS_stream_record_t *stream;
+    int32               status;
+    uint32              written;
+    int                 arm_flusher;
+
+    if (buffer == NULL)
     {
-        return NULL;
+        return OS_FS_ERR_INVALID_POINTER;
     }
-   
-    /*
-    ** Translate the path
-    */
-    if ( OS_TranslatePath(path, (char *)local_path) != OS_FS_SUCCESS )
+
+    if (stream_id >= OS_MAX_STREAMS)
     {
-        return NULL;
+        return OS_ERR_INVALID_ID;
     }
-   
-    dirdescptr = opendir( (char*) local_path);
-    
-    if (dirdescptr == NULL)
+
+    stream = &OS_stream_table[stream_id];
+
+    pthread_mutex_lock(&stream->lock);
+
+    if (stream->free == TRUE)
     {
-        return NULL;
+        pthread_mutex_unlock(&stream->lock);
+        return OS_ERR_INVALID_ID;
     }
-    else
+
+    status      = OS_FS_SUCCESS;
+    arm_flusher = FALSE;
+
+    if (stream->used + nbytes > stream->buffer_size)
     {
-        return dirdescptr;
+        status = OS_StreamDrain(stream);
     }
-    
-} /* end OS_opendir */
 
-/*--------------------------------------------------------------------------------------
-    Name: OS_closedir
-    
-    Purpose: closes a directory
+    if (status == OS_FS_SUCCESS)
+    {
+        if (nbytes >= stream->buffer_size)
+        {
+            status = OS_StreamWriteOut(stream, buffer, nbytes, &written);
+        }
+        else
+        {
+            if (stream->used == 0 && stream->flush_msecs > 0)
+            {
+                OS_StreamSetDeadline(stream);
+                arm_flusher = TRUE;
+            }
 
-    Returns: OS_FS_SUCCESS if success
-             OS_FS_ERROR if close failed
----------------------------------------------------------------------------------------*/
+            memcpy(stream->buffer + stream->used, buffer, nbytes);
+            stream->used += nbytes;
+        }
+    }
 
-int32 OS_closedir (os_dirp_t directory)
-{ 
-    int status;
+    pthread_mutex_unlock(&stream->lock);
 
-    if (directory == NULL)
+    if (arm_flusher)
     {
-        return OS_FS_ERR_INVALID_POINTER;
+        /*
+        ** Taking the flusher lock makes sure the flusher is either about
+        ** to look at this stream or waiting for the signal
+        */
+        pthread_mutex_lock(&OS_stream_flush_mut);
+        pthread_cond_signal(&OS_stream_flush_cv);
+        pthread_mutex_unlock(&OS_stream_flush_mut);
     }
 
-    status = closedir(directory);
-    if (status != ERROR)
-    {
-        return OS_FS_SUCCESS;
-    }
-    else
+    if (status != OS_FS_SUCCESS)
     {
-        return OS_FS_ERROR;
+        return status;
     }
 
-} /* end OS_closedir */
+    return (int32)nbytes;
 
-/*--------------------------------------------------------------------------------------
-    Name: OS_readdir
+}/* end OS_StreamWrite */
 
-    Purpose: obtains directory entry data for the next file from an open directory
+/* --------------------------------------------------------------------------------------
+   Name: OS_StreamFlush
 
-    Returns: a pointer to the next entry for success
-             NULL if error or end of directory is reached
----------------------------------------------------------------------------------------*/
-os_dirent_t *  OS_readdir (os_dirp_t directory)
-{ 
-    os_dirent_t *tempptr;
+   Purpose: Writes the buffered data of a stream to its file. With OS_STREAM_SYNC
+            it returns once the data is on the device.
 
-    if (directory == NULL)
-        return NULL;
+   Returns: OS_ERR_INVALID_ID if the id passed in is not an open stream
+            OS_FS_ERROR if the data could not be written
+            OS_FS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+int32 OS_StreamFlush (uint32 stream_id)
+{
+    OS_stream_record_t *stream;
+    int32               status;
 
-    tempptr = readdir( directory);
-    
-    if (tempptr != NULL)
+    if (stream_id >= OS_MAX_STREAMS)
     {
-        return tempptr;
+        return OS_ERR_INVALID_ID;
+    }
+
+    stream = &OS_stream_table[stream_id];
+
+    pthread_mutex_lock(&stream->lock);
+
+    if (stream->free == TRUE)
+    {
+        status = OS_ERR_INVALID_ID;
     }
     else
     {
-        return NULL;
+        status = OS_StreamDrain(stream);
     }
-        
-} /* end OS_readdir */
 
-/*--------------------------------------------------------------------------------------
-    Name: OS_rewinddir
+    pthread_mutex_unlock(&stream->lock);
 
-    Purpose: Rewinds the directory pointer
+    return status;
 
-    Returns: N/A
----------------------------------------------------------------------------------------*/
-void  OS_rewinddir (os_dirp_t directory )
-{
-    if (directory != NULL)
-    {
-       rewinddir( directory);
-    }
-}
-/*--------------------------------------------------------------------------------------
-    Name: OS_rmdir
-    
-    Purpose: removes a directory from  the structure (must be an empty directory)
+}/* end OS_StreamFlush */
 
-    Returns: OS_FS_ERR_INVALID_POINTER if path is NULL
-             OS_FS_ERR_PATH_INVALID if path cannot be parsed    
-             OS_FS_ER_PATH_TOO_LONG
-             OS_FS_SUCCESS on success
-             OS_FS_ERROR if the directory remove operation failed
----------------------------------------------------------------------------------------*/
+/* --------------------------------------------------------------------------------------
+   Name: OS_StreamClose
 
-int32  OS_rmdir (const char *path)
+   Purpose: Flushes a stream, then releases it and closes its file. The stream is
+            released even when the flush fails.
+
+   Returns: OS_ERR_INVALID_ID if the id passed in is not an open stream
+            OS_FS_ERROR if the buffered data could not be written or the file
+            could not be closed
+            OS_FS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+int32 OS_StreamClose (uint32 stream_id)
 {
-    int status;
-    char local_path [OS_MAX_LOCAL_PATH_LEN];
+    OS_stream_record_t *stream;
+    int32               status;
+    int32               filedes;
+    sigset_t            previous;
+    sigset_t            mask;
 
-    /*
-    ** Check to see if the path pointer is NULL
-    */            
-    if (path == NULL)
+    if (stream_id >= OS_MAX_STREAMS)
     {
-        return OS_FS_ERR_INVALID_POINTER;
+        return OS_ERR_INVALID_ID;
     }
 
-    /*
-    ** Check to see if the path is too long
-    */      
-    if (strlen(path) >= OS_MAX_PATH_LEN)
-    {
-        return OS_FS_ERR_PATH_TOO_LONG;
-    }
+    stream = &OS_stream_table[stream_id];
 
-    /*
-    ** Translate the path
-    */
-    if ( OS_TranslatePath(path, (char *)local_path) != OS_FS_SUCCESS )
+    OS_InterruptSafeLock(&OS_stream_table_mut, &mask, &previous);
+    pthread_mutex_lock(&stream->lock);
+
+    if (stream->free == TRUE)
     {
-        return OS_FS_ERR_PATH_INVALID;
+        pthread_mutex_unlock(&stream->lock);
+        OS_InterruptSafeUnlock(&OS_stream_table_mut, &previous);
+        return OS_ERR_INVALID_ID;
     }
-    
-    status = rmdir(local_path);
-    
-    if (status == 0)
+
+    status  = OS_StreamDrain(stream);
+    filedes = stream->filedes;
+
+    free(stream->buffer);
+    stream->buffer  = NULL;
+    stream->used    = 0;
+    stream->filedes = -1;
+    stream->free    = TRUE;
+
+    pthread_mutex_unlock(&stream->lock);
+    OS_InterruptSafeUnlock(&OS_stream_table_mut, &previous);
+
+    if (OS_close(filedes) != OS_FS_SUCCESS)
     {
-        return OS_FS_SUCCESS;
+        status = OS_FS_ERROR;
     }
-    else
+
+    return status;
+
+}/* end OS_StreamClose */
+
+
+/****************************************************************************************
+                                     SYNC GROUPS
+****************************************************************************************/
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_SyncGroupSyncFiles
+
+   Purpose: Syncs count files the way the flags of their group ask for. With
+            OS_SYNC_GROUP_SYNCFS each file system is synced once, however many of
+            the files are on it. Files that were closed in the meantime are skipped.
+
+   Returns: OS_FS_ERROR if any of the files could not be synced
+            OS_FS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+static int32 OS_SyncGroupSyncFiles(uint32 flags, const int32 *files, uint32 count)
+{
+    struct stat64 st;
+    dev_t         synced_devs[OS_MAX_NUM_OPEN_FILES];
+    uint32        num_synced_devs;
+    uint32        i;
+    uint32        j;
+    int           os_fd;
+    int32         status;
+
+    status          = OS_FS_SUCCESS;
+    num_synced_devs = 0;
+
+    for (i = 0; i < count; i++)
     {
-        return OS_FS_ERROR;
+        if (OS_FDTable[files[i]].IsValid == FALSE)
+        {
+            continue;
+        }
+        os_fd = OS_FDTable[files[i]].OSfd;
+
+        if ((flags & OS_SYNC_GROUP_SYNCFS) != 0)
+        {
+            if (fstat64(os_fd, &st) != 0)
+            {
+                status = OS_FS_ERROR;
+                continue;
+            }
+
+            for (j = 0; j < num_synced_devs; j++)
+            {
+                if (synced_devs[j] == st.st_dev)
+                    break;
+            }
+            if (j < num_synced_devs)
+            {
+                continue;
+            }
+            synced_devs[num_synced_devs++] = st.st_dev;
+
+            if (syncfs(os_fd) != 0)
+            {
+                status = OS_FS_ERROR;
+            }
+        }
+        else if ((flags & OS_SYNC_GROUP_FULL) != 0)
+        {
+            if (fsync(os_fd) != 0)
+            {
+                status = OS_FS_ERROR;
+            }
+        }
+        else
+        {
+            if (fdatasync(os_fd) != 0)
+            {
+                status = OS_FS_ERROR;
+            }
+        }
     }
-    
-}/* end OS_rmdir */
+
+    return status;
+
+}/* end OS_SyncGroupSyncFiles */
 
 /* --------------------------------------------------------------------------------------
-    Name: OS_check_name_length
-    
-    Purpose: Checks the length of the file name at the end of the path.
-    
-    Returns: OS_FS_ERROR if path is NULL, path is too long, there is no '/' in the path
-             name, the name is too long
-             OS_SUCCESS if success
-            
-    NOTE: This is only an internal function and is not intended for use by the user
- ---------------------------------------------------------------------------------------*/
+   Name: OS_SyncGroupFlush
 
-int32 OS_check_name_length(const char *path)
+   Purpose: Syncs the files waiting in a group, and frees the group if release is
+            TRUE. The group lock is only held to take the list of waiting files, so
+            files can be added while the sync runs; they go to the next commit.
+            The commit lock is held until the sync is done, so a task whose files
+            were taken by a commit in progress waits for that commit to finish.
+
+   Returns: OS_ERR_INVALID_ID if the group is not in use
+            OS_FS_ERROR if any of the files could not be synced
+            OS_FS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+static int32 OS_SyncGroupFlush(OS_sync_group_record_t *group, int release)
 {
-    char* name_ptr;
+    int32  files[OS_MAX_NUM_OPEN_FILES];
+    uint32 count;
+    uint32 flags;
+    uint32 i;
+    int32  status;
 
-    if (path == NULL)
+    pthread_mutex_lock(&group->commit_lock);
+    pthread_mutex_lock(&group->lock);
+
+    if (group->free == TRUE)
     {
-        return OS_FS_ERR_INVALID_POINTER;
+        pthread_mutex_unlock(&group->lock);
+        pthread_mutex_unlock(&group->commit_lock);
+        return OS_ERR_INVALID_ID;
     }
 
-    if (strlen(path) > OS_MAX_PATH_LEN)
+    count = group->num_pending;
+    flags = group->flags;
+    for (i = 0; i < count; i++)
     {
-        return OS_FS_ERROR;
+        files[i] = group->pending[i];
+        group->is_pending[files[i]] = FALSE;
     }
+    group->num_pending = 0;
 
-    /*
-     * All names passed into this function are REQUIRED to contain at
-     * least one directory separator. Find the last one.
-     */
-    name_ptr = strrchr(path, '/');
-    if (name_ptr == NULL)
+    if (release)
     {
-        return OS_FS_ERROR;
+        group->free = TRUE;
     }
 
-    /*
-     * Advance the pointer past the directory separator so that it
-     * indicates the final component of the path.
-     */
-    name_ptr ++;
+    pthread_mutex_unlock(&group->lock);
 
-    /*
-     * Reject paths whose final component is too long.
-     */
-    if( strlen(name_ptr) > OS_MAX_FILE_NAME)
+    status = OS_SyncGroupSyncFiles(flags, files, count);
+
+    pthread_mutex_unlock(&group->commit_lock);
+
+    return status;
+
+}/* end OS_SyncGroupFlush */
+
+/* --------------------------------------------------------------------------------------
+   Name: OS_SyncGroupFlusher
+
+   Purpose: Thread that commits the groups whose flush_msecs have passed since
+            their first waiting file was added. It is started by the first group
+            created with a flush time and stays around for the next ones.
+ ---------------------------------------------------------------------------------------*/
+static void *OS_SyncGroupFlusher(void *arg)
+{
+    OS_sync_group_record_t *group;
+    struct timespec         now;
+    struct timespec         next;
+    int                     have_next;
+    int                     due;
+    sigset_t                mask;
+    uint32                  i;
+
+    /* Signals are for the OSAL tasks */
+    sigfillset(&mask);
+    pthread_sigmask(SIG_SETMASK, &mask, NULL);
+
+    pthread_mutex_lock(&OS_sync_group_flush_mut);
+
+    while (TRUE)
     {
-        return OS_FS_ERROR;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        have_next = FALSE;
+        due       = FALSE;
+
+        for (i = 0; i < OS_MAX_SYNC_GROUPS && due == FALSE; i++)
+        {
+            group = &OS_sync_group_table[i];
+
+            pthread_mutex_lock(&group->lock);
+            if (group->free == FALSE && group->num_pending > 0 && group->flush_msecs > 0)
+            {
+                if (now.tv_sec > group->flush_deadline.tv_sec ||
+                   (now.tv_sec == group->flush_deadline.tv_sec &&
+                    now.tv_nsec >= group->flush_deadline.tv_nsec))
+                {
+                    due = TRUE;
+                }
+                else if (!have_next || group->flush_deadline.tv_sec < next.tv_sec ||
+                        (group->flush_deadline.tv_sec == next.tv_sec &&
+                         group->flush_deadline.tv_nsec < next.tv_nsec))
+                {
+                    next      = group->flush_deadline;
+                    have_next = TRUE;
+                }
+            }
+            pthread_mutex_unlock(&group->lock);
+        }
+
+        if (due)
+        {
+            /*
+            ** A sync can take a while, so it runs without the flusher lock and
+            ** all groups are looked at again afterwards, in case a deadline was
+            ** set meanwhile
+            */
+            pthread_mutex_unlock(&OS_sync_group_flush_mut);
+            OS_SyncGroupFlush(group, FALSE);
+            pthread_mutex_lock(&OS_sync_group_flush_mut);
+        }
+        else if (have_next)
+        {
+            pthread_cond_timedwait(&OS_sync_group_flush_cv, &OS_sync_group_flush_mut, &next);
+        }
+        else
+        {
+            pthread_cond_wait(&OS_sync_group_flush_cv, &OS_sync_group_flush_mut);
+        }
     }
 
-    return OS_FS_SUCCESS;
+    return NULL;
+
+}/* end OS_SyncGroupFlusher */
 
-}/* end OS_check_name_length */
 /* --------------------------------------------------------------------------------------
-    Name: OS_ShellOutputToFile
-    
-    Purpose: Takes a shell command in and writes the output of that command to the specified file
-    
-    Returns: OS_FS_ERROR if the command was not executed properly
-             OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
-             OS_SUCCESS if success
+   Name: OS_SyncGroupCreate
+
+   Purpose: Creates a group that syncs the files added to it together, so that
+            many files written at about the same time cost one round of syncs.
+            The files waiting in the group are synced flush_msecs after the first
+            of them was added (never if 0), as soon as max_pending files are
+            waiting (no limit if 0), and on OS_SyncGroupCommit and
+            OS_SyncGroupDelete.
+
+            By default each file is synced with fdatasync. OS_SYNC_GROUP_FULL uses
+            fsync instead, and OS_SYNC_GROUP_SYNCFS syncs each file system the
+            files are on once, which is cheaper when many files share a file
+            system that holds little other unsynced data.
+
+   Returns: OS_FS_ERR_INVALID_POINTER if group_id is NULL
+            OS_ERR_NO_FREE_IDS if there are no more free sync group Ids
+            OS_FS_ERROR if the flusher thread could not be created
+            OS_FS_SUCCESS if success
  ---------------------------------------------------------------------------------------*/
-int32 OS_ShellOutputToFile(char* Cmd, int32 OS_fd)
+int32 OS_SyncGroupCreate (uint32 *group_id, uint32 flush_msecs, uint32 max_pending,
+                          uint32 flags)
 {
-    
-    /* 
-    ** this is a #define to avoid a 'variable length array' warning 
-    ** 15 is for the size of the redirection string that is added 
-    ** to the command 
-    */
-    char  LocalCmd [OS_MAX_CMD_LEN + OS_REDIRECTSTRSIZE]; 
-    int32 ReturnCode;
-    int32 Result;
+    OS_sync_group_record_t *group;
+    uint32                  possible_id;
+    pthread_t               flusher;
+    pthread_attr_t          attr;
+    sigset_t                previous;
+    sigset_t                mask;
+
+    if (group_id == NULL)
+    {
+        return OS_FS_ERR_INVALID_POINTER;
+    }
 
-    /*
-    ** Check parameters
-    */
-    if (Cmd == NULL)
+    OS_InterruptSafeLock(&OS_sync_group_table_mut, &mask, &previous);
+
+    for (possible_id = 0; possible_id < OS_MAX_SYNC_GROUPS; possible_id++)
     {
-        return(OS_FS_ERR_INVALID_POINTER);
+        if (OS_sync_group_table[possible_id].free == TRUE)
+            break;
     }
 
-    /* 
-    ** Make sure the file descriptor is valid before using it 
-    */
-    if (OS_fd < 0 || OS_fd >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[OS_fd].IsValid == FALSE)
+    if (possible_id == OS_MAX_SYNC_GROUPS)
     {
-        return OS_FS_ERR_INVALID_FD;
+        OS_InterruptSafeUnlock(&OS_sync_group_table_mut, &previous);
+        return OS_ERR_NO_FREE_IDS;
     }
-    else
+
+    if (flush_msecs > 0 && OS_sync_group_flusher_started == FALSE)
     {
-    
-        /* Make sure that we are able to access this file */
-        fchmod(OS_FDTable[OS_fd].OSfd,0777);
-  
-        /* 
-        ** add in the extra chars necessary to perform the redirection
-        ** 1 for stdout and 2 for stderr. they are redirected to the 
-        ** file descriptor passed in.
-        **
-        ** LocalCmd is defined above to be big enough to handle the largest
-        ** allowed Cmd (OS_MAX_CMD_LEN characters) plus the longest possible
-        ** redirect string size (OS_REDIRECTSTRSIZE). If those constants are
+        /*
+        ** The flusher inherits the signal mask blocked by the table lock
         */
-        snprintf(LocalCmd, sizeof LocalCmd,
-                 "%s 1>&%d 2>&%d", Cmd, (int)OS_FDTable[OS_fd].OSfd, (int)OS_FDTable[OS_fd].OSfd);
-    
-        Result = system(LocalCmd);
-        if (Result == 0)
-        {
-            ReturnCode = OS_FS_SUCCESS;
-        }
-        else
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        if (pthread_create(&flusher, &attr, OS_SyncGroupFlusher, NULL) != 0)
         {
-            ReturnCode = OS_FS_ERROR;
+            pthread_attr_destroy(&attr);
+            OS_InterruptSafeUnlock(&OS_sync_group_table_mut, &previous);
+            return OS_FS_ERROR;
         }
-    
-        return ReturnCode;
+        pthread_attr_destroy(&attr);
+        OS_sync_group_flusher_started = TRUE;
     }
-    /* should never get here */
-    return OS_FS_ERROR;
-}/* end OS_ShellOutputToFile */
+
+    group = &OS_sync_group_table[possible_id];
+
+    pthread_mutex_lock(&group->lock);
+
+    group->flags       = flags;
+    group->flush_msecs = flush_msecs;
+    group->max_pending = max_pending;
+    group->num_pending = 0;
+    memset(group->is_pending, FALSE, sizeof(group->is_pending));
+    group->free        = FALSE;
+
+    pthread_mutex_unlock(&group->lock);
+
+    OS_InterruptSafeUnlock(&OS_sync_group_table_mut, &previous);
+
+    *group_id = possible_id;
+
+    return OS_FS_SUCCESS;
+
+}/* end OS_SyncGroupCreate */
 
 /* --------------------------------------------------------------------------------------
-Name: OS_FDGetInfo
-    
-Purpose: Copies the information of the given file descriptor into a structure passed in
-    
-Returns: OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
-         OS_FS_SUCCESS if the copying was successfull
- ---------------------------------------------------------------------------------------*/
+   Name: OS_SyncGroupAdd
 
-int32 OS_FDGetInfo (int32 filedes, OS_FDTableEntry *fd_prop)
+   Purpose: Adds an open file with unsynced writes to a sync group. A file that is
+            already waiting in the group is only synced once. If this makes
+            max_pending files wait, the group is committed before returning.
+
+   Returns: OS_ERR_INVALID_ID if the id passed in is not a sync group in use
+            OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+            OS_FS_ERROR if the group was committed and a file could not be synced
+            OS_FS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+int32 OS_SyncGroupAdd (uint32 group_id, int32 filedes)
 {
+    OS_sync_group_record_t *group;
+    int                     arm_flusher;
+    int                     commit;
 
-    if (fd_prop == NULL)
+    if (group_id >= OS_MAX_SYNC_GROUPS)
     {
-        return(OS_FS_ERR_INVALID_POINTER);
+        return OS_ERR_INVALID_ID;
     }
 
     /* Make sure the file descriptor is legit before using it */
     if (filedes < 0 || filedes >= OS_MAX_NUM_OPEN_FILES || OS_FDTable[filedes].IsValid == FALSE)
     {
-       (*(fd_prop)).IsValid = FALSE; 
         return OS_FS_ERR_INVALID_FD;
     }
-    else
-    { 
-        *fd_prop = OS_FDTable[filedes];
-        return OS_FS_SUCCESS;
-    }
 
-}/* end OS_FDGetInfo */
+    group = &OS_sync_group_table[group_id];
 
-/* --------------------------------------------------------------------------------------
-   Name: OS_FileOpenCheck
-    
-   Purpose: Checks to see if a file is open 
-    
-   Returns: OS_FS_ERROR if the file is not open 
-            OS_FS_SUCCESS if the file is open 
- ---------------------------------------------------------------------------------------*/
-int32 OS_FileOpenCheck(char *Filename)
-{
-    uint32    i;
-    sigset_t  previous;
-    sigset_t  mask;
+    pthread_mutex_lock(&group->lock);
 
-    if (Filename == NULL)
+    if (group->free == TRUE)
     {
-        return(OS_FS_ERR_INVALID_POINTER);
+        pthread_mutex_unlock(&group->lock);
+        return OS_ERR_INVALID_ID;
     }
 
-    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+    arm_flusher = FALSE;
 
-    for ( i = 0; i < OS_MAX_NUM_OPEN_FILES; i++)
+    if (group->is_pending[filedes] == FALSE)
     {
-        if ((OS_FDTable[i].IsValid == TRUE) &&  (strcmp(OS_FDTable[i].Path, Filename) == 0))
+        if (group->num_pending == 0 && group->flush_msecs > 0)
         {
-           OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
-           return(OS_FS_SUCCESS);
+            clock_gettime(CLOCK_MONOTONIC, &group->flush_deadline);
+            group->flush_deadline.tv_sec  += group->flush_msecs / 1000;
+            group->flush_deadline.tv_nsec += (group->flush_msecs % 1000) * 1000000;
+            if (group->flush_deadline.tv_nsec >= 1000000000)
+            {
+                group->flush_deadline.tv_nsec -= 1000000000;
+                ++group->flush_deadline.tv_sec;
+            }
+            arm_flusher = TRUE;
         }
-    }/* end for */
-
-    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
-    return OS_FS_ERROR;
-
-}/* end OS_FileOpenCheck */
 
+        group->is_pending[filedes] = TRUE;
+        group->pending[group->num_pending++] = filedes;
+    }
 
-/* --------------------------------------------------------------------------------------
-   Name: OS_CloseFileByName
-
-   Purpose: Allows a file to be closed by name.
-            This will only work if the name passed in is the same name used to open 
-            the file.
+    commit = (group->max_pending > 0 && group->num_pending >= group->max_pending);
 
-   Returns: OS_FS_ERR_PATH_INVALID if the file is not found 
-            OS_FS_ERROR   if the file close returned an error
-            OS_FS_SUCCESS if the file close suceeded  
- ---------------------------------------------------------------------------------------*/
-int32 OS_CloseFileByName(char *Filename)
-{
-    uint32    i;
-    int       status;
-    sigset_t  previous;
-    sigset_t  mask;
+    pthread_mutex_unlock(&group->lock);
 
-    if (Filename == NULL)
+    if (commit)
     {
-        return(OS_FS_ERR_INVALID_POINTER);
+        return OS_SyncGroupFlush(group, FALSE);
     }
 
-    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
-
-    for ( i = 0; i < OS_MAX_NUM_OPEN_FILES; i++)
+    if (arm_flusher)
     {
-        if ((OS_FDTable[i].IsValid == TRUE) &&  (strcmp(OS_FDTable[i].Path, Filename) == 0))
-        {
-           /*
-           ** Close the file
-           */
-           status = close ((int) OS_FDTable[i].OSfd);
+        /*
+        ** Taking the flusher lock makes sure the flusher is either about
+        ** to look at this group or waiting for the signal
+        */
+        pthread_mutex_lock(&OS_sync_group_flush_mut);
+        pthread_cond_signal(&OS_sync_group_flush_cv);
+        pthread_mutex_unlock(&OS_sync_group_flush_mut);
+    }
 
-           /*
-           ** Next, remove the file from the OSAL list
-           ** to free up that slot
-           */
-           OS_FDTable[i].OSfd =       -1;
-           strcpy(OS_FDTable[i].Path, "\0");
-           OS_FDTable[i].User =       0;
-           OS_FDTable[i].IsValid =    FALSE;
-           OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+    return OS_FS_SUCCESS;
 
-           if (status == 0)
-           {
-              return(OS_FS_SUCCESS);
-           }
-           else
-           {
-              return(OS_FS_ERROR);
-           }
-        }
+}/* end OS_SyncGroupAdd */
 
-    }/* end for */
+/* --------------------------------------------------------------------------------------
+   Name: OS_SyncGroupCommit
 
-    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
+   Purpose: Syncs the files waiting in a sync group. It returns once every file
+            added to the group before the call is on the device, including files
+            a commit already in progress had taken.
 
-    return (OS_FS_ERR_PATH_INVALID);
+   Returns: OS_ERR_INVALID_ID if the id passed in is not a sync group in use
+            OS_FS_ERROR if a file could not be synced
+            OS_FS_SUCCESS if success
+ ---------------------------------------------------------------------------------------*/
+int32 OS_SyncGroupCommit (uint32 group_id)
+{
+    if (group_id >= OS_MAX_SYNC_GROUPS)
+    {
+        return OS_ERR_INVALID_ID;
+    }
 
-}/* end OS_CloseFileByName */
+    return OS_SyncGroupFlush(&OS_sync_group_table[group_id], FALSE);
+
+}/* end OS_SyncGroupCommit */
 
 /* --------------------------------------------------------------------------------------
-   Name: OS_CloseAllFiles
+   Name: OS_SyncGroupDelete
 
-   Purpose: Closes All open files that were opened through the OSAL 
+   Purpose: Commits a sync group, then deletes it. The files in the group are not
+            closed. The group is deleted even when the commit fails.
 
-   Returns: OS_FS_ERROR   if one or more file close returned an error
-            OS_FS_SUCCESS if the files were all closed without error
+   Returns: OS_ERR_INVALID_ID if the id passed in is not a sync group in use
+            OS_FS_ERROR if a file could not be synced
+            OS_FS_SUCCESS if success
  ---------------------------------------------------------------------------------------*/
-int32 OS_CloseAllFiles(void)
+int32 OS_SyncGroupDelete (uint32 group_id)
 {
-    uint32    i;
-    int32     return_status = OS_FS_SUCCESS;
-    int       status;
-    sigset_t  previous;
-    sigset_t  mask;
-    
-    OS_InterruptSafeLock(&OS_FDTableMutex, &mask, &previous);
+    int32    status;
+    sigset_t previous;
+    sigset_t mask;
 
-    for ( i = 0; i < OS_MAX_NUM_OPEN_FILES; i++)
+    if (group_id >= OS_MAX_SYNC_GROUPS)
     {
-        if ( OS_FDTable[i].IsValid == TRUE )
-        {
-           /*
-           ** Close the file
-           */
-           status = close ((int) OS_FDTable[i].OSfd);
+        return OS_ERR_INVALID_ID;
+    }
 
-           /*
-           ** Next, remove the file from the OSAL list
-           ** to free up that slot
-           */
-           OS_FDTable[i].OSfd =       -1;
-           strcpy(OS_FDTable[i].Path, "\0");
-           OS_FDTable[i].User =       0;
-           OS_FDTable[i].IsValid =    FALSE;
-           if (status == ERROR)
-           {
-              return_status = OS_FS_ERROR;
-           }
-        }
+    OS_InterruptSafeLock(&OS_sync_group_table_mut, &mask, &previous);
 
-    }/* end for */
+    status = OS_SyncGroupFlush(&OS_sync_group_table[group_id], TRUE);
 
-    OS_InterruptSafeUnlock(&OS_FDTableMutex, &previous);
-    return (return_status);
+    OS_InterruptSafeUnlock(&OS_sync_group_table_mut, &previous);
 
-}/* end OS_CloseAllFiles */
+    return status;
 
+}/* end OS_SyncGroupDelete */
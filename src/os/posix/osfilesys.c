@@ -85,6 +85,12 @@
                                     INCLUDE FILES
 ****************************************************************************************/
 
+/*
+** strnlen is POSIX.1-2008
+*/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -95,6 +101,7 @@
 #include <errno.h>
 #include <dirent.h>
 #include <sys/statvfs.h>
+#include <pthread.h>
 
 #include "common_types.h"
 #include "osapi.h"
@@ -107,6 +114,22 @@
 # define ERROR (-1)
 #undef OS_DEBUG_PRINTF
 
+/****************************************************************************************
+                                    TYPEDEFS
+****************************************************************************************/
+
+/*
+** One entry of the mount point index: a mount point with its trailing '/'
+** removed (so "/" has length 0) and the physical path it maps to
+*/
+typedef struct
+{
+    char    MountPoint[OS_MAX_PATH_LEN];
+    uint32  MountLen;
+    char    PhysDevName[OS_FS_PHYS_NAME_LEN];
+    uint32  PhysLen;
+} OS_mount_index_entry_t;
+
 /****************************************************************************************
                                    GLOBAL DATA
 ****************************************************************************************/
@@ -121,6 +144,87 @@ extern OS_VolumeInfo_t OS_VolumeTable [NUM_TABLE_ENTRIES];
 */
 extern OS_FDTableEntry OS_FDTable[OS_MAX_NUM_OPEN_FILES];
 
+/*
+** Mount point index used by OS_TranslatePath, longest mount point first.
+** Every call that changes the volume table clears OS_MountIndexValid, and
+** the next translation rebuilds the index.
+*/
+static OS_mount_index_entry_t OS_MountIndex[NUM_TABLE_ENTRIES];
+static uint32                 OS_MountIndexCount;
+static int                    OS_MountIndexValid = FALSE;
+static pthread_mutex_t        OS_MountIndexMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/****************************************************************************************
+                                 Mount Point Index
+****************************************************************************************/
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_InvalidateMountIndex
+
+    Purpose: Makes the next OS_TranslatePath rebuild the mount point index. Called
+             after every change to the volume table.
+---------------------------------------------------------------------------------------*/
+static void OS_InvalidateMountIndex(void)
+{
+    pthread_mutex_lock(&OS_MountIndexMutex);
+    OS_MountIndexValid = FALSE;
+    pthread_mutex_unlock(&OS_MountIndexMutex);
+
+}/* end OS_InvalidateMountIndex */
+
+/*---------------------------------------------------------------------------------------
+    Name: OS_BuildMountIndex
+
+    Purpose: Collects the mount points of the volume table into OS_MountIndex,
+             sorted by decreasing length so that the first match is the longest
+             one. The caller holds OS_MountIndexMutex.
+---------------------------------------------------------------------------------------*/
+static void OS_BuildMountIndex(void)
+{
+    OS_mount_index_entry_t entry;
+    uint32                 len;
+    int                    i;
+    int                    j;
+
+    OS_MountIndexCount = 0;
+
+    for (i = 0; i < NUM_TABLE_ENTRIES; i++)
+    {
+        if (OS_VolumeTable[i].FreeFlag == TRUE || OS_VolumeTable[i].MountPoint[0] != '/')
+        {
+            continue;
+        }
+
+        len = strnlen(OS_VolumeTable[i].MountPoint, OS_MAX_PATH_LEN - 1);
+        while (len > 0 && OS_VolumeTable[i].MountPoint[len - 1] == '/')
+        {
+            len--;
+        }
+
+        memcpy(entry.MountPoint, OS_VolumeTable[i].MountPoint, len);
+        entry.MountPoint[len] = '\0';
+        entry.MountLen = len;
+
+        entry.PhysLen = strnlen(OS_VolumeTable[i].PhysDevName, OS_FS_PHYS_NAME_LEN - 1);
+        memcpy(entry.PhysDevName, OS_VolumeTable[i].PhysDevName, entry.PhysLen);
+        entry.PhysDevName[entry.PhysLen] = '\0';
+
+        /*
+        ** Insertion sort: the table only has NUM_TABLE_ENTRIES entries.
+        ** Equal lengths keep volume table order, like the old linear search.
+        */
+        for (j = OS_MountIndexCount; j > 0 && OS_MountIndex[j - 1].MountLen < len; j--)
+        {
+            OS_MountIndex[j] = OS_MountIndex[j - 1];
+        }
+        OS_MountIndex[j] = entry;
+        OS_MountIndexCount++;
+    }
+
+    OS_MountIndexValid = TRUE;
+
+}/* end OS_BuildMountIndex */
+
 /****************************************************************************************
                                 Filesys API
 ****************************************************************************************/
@@ -180,6 +284,7 @@ int32 OS_mkfs (char *address, char *devname, char * volname, uint32 blocksize,
        OS_VolumeTable[i].FreeFlag = FALSE;
        strcpy(OS_VolumeTable[i].VolumeName, volname);
        OS_VolumeTable[i].BlockSize = blocksize;
+       OS_InvalidateMountIndex();
     
     }  
     else
@@ -234,6 +339,7 @@ int32 OS_rmfs (char *devname)
         {
             /* Free this entry in the table */
             OS_VolumeTable[i].FreeFlag = TRUE;
+            OS_InvalidateMountIndex();
             
             /* desconstruction of the filesystem to come later */
 
@@ -292,6 +398,7 @@ int32 OS_initfs (char *address,char *devname, char *volname,
        OS_VolumeTable[i].FreeFlag = FALSE;
        strcpy(OS_VolumeTable[i].VolumeName, volname);
        OS_VolumeTable[i].BlockSize = blocksize;
+       OS_InvalidateMountIndex();
     } 
     else
     {
@@ -341,6 +448,7 @@ int32 OS_mount (const char *devname, char* mountpoint)
     /* attach the mountpoint */
     strcpy(OS_VolumeTable[i].MountPoint, mountpoint);
     OS_VolumeTable[i].IsMounted = TRUE;
+    OS_InvalidateMountIndex();
 
     return OS_FS_SUCCESS;
 
@@ -388,6 +496,7 @@ int32 OS_unmount (const char *mountpoint)
     /* release the informationm from the table */
     OS_VolumeTable[i].IsMounted = FALSE;
     strcpy(OS_VolumeTable[i].MountPoint, "");
+    OS_InvalidateMountIndex();
     
     return OS_FS_SUCCESS;
     
@@ -573,13 +682,17 @@ int32 OS_FS_GetPhysDriveName(char * PhysDriveName, char * MountPoint)
  * Purpose: Because of the abstraction of the filesystem across OSes, we have to change
  *          the name of the {file, directory, drive} to be what the OS can actually 
  *          accept
+ *
+ *          The path is matched against the mount point index, longest mount point
+ *          first, so a volume mounted below another one (e.g. "/cf/logs" inside
+ *          "/cf") gets the paths under it. A mount point only matches whole path
+ *          components: "/cf" matches "/cf" and "/cf/x" but not "/cfx".
 ---------------------------------------------------------------------------------------*/
 int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
 {
-    char devname [OS_MAX_PATH_LEN];
-    char filename[OS_MAX_PATH_LEN];
-    int  NumChars;
-    int  i=0;
+    OS_mount_index_entry_t *entry;
+    size_t                  PathLen;
+    uint32                  i;
 
     /*
     ** Check to see if the path pointers are NULL
@@ -597,7 +710,8 @@ int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
     /*
     ** Check to see if the path is too long
     */
-    if (strlen(VirtualPath) >= OS_MAX_PATH_LEN)
+    PathLen = strnlen(VirtualPath, OS_MAX_PATH_LEN);
+    if (PathLen >= OS_MAX_PATH_LEN)
     {
         return OS_FS_ERR_PATH_TOO_LONG;
     }
@@ -610,57 +724,25 @@ int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
        return OS_FS_ERR_PATH_INVALID;
     }
 
-    /*
-    ** Fill the file and device name to be sure they do not have garbage
-    */
-    memset((void *)devname,0,OS_MAX_PATH_LEN);
-    memset((void *)filename,0,OS_MAX_PATH_LEN);
-   
-    /* 
-    ** We want to find the number of chars to where the second "/" is.
-    ** Since we know the first one is in spot 0, we start looking at 1, and go until
-    ** we find it.
-    */    
-    NumChars = 1;
-    while ((NumChars <= strlen(VirtualPath)) && (VirtualPath[NumChars] != '/'))
-    {
-        NumChars++;
-    }
-    
-    /* 
-    ** Don't let it overflow to cause a segfault when trying to get the highest level
-    ** directory 
-    */
-    if (NumChars > strlen(VirtualPath))
+    pthread_mutex_lock(&OS_MountIndexMutex);
+
+    if (OS_MountIndexValid == FALSE)
     {
-        NumChars = strlen(VirtualPath);
+        OS_BuildMountIndex();
     }
-  
-    /*
-    ** copy over only the part that is the device name 
-    */
-    snprintf(devname, OS_MAX_PATH_LEN, "%*s", NumChars, VirtualPath);
-    
-    /*
-    ** Copy everything after the devname as the path/filename
-    */
-    snprintf(filename, OS_MAX_PATH_LEN, "%s", VirtualPath + NumChars);
-    
-#ifdef OS_DEBUG_PRINTF 
-    printf("VirtualPath: %s, Length: %d\n",VirtualPath, (int)strlen(VirtualPath));
-    printf("NumChars: %d\n",NumChars);
-    printf("devname: %s\n",devname);
-    printf("filename: %s\n",filename);
-#endif
 
     /*
-    ** look for the dev name we found in the VolumeTable 
+    ** look for the longest mount point that is a prefix of the path
     */
-    for (i = 0; i < NUM_TABLE_ENTRIES; i++)
+    entry = NULL;
+    for (i = 0; i < OS_MountIndexCount; i++)
     {
-        if (OS_VolumeTable[i].FreeFlag == FALSE && 
-            strncmp(OS_VolumeTable[i].MountPoint, devname,NumChars) == 0)
+        if (OS_MountIndex[i].MountLen <= PathLen &&
+            (VirtualPath[OS_MountIndex[i].MountLen] == '/' ||
+             VirtualPath[OS_MountIndex[i].MountLen] == '\0') &&
+            memcmp(OS_MountIndex[i].MountPoint, VirtualPath, OS_MountIndex[i].MountLen) == 0)
         {
+            entry = &OS_MountIndex[i];
             break;
         }
     }
@@ -668,21 +750,22 @@ int32 OS_TranslatePath(const char *VirtualPath, char *LocalPath)
     /* 
     ** Make sure we found a valid drive 
     */
-    if (i >= NUM_TABLE_ENTRIES)
+    if (entry == NULL)
     {
+        pthread_mutex_unlock(&OS_MountIndexMutex);
         return OS_FS_ERR_PATH_INVALID;
     }
     
     /* 
-    ** copy over the physical first part of the drive 
+    ** copy over the physical first part of the drive, then the rest of
+    ** the path including its terminator; OS_MAX_LOCAL_PATH_LEN has room
+    ** for both
     */
-    strncpy(LocalPath,OS_VolumeTable[i].PhysDevName,OS_MAX_LOCAL_PATH_LEN);
-    NumChars = strlen(LocalPath);
+    memcpy(LocalPath, entry->PhysDevName, entry->PhysLen);
+    memcpy(LocalPath + entry->PhysLen, VirtualPath + entry->MountLen,
+           PathLen - entry->MountLen + 1);
 
-    /*
-    ** Add the file name
-    */
-    strncat(LocalPath, filename, (OS_MAX_LOCAL_PATH_LEN - NumChars));
+    pthread_mutex_unlock(&OS_MountIndexMutex);
 
 #ifdef OS_DEBUG_PRINTF
     printf("Result of TranslatePath = %s\n",LocalPath);
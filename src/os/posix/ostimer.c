@@ -13,9 +13,25 @@
 **
 ** Purpose: This file contains the OSAL Timer API for POSIX systems.
 **            
-**          This implementation depends on the POSIX Timer API which may not be available
-**          in older versions of the Linux kernel. It was developed and tested on
-**          RHEL 5 ./ CentOS 5 with Linux kernel 2.6.18
+**          Each time base owns a Linux timerfd and a dispatcher thread that
+**          blocks on it. The timers attached to a time base (OS_TimerAdd) are
+**          kept in a hierarchical timing wheel counted in ticks of the time
+**          base, so arming and cancelling a timer is O(1) however many there
+**          are. On every tick the dispatcher collects the timers that are due
+**          and calls them, in thread context.
+**
+**          OS_TimerCreate timers all share one internal time base that ticks
+**          every OS_TIMER_TICK_USEC, and only while one of them is armed.
+**
+**          A time base can also be driven from outside: by an external sync
+**          function (OS_TimeBaseCreate) or by a file descriptor that
+**          becomes readable on every pulse (OS_TimeBaseCreateFd). Its
+**          dispatcher then blocks on the sync source instead of a timerfd.
+**
+**          With OS_VIRTUAL_TIME the time bases that would run on a timerfd
+**          tick on the virtual clock of osapi.c instead.
+**
+**          timerfd needs Linux 2.6.25 or later.
 */
 
 /****************************************************************************************
@@ -26,6 +42,7 @@
 #include "osapi.h"
 
 #include <string.h>
+#include <stdlib.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <stdio.h>
@@ -33,15 +50,27 @@
 #include <time.h>
 #include <sys/signal.h>
 #include <sys/errno.h>
+#include <sys/timerfd.h>
+#include <sys/stat.h>
+#include <poll.h>
 #include <pthread.h>
+#include <sched.h>
 
 /****************************************************************************************
                                 EXTERNAL FUNCTION PROTOTYPES
 ****************************************************************************************/
 
 extern uint32 OS_FindCreator(void);
+extern int32  OS_PriorityRemap(uint32 InputPri);
 extern int    OS_InterruptSafeLock(pthread_mutex_t *lock, sigset_t *set, sigset_t *previous);
 extern void   OS_InterruptSafeUnlock(pthread_mutex_t *lock, sigset_t *previous);
+#ifdef OS_VIRTUAL_TIME
+extern int    OS_VirtualTimeCondTimedWait(const void *cond, pthread_mutex_t *mut, const struct timespec *abstime);
+extern int    OS_VirtualTimeCondBroadcast(const void *cond);
+extern void   OS_VirtualTimeThreadStart(void);
+extern void   OS_VirtualTimeThreadEnd(void *arg);
+extern void   OS_VirtualTimeSetIdle(uint32 idle);
+#endif
 
 /****************************************************************************************
                                 INTERNAL FUNCTION PROTOTYPES
@@ -49,18 +78,21 @@ extern void   OS_InterruptSafeUnlock(pthread_mutex_t *lock, sigset_t *previous);
 
 void  OS_TimespecToUsec(struct timespec time_spec, uint32 *usecs);
 void  OS_UsecToTimespec(uint32 usecs, struct timespec *time_spec);
+void *OS_TimeBaseDispatcher(void *arg);
+
+static void  OS_TimerWheelInsert(uint32 timebase_id, uint32 timer_id);
+static void  OS_TimerWheelRemove(uint32 timebase_id, uint32 timer_id);
+static void  OS_TimerArm(uint32 timer_id);
+static void  OS_TimerDisarm(uint32 timer_id);
+static void  OS_TimerClearStats(uint32 timer_id);
+static void  OS_TimeBaseTick(uint32 timebase_id);
+static int32 OS_TimeBaseStart(uint32 timebase_id, int sync_fd);
+static int   OS_TimeBaseProgram(uint32 timebase_id, uint32 start_time, uint32 interval_time);
 
 /****************************************************************************************
                                      DEFINES
 ****************************************************************************************/
 
-/*
-** The timers use the RT Signals. The system that this code was developed
-** and tested on has 32 available RT signals ( SIGRTMIN -> SIGRTMAX ).
-** OS_MAX_TIMERS should not be set to more than this number.
-*/
-#define OS_STARTING_SIGNAL  (SIGRTMAX-1)
-
 /*
 ** Since the API is storing the timer values in a 32 bit integer as Microseconds, 
 ** there is a limit to the number of seconds that can be represented.
@@ -69,6 +101,52 @@ void  OS_UsecToTimespec(uint32 usecs, struct timespec *time_spec);
 
 #define UNINITIALIZED 0
 
+/*
+** Tick of the time base shared by the OS_TimerCreate timers, in microseconds.
+** This is the resolution of those timers.
+*/
+#ifndef OS_TIMER_TICK_USEC
+#define OS_TIMER_TICK_USEC 1000
+#endif
+
+/*
+** OSAL priority of the time base dispatcher threads. The default puts
+** the timer callbacks above every task, as the timer signal used to be.
+*/
+#ifndef OS_TIMER_DISPATCH_PRIORITY
+#define OS_TIMER_DISPATCH_PRIORITY 0
+#endif
+
+/*
+** The internal time base lives in the slot after the last user time base,
+** so it never shows up through the time base API
+*/
+#define OS_TIMER_TIMEBASE  OS_MAX_TIMEBASES
+
+/*
+** Timing wheel geometry: 4 levels of 64 slots each cover 2^24 ticks.
+** A timer further out than that waits in the last level and is put
+** back in place each time that level comes round.
+*/
+#define OS_TIMER_WHEEL_BITS    6
+#define OS_TIMER_WHEEL_SLOTS   (1 << OS_TIMER_WHEEL_BITS)
+#define OS_TIMER_WHEEL_MASK    (OS_TIMER_WHEEL_SLOTS - 1)
+#define OS_TIMER_WHEEL_LEVELS  4
+#define OS_TIMER_WHEEL_SPAN    ((uint64)1 << (OS_TIMER_WHEEL_BITS * OS_TIMER_WHEEL_LEVELS))
+
+/*
+** End of a timer list, and the wheel level of a timer that is not in the wheel
+*/
+#define OS_TIMER_NONE          0xFFFFFFFF
+
+/*
+** What the dispatcher of a time base waits on
+*/
+#define OS_TIMEBASE_SYNC_TIMERFD   0   /* a timerfd owned by the time base */
+#define OS_TIMEBASE_SYNC_FUNCTION  1   /* the external sync function */
+#define OS_TIMEBASE_SYNC_FD_COUNT  2   /* an fd that reads as a 64 bit count, like an eventfd */
+#define OS_TIMEBASE_SYNC_FD_BYTES  3   /* a pipe, socket or device: one tick per byte */
+
 /****************************************************************************************
                                     LOCAL TYPEDEFS 
 ****************************************************************************************/
@@ -78,51 +156,148 @@ typedef struct
    uint32              free;
    char                name[OS_MAX_API_NAME];
    uint32              creator;
-   uint32              start_time;
-   uint32              interval_time;
+   uint64              start_time;        /* usecs */
+   uint64              interval_time;
    uint32              accuracy;
-   OS_TimerCallback_t  callback_ptr;
-   timer_t              host_timerid;
+   OS_TimerCallback_t  callback_ptr;      /* set by OS_TimerCreate */
+   OS_ArgCallback_t    arg_callback_ptr;  /* set by OS_TimerAdd */
+   void               *callback_arg;
+   uint32              timebase_id;
+   uint32              active;            /* armed by OS_TimerSet and not yet expired */
+   uint64              expiry;            /* time base tick at which the timer fires */
+   uint64              interval_ticks;
+   uint32              wheel_level;       /* OS_TIMER_NONE if not in the wheel */
+   uint32              wheel_slot;
+   uint32              next;              /* wheel slot list */
+   uint32              prev;
+   uint32              fire_pending;      /* TRUE while on the due list */
+   uint32              due_next;
+   uint32              due_prev;
+   uint64              next_due_nsecs;    /* expected monotonic time of the next expiry */
+   uint64              due_nsecs;         /* expected time of the queued callback */
+   uint32              fire_count;
+   uint32              overrun_count;
+   int64               min_latency;       /* nsecs, negative if early */
+   int64               max_latency;
+   int64               total_latency;
+   uint32              latency_histogram[OS_TIMER_LATENCY_BUCKETS];
 
 } OS_timer_internal_record_t;
 
+typedef struct 
+{
+   uint32              free;
+   char                name[OS_MAX_API_NAME];
+   uint32              creator;
+   uint32              start_time;
+   uint32              interval_time;
+   uint32              accuracy;
+   uint32              tick_usec;         /* length of a tick, 0 while the time base is not set */
+   uint32              running;
+   uint32              deleting;          /* OS_TimeBaseDelete is running */
+   uint32              callback_timer;    /* timer whose callback is running, or OS_TIMER_NONE */
+   uint64              current_tick;      /* ticks processed since the time base was created */
+   uint32              active_timers;
+   uint32              wheel[OS_TIMER_WHEEL_LEVELS][OS_TIMER_WHEEL_SLOTS];
+   uint32              due_head;          /* timers waiting for their callback */
+   uint32              due_tail;
+   OS_TimerSync_t      external_sync;
+   uint32              sync_mode;
+   int                 host_fd;
+   pthread_t           host_thread;
+#ifdef OS_VIRTUAL_TIME
+   uint64              vtime_next;        /* virtual time of the next tick, 0 while stopped */
+   uint64              vtime_interval;
+#endif
+
+} OS_timebase_internal_record_t;
+
 /****************************************************************************************
                                    GLOBAL DATA
 ****************************************************************************************/
 
-OS_timer_internal_record_t OS_timer_table[OS_MAX_TIMERS];
+/*
+** The timer table is allocated by OS_TimerAPIInit, so OS_MAX_TIMERS can be
+** raised into the thousands without growing the static image
+*/
+OS_timer_internal_record_t   *OS_timer_table = NULL;
+OS_timebase_internal_record_t OS_timebase_table[OS_MAX_TIMEBASES + 1];
 uint32           os_clock_accuracy;
 
 /*
-** The Mutex for protecting the above table
+** The Mutex for protecting the above tables
 */
 pthread_mutex_t    OS_timer_table_mut;
 
+/*
+** Broadcast with the table mutex held whenever a dispatcher is done with a callback
+*/
+pthread_cond_t     OS_timer_callback_cv;
+
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
 ****************************************************************************************/
 int32  OS_TimerAPIInit ( void )
 {
    int    i;   
+   int    j;
    int    status;
+   int    first_init;
    struct timespec clock_resolution;
    int32  return_code = OS_SUCCESS;
 
+   first_init = (OS_timer_table == NULL);
+   if ( first_init )
+   {
+      OS_timer_table = malloc(OS_MAX_TIMERS * sizeof(OS_timer_internal_record_t));
+      if ( OS_timer_table == NULL )
+      {
+         return OS_ERROR;
+      }
+   }
+   memset(OS_timer_table, 0, OS_MAX_TIMERS * sizeof(OS_timer_internal_record_t));
+
    /*
    ** Mark all timers as available
    */
    for ( i = 0; i < OS_MAX_TIMERS; i++ )
    {
-      OS_timer_table[i].free      = TRUE;
-      OS_timer_table[i].creator   = UNINITIALIZED;
+      OS_timer_table[i].free        = TRUE;
+      OS_timer_table[i].creator     = UNINITIALIZED;
+      OS_timer_table[i].wheel_level = OS_TIMER_NONE;
       strcpy(OS_timer_table[i].name,"");
 
    }
 
    /*
-   ** get the resolution of the realtime clock
+   ** Mark all time bases as available. If the API is initialized again the
+   ** internal time base keeps its dispatcher, but loses its timers.
    */
-   status = clock_getres(CLOCK_REALTIME, &clock_resolution);
+   for ( i = 0; i <= OS_MAX_TIMEBASES; i++ )
+   {
+      if ( i < OS_MAX_TIMEBASES || first_init || OS_timebase_table[i].free != FALSE )
+      {
+         OS_timebase_table[i].free      = TRUE;
+         OS_timebase_table[i].creator   = UNINITIALIZED;
+         OS_timebase_table[i].host_fd   = -1;
+         OS_timebase_table[i].external_sync = NULL;
+         OS_timebase_table[i].deleting  = FALSE;
+         strcpy(OS_timebase_table[i].name,"");
+      }
+      OS_timebase_table[i].callback_timer = OS_TIMER_NONE;
+      OS_timebase_table[i].active_timers = 0;
+      OS_timebase_table[i].due_head      = OS_TIMER_NONE;
+      OS_timebase_table[i].due_tail      = OS_TIMER_NONE;
+      for ( j = 0; j < OS_TIMER_WHEEL_LEVELS * OS_TIMER_WHEEL_SLOTS; j++ )
+      {
+         OS_timebase_table[i].wheel[j / OS_TIMER_WHEEL_SLOTS][j % OS_TIMER_WHEEL_SLOTS] = OS_TIMER_NONE;
+      }
+   }
+
+   /*
+   ** get the resolution of the clock behind the timerfds
+   */
+   status = clock_getres(CLOCK_MONOTONIC, &clock_resolution);
    if ( status < 0 )
    {
       return_code = OS_ERROR;
@@ -138,7 +313,11 @@ int32  OS_TimerAPIInit ( void )
       ** Create the Timer Table mutex
       */
       status = pthread_mutex_init((pthread_mutex_t *) & OS_timer_table_mut,NULL); 
-      if ( status < 0 )
+      if ( status == 0 )
+      {
+         status = pthread_cond_init(&OS_timer_callback_cv, NULL);
+      }
+      if ( status != 0 )
       {
          return_code = OS_ERROR;
       }
@@ -152,67 +331,1161 @@ int32  OS_TimerAPIInit ( void )
 ****************************************************************************************/
 
 /*
-** Timer Signal Handler.
-** The purpose of this function is to convert the POSIX signal number to the 
-** OSAL signal number and pass it to the User defined signal handler.
+** The timing wheel functions below are called with OS_timer_table_mut held.
+*/
+
+/*
+** Put a timer in the wheel slot for its expiry tick.
+** The level is picked from how far away the expiry is: level 0 holds the next
+** 64 ticks one per slot, level 1 the next 4096 ticks 64 per slot, and so on.
+*/
+static void OS_TimerWheelInsert(uint32 timebase_id, uint32 timer_id)
+{
+   OS_timebase_internal_record_t *timebase;
+   uint64  base;
+   uint64  expiry;
+   uint64  delta;
+   uint32  level;
+   uint32  slot;
+   uint32  head;
+
+   timebase = &OS_timebase_table[timebase_id];
+
+   /*
+   ** base is the next tick to be processed. While OS_TimeBaseTick runs that
+   ** is the tick in progress, so a timer cascaded down can still be due now.
+   */
+   base   = timebase->current_tick + 1;
+   expiry = OS_timer_table[timer_id].expiry;
+   if ( expiry < base )
+   {
+      expiry = base;
+   }
+
+   delta = expiry - base;
+   if ( delta >= OS_TIMER_WHEEL_SPAN )
+   {
+      expiry = base + OS_TIMER_WHEEL_SPAN - 1;
+      delta  = OS_TIMER_WHEEL_SPAN - 1;
+   }
+
+   level = 0;
+   while ( delta >= ((uint64)1 << (OS_TIMER_WHEEL_BITS * (level + 1))) )
+   {
+      level++;
+   }
+   slot = (uint32)(expiry >> (OS_TIMER_WHEEL_BITS * level)) & OS_TIMER_WHEEL_MASK;
+
+   head = timebase->wheel[level][slot];
+   OS_timer_table[timer_id].wheel_level = level;
+   OS_timer_table[timer_id].wheel_slot  = slot;
+   OS_timer_table[timer_id].prev        = OS_TIMER_NONE;
+   OS_timer_table[timer_id].next        = head;
+   if ( head != OS_TIMER_NONE )
+   {
+      OS_timer_table[head].prev = timer_id;
+   }
+   timebase->wheel[level][slot] = timer_id;
+}
+
+/*
+** Take a timer out of the wheel, if it is in it
+*/
+static void OS_TimerWheelRemove(uint32 timebase_id, uint32 timer_id)
+{
+   OS_timer_internal_record_t *timer;
+
+   timer = &OS_timer_table[timer_id];
+   if ( timer->wheel_level == OS_TIMER_NONE )
+   {
+      return;
+   }
+
+   if ( timer->prev != OS_TIMER_NONE )
+   {
+      OS_timer_table[timer->prev].next = timer->next;
+   }
+   else
+   {
+      OS_timebase_table[timebase_id].wheel[timer->wheel_level][timer->wheel_slot] = timer->next;
+   }
+   if ( timer->next != OS_TIMER_NONE )
+   {
+      OS_timer_table[timer->next].prev = timer->prev;
+   }
+
+   timer->wheel_level = OS_TIMER_NONE;
+}
+
+/*
+** Take a timer off the due list of its time base, if it is on it
+*/
+static void OS_TimerDueRemove(uint32 timebase_id, uint32 timer_id)
+{
+   OS_timer_internal_record_t *timer;
+
+   timer = &OS_timer_table[timer_id];
+   if ( timer->fire_pending == FALSE )
+   {
+      return;
+   }
+
+   if ( timer->due_prev != OS_TIMER_NONE )
+   {
+      OS_timer_table[timer->due_prev].due_next = timer->due_next;
+   }
+   else
+   {
+      OS_timebase_table[timebase_id].due_head = timer->due_next;
+   }
+   if ( timer->due_next != OS_TIMER_NONE )
+   {
+      OS_timer_table[timer->due_next].due_prev = timer->due_prev;
+   }
+   else
+   {
+      OS_timebase_table[timebase_id].due_tail = timer->due_prev;
+   }
+
+   timer->fire_pending = FALSE;
+}
+
+/*
+** Monotonic time in nanoseconds, for the timer statistics
+*/
+static uint64 OS_TimerNow(void)
+{
+   uint64 now = 0;
+
+   OS_GetMonotonicTime(&now);
+   return now;
+}
+
+/*
+** Reset the callback statistics of a timer
+*/
+static void OS_TimerClearStats(uint32 timer_id)
+{
+   OS_timer_table[timer_id].fire_count    = 0;
+   OS_timer_table[timer_id].overrun_count = 0;
+   OS_timer_table[timer_id].min_latency   = 0;
+   OS_timer_table[timer_id].max_latency   = 0;
+   OS_timer_table[timer_id].total_latency = 0;
+   memset(OS_timer_table[timer_id].latency_histogram, 0, sizeof(OS_timer_table[timer_id].latency_histogram));
+}
+
+/*
+** Account one callback of a timer that is about to be called at time now.
+** A callback that runs early is recorded with a negative latency, and counted
+** in the first bucket of the histogram.
+*/
+static void OS_TimerRecordLatency(OS_timer_internal_record_t *timer, uint64 now)
+{
+   int64   latency;
+   uint64  late;
+   uint32  usecs;
+   uint32  bucket;
+
+   latency = (int64)(now - timer->due_nsecs);
+
+   if ( timer->fire_count == 0 || latency < timer->min_latency )
+   {
+      timer->min_latency = latency;
+   }
+   if ( latency > timer->max_latency )
+   {
+      timer->max_latency = latency;
+   }
+   timer->total_latency += latency;
+   timer->fire_count++;
+
+   late   = (latency > 0) ? (uint64)latency : 0;
+   usecs  = (late / 1000 > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)(late / 1000);
+   bucket = 0;
+   while ( usecs != 0 && bucket < OS_TIMER_LATENCY_BUCKETS - 1 )
+   {
+      usecs >>= 1;
+      bucket++;
+   }
+   timer->latency_histogram[bucket]++;
+}
+
+/*
+** Convert the start and interval times of a timer to ticks of its time
+** base and put it in the wheel. Timers on a time base that has not been
+** set yet wait until OS_TimeBaseSet.
+*/
+static void OS_TimerArm(uint32 timer_id)
+{
+   OS_timer_internal_record_t    *timer;
+   OS_timebase_internal_record_t *timebase;
+   uint32                         tick_usec;
+
+   timer    = &OS_timer_table[timer_id];
+   timebase = &OS_timebase_table[timer->timebase_id];
+
+   OS_TimerWheelRemove(timer->timebase_id, timer_id);
+
+   tick_usec = timebase->tick_usec;
+   if ( timer->active == FALSE || tick_usec == 0 )
+   {
+      return;
+   }
+
+   /*
+   ** Round up, and count from the next tick rather than from now: the time
+   ** base may be anywhere in its current tick, so the next tick can come at
+   ** any moment. This way a timer never fires early, and at worst one tick late.
+   */
+   timer->expiry         = timebase->current_tick + 1 + ((timer->start_time + tick_usec - 1) / tick_usec);
+   timer->interval_ticks = (timer->interval_time + tick_usec - 1) / tick_usec;
+   timer->next_due_nsecs = OS_TimerNow() + (timer->start_time * 1000);
+
+   OS_TimerWheelInsert(timer->timebase_id, timer_id);
+}
+
+/*
+** Stop a timer: out of the wheel and off the due list
+*/
+static void OS_TimerDisarm(uint32 timer_id)
+{
+   OS_timer_internal_record_t *timer;
+
+   timer = &OS_timer_table[timer_id];
+
+   OS_TimerWheelRemove(timer->timebase_id, timer_id);
+   OS_TimerDueRemove(timer->timebase_id, timer_id);
+   if ( timer->active == TRUE )
+   {
+      timer->active = FALSE;
+      OS_timebase_table[timer->timebase_id].active_timers--;
+   }
+}
+
+/*
+** Process one tick of a time base: cascade the higher wheel levels when
+** the lower level wraps, then move the timers of the current level 0
+** slot to the due list, re-inserting the periodic ones.
+** current_tick only moves on once the tick is done, so that the timers
+** cascaded down are placed relative to the tick being processed.
 */
-void OS_TimerSignalHandler(int signum)
+static void OS_TimeBaseTick(uint32 timebase_id)
 {
+   OS_timebase_internal_record_t *timebase;
+   uint64  tick;
+   uint32  level;
+   uint32  slot;
    uint32  timer_id;
+   uint32  next;
+
+   timebase = &OS_timebase_table[timebase_id];
+   tick = timebase->current_tick + 1;
+
+   for ( level = 1; level < OS_TIMER_WHEEL_LEVELS; level++ )
+   {
+      /*
+      ** Only cascade when all the levels below have wrapped round
+      */
+      if ( ((tick >> (OS_TIMER_WHEEL_BITS * (level - 1))) & OS_TIMER_WHEEL_MASK) != 0 )
+      {
+         break;
+      }
+
+      slot = (uint32)(tick >> (OS_TIMER_WHEEL_BITS * level)) & OS_TIMER_WHEEL_MASK;
+      timer_id = timebase->wheel[level][slot];
+      timebase->wheel[level][slot] = OS_TIMER_NONE;
+      while ( timer_id != OS_TIMER_NONE )
+      {
+         next = OS_timer_table[timer_id].next;
+         OS_timer_table[timer_id].wheel_level = OS_TIMER_NONE;
+         OS_TimerWheelInsert(timebase_id, timer_id);
+         timer_id = next;
+      }
+   }
+
+   slot = (uint32)tick & OS_TIMER_WHEEL_MASK;
+   timer_id = timebase->wheel[0][slot];
+   timebase->wheel[0][slot] = OS_TIMER_NONE;
+   while ( timer_id != OS_TIMER_NONE )
+   {
+      next = OS_timer_table[timer_id].next;
+      OS_timer_table[timer_id].wheel_level = OS_TIMER_NONE;
+
+      /*
+      ** A timer due further out than the wheel spans went round again
+      */
+      if ( OS_timer_table[timer_id].expiry > tick )
+      {
+         OS_TimerWheelInsert(timebase_id, timer_id);
+         timer_id = next;
+         continue;
+      }
+
+      /*
+      ** A timer that is still waiting for its last callback is not queued
+      ** twice; the missed expiry is skipped
+      */
+      if ( OS_timer_table[timer_id].fire_pending == FALSE )
+      {
+         OS_timer_table[timer_id].due_nsecs    = OS_timer_table[timer_id].next_due_nsecs;
+         OS_timer_table[timer_id].fire_pending = TRUE;
+         OS_timer_table[timer_id].due_next     = OS_TIMER_NONE;
+         OS_timer_table[timer_id].due_prev     = timebase->due_tail;
+         if ( timebase->due_tail != OS_TIMER_NONE )
+         {
+            OS_timer_table[timebase->due_tail].due_next = timer_id;
+         }
+         else
+         {
+            timebase->due_head = timer_id;
+         }
+         timebase->due_tail = timer_id;
+      }
+      else
+      {
+         OS_timer_table[timer_id].overrun_count++;
+      }
 
-   timer_id = OS_STARTING_SIGNAL - signum;
+      /*
+      ** Re-arm from the expiry rather than from this tick, so that a late
+      ** tick does not push back all the later ones
+      */
+      if ( OS_timer_table[timer_id].interval_ticks > 0 )
+      {
+         OS_timer_table[timer_id].expiry += OS_timer_table[timer_id].interval_ticks;
+         OS_timer_table[timer_id].next_due_nsecs +=
+            OS_timer_table[timer_id].interval_ticks * timebase->tick_usec * 1000;
+         OS_TimerWheelInsert(timebase_id, timer_id);
+      }
+      else
+      {
+         OS_timer_table[timer_id].active = FALSE;
+         timebase->active_timers--;
+      }
+
+      timer_id = next;
+   }
+
+   timebase->current_tick = tick;
+}
+
+#ifdef OS_VIRTUAL_TIME
+/*
+** OS_TimeBaseWait for a time base on the virtual clock: wait until the clock
+** reaches the next tick, or until OS_TimeBaseProgram changes the schedule.
+*/
+static int32 OS_TimeBaseWaitVirtual(uint32 timebase_id, uint64 *ticks)
+{
+   OS_timebase_internal_record_t *timebase;
+   struct timespec     next_tick;
+   uint64              now;
+   sigset_t            previous;
+   sigset_t            mask;
+
+   timebase = &OS_timebase_table[timebase_id];
+
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+   OS_GetMonotonicTime(&now);
+   if ( timebase->vtime_next == 0 || now < timebase->vtime_next )
+   {
+      next_tick.tv_sec  = timebase->vtime_next / 1000000000;
+      next_tick.tv_nsec = timebase->vtime_next % 1000000000;
+
+      pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+      OS_VirtualTimeCondTimedWait(timebase, &OS_timer_table_mut,
+                                  (timebase->vtime_next == 0) ? NULL : &next_tick);
+      pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
 
-   if ( timer_id  < OS_MAX_TIMERS )
+      OS_GetMonotonicTime(&now);
+   }
+
+   if ( timebase->vtime_next != 0 && now >= timebase->vtime_next )
    {
-      if ( OS_timer_table[timer_id].free == FALSE )
+      *ticks = 1;
+      if ( timebase->vtime_interval == 0 )
+      {
+         timebase->vtime_next = 0;
+      }
+      else
       {
-         (OS_timer_table[timer_id].callback_ptr)(timer_id);
+         *ticks += (now - timebase->vtime_next) / timebase->vtime_interval;
+         timebase->vtime_next += *ticks * timebase->vtime_interval;
       }
    }
 
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   return OS_SUCCESS;
 }
- 
-/******************************************************************************
- **  Function:  OS_UsecToTimespec
- **
- **  Purpose:  Convert Microseconds to a POSIX timespec structure.
- **
- */
-void OS_UsecToTimespec(uint32 usecs, struct timespec *time_spec)
+#endif
+
+/*
+** Wait for the next pulse of a time base and return the number of ticks
+** it stands for in *ticks, which may be zero. Returns OS_ERROR once the
+** sync source has failed or reached end of file, and will not pulse again.
+** This is where the dispatcher can be cancelled.
+*/
+static int32 OS_TimeBaseWait(uint32 timebase_id, uint64 *ticks)
 {
-	
-   if ( usecs < 1000000 )
+   OS_timebase_internal_record_t *timebase;
+   uint8               bytes[64];
+   int32               sync_ticks;
+   ssize_t             status;
+
+   timebase = &OS_timebase_table[timebase_id];
+   *ticks   = 0;
+
+#ifdef OS_VIRTUAL_TIME
+   if ( timebase->sync_mode == OS_TIMEBASE_SYNC_TIMERFD )
    {
-      time_spec->tv_nsec = (usecs * 1000);
-      time_spec->tv_sec = 0;
+      return OS_TimeBaseWaitVirtual(timebase_id, ticks);
+   }
+
+   /*
+   ** Outside pulses do not come on the virtual clock, so let it run while waiting
+   */
+   OS_VirtualTimeSetIdle(TRUE);
+#endif
+
+   pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+   switch ( timebase->sync_mode )
+   {
+      case OS_TIMEBASE_SYNC_FUNCTION:
+         sync_ticks = (timebase->external_sync)(timebase_id);
+         status     = sizeof(*ticks);
+         if ( sync_ticks > 0 )
+         {
+            *ticks = sync_ticks;
+         }
+         break;
+
+      case OS_TIMEBASE_SYNC_FD_BYTES:
+         status = read(timebase->host_fd, bytes, sizeof(bytes));
+         if ( status > 0 )
+         {
+            *ticks = status;
+         }
+         break;
+
+      default:
+         status = read(timebase->host_fd, ticks, sizeof(*ticks));
+         if ( status != sizeof(*ticks) )
+         {
+            *ticks = 0;
+         }
+         break;
+   }
+   pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+
+#ifdef OS_VIRTUAL_TIME
+   OS_VirtualTimeSetIdle(FALSE);
+#endif
+
+   if ( status == 0 || (status < 0 && errno != EINTR && errno != EAGAIN) )
+   {
+      /*
+      ** A timerfd never gets here, but the internal time base may read
+      ** nothing after it was set again while this thread was waking up
+      */
+      return (timebase->sync_mode == OS_TIMEBASE_SYNC_TIMERFD) ? OS_SUCCESS : OS_ERROR;
+   }
+
+   return OS_SUCCESS;
+}
+
+/*
+** Time Base Dispatcher.
+** One of these threads runs for each time base. It waits for the sync source
+** (the timerfd, the external sync function or the sync fd) to pulse, advances the timing wheel by the number of expirations, and calls
+** the timers that came due one at a time with the table unlocked, so that a
+** callback may use any of the timer API, including deleting its own timer or
+** time base.
+**
+** The thread can only be cancelled while it waits on the sync source, never
+** in the middle of a callback. A sync source that fails leaves the thread
+** blocked until the time base is deleted.
+*/
+void *OS_TimeBaseDispatcher(void *arg)
+{
+   OS_timebase_internal_record_t *timebase;
+   uint32              timebase_id;
+   uint32              timer_id;
+   uint64              expirations;
+   OS_TimerCallback_t  callback_ptr;
+   OS_ArgCallback_t    arg_callback_ptr;
+   void               *callback_arg;
+   sigset_t            previous;
+   sigset_t            mask;
+
+   timebase_id = (uint32)(cpuaddr)arg;
+   timebase    = &OS_timebase_table[timebase_id];
+
+   /*
+   ** Signals are for the tasks, not for the dispatcher
+   */
+   sigfillset(&mask);
+   pthread_sigmask(SIG_BLOCK, &mask, NULL);
+   pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+
+#ifdef OS_VIRTUAL_TIME
+   pthread_cleanup_push(OS_VirtualTimeThreadEnd, NULL);
+#endif
+
+   while (1)
+   {
+      if ( OS_TimeBaseWait(timebase_id, &expirations) != OS_SUCCESS )
+      {
+#ifdef OS_VIRTUAL_TIME
+         OS_VirtualTimeSetIdle(TRUE);
+#endif
+         pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+         while (1)
+         {
+            poll(NULL, 0, -1);
+         }
+      }
+
+      if ( expirations == 0 )
+      {
+         continue;
+      }
+
+      OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+      while ( expirations > 0 )
+      {
+         OS_TimeBaseTick(timebase_id);
+         --expirations;
+      }
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+      while (1)
+      {
+         OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+         timer_id = timebase->due_head;
+         if ( timer_id == OS_TIMER_NONE ||
+              timebase->free == TRUE ||
+              !pthread_equal(timebase->host_thread, pthread_self()) )
+         {
+            OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+            break;
+         }
+
+         OS_TimerDueRemove(timebase_id, timer_id);
+         OS_TimerRecordLatency(&OS_timer_table[timer_id], OS_TimerNow());
+         callback_ptr     = OS_timer_table[timer_id].callback_ptr;
+         arg_callback_ptr = OS_timer_table[timer_id].arg_callback_ptr;
+         callback_arg     = OS_timer_table[timer_id].callback_arg;
+         timebase->callback_timer = timer_id;
+
+         OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+         if ( callback_ptr != NULL )
+         {
+            (callback_ptr)(timer_id);
+         }
+         else if ( arg_callback_ptr != NULL )
+         {
+            (arg_callback_ptr)(timer_id, callback_arg);
+         }
+
+         /*
+         ** OS_TimerDelete may be waiting for this callback to finish
+         */
+         OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+         timebase->callback_timer = OS_TIMER_NONE;
+#ifdef OS_VIRTUAL_TIME
+         OS_VirtualTimeCondBroadcast(&OS_timer_callback_cv);
+#else
+         pthread_cond_broadcast(&OS_timer_callback_cv);
+#endif
+         OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+      }
+
+      OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+      /*
+      ** If a callback deleted this time base, nobody is going to join this thread
+      */
+      if ( timebase->free == TRUE ||
+           !pthread_equal(timebase->host_thread, pthread_self()) )
+      {
+         OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+         pthread_detach(pthread_self());
+         break;
+      }
+
+      /*
+      ** The internal time base only ticks while it has work to do
+      */
+      if ( timebase_id == OS_TIMER_TIMEBASE && timebase->running == TRUE &&
+           timebase->active_timers == 0 && timebase->due_head == OS_TIMER_NONE )
+      {
+         OS_TimeBaseProgram(timebase_id, 0, 0);
+         timebase->running = FALSE;
+      }
+
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+   }
+
+#ifdef OS_VIRTUAL_TIME
+   pthread_cleanup_pop(1);
+#endif
+
+   return NULL;
+}
+
+/*
+** Start the dispatcher thread of a time base whose table entry has been
+** reserved. The time base is driven by its external sync function if it
+** has one, by sync_fd if that is not -1, and otherwise by a new timerfd
+** of its own. When the process is allowed to, the dispatcher
+** runs at OS_TIMER_DISPATCH_PRIORITY, like an OSAL task of that priority.
+*/
+static int32 OS_TimeBaseStart(uint32 timebase_id, int sync_fd)
+{
+   int                 fd;
+   int                 status;
+   uint32              i;
+   uint32              sync_mode;
+   struct stat         fd_stats;
+   pthread_t           thread;
+   pthread_attr_t      thread_attr;
+   struct sched_param  priority_holder;
+   sigset_t            previous;
+   sigset_t            mask;
+
+   if ( OS_timebase_table[timebase_id].external_sync != NULL )
+   {
+      fd        = -1;
+      sync_mode = OS_TIMEBASE_SYNC_FUNCTION;
+   }
+   else if ( sync_fd >= 0 )
+   {
+      if ( fstat(sync_fd, &fd_stats) < 0 )
+      {
+         return OS_TIMER_ERR_INVALID_ARGS;
+      }
+
+      /*
+      ** Streams deliver the pulses as bytes; anything else, such as an
+      ** eventfd or timerfd, is read as a 64 bit count of pulses
+      */
+      fd = sync_fd;
+      if ( S_ISFIFO(fd_stats.st_mode) || S_ISSOCK(fd_stats.st_mode) || S_ISCHR(fd_stats.st_mode) )
+      {
+         sync_mode = OS_TIMEBASE_SYNC_FD_BYTES;
+      }
+      else
+      {
+         sync_mode = OS_TIMEBASE_SYNC_FD_COUNT;
+      }
+   }
+   else
+   {
+      fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+      if ( fd < 0 )
+      {
+         return OS_TIMER_ERR_UNAVAILABLE;
+      }
+      sync_mode = OS_TIMEBASE_SYNC_TIMERFD;
+   }
+
+   OS_timebase_table[timebase_id].start_time    = 0;
+   OS_timebase_table[timebase_id].interval_time = 0;
+   OS_timebase_table[timebase_id].accuracy      = os_clock_accuracy;
+   OS_timebase_table[timebase_id].tick_usec     = 0;
+   OS_timebase_table[timebase_id].running       = FALSE;
+   OS_timebase_table[timebase_id].deleting      = FALSE;
+   OS_timebase_table[timebase_id].callback_timer = OS_TIMER_NONE;
+   OS_timebase_table[timebase_id].current_tick  = 0;
+   OS_timebase_table[timebase_id].active_timers = 0;
+   OS_timebase_table[timebase_id].due_head      = OS_TIMER_NONE;
+   OS_timebase_table[timebase_id].due_tail      = OS_TIMER_NONE;
+   for ( i = 0; i < OS_TIMER_WHEEL_LEVELS * OS_TIMER_WHEEL_SLOTS; i++ )
+   {
+      OS_timebase_table[timebase_id].wheel[i / OS_TIMER_WHEEL_SLOTS][i % OS_TIMER_WHEEL_SLOTS] = OS_TIMER_NONE;
+   }
+   OS_timebase_table[timebase_id].sync_mode = sync_mode;
+   OS_timebase_table[timebase_id].host_fd   = fd;
+
+   pthread_attr_init(&thread_attr);
+   if ( geteuid() == 0 )
+   {
+      memset(&priority_holder, 0, sizeof(priority_holder));
+      priority_holder.sched_priority = OS_PriorityRemap(OS_TIMER_DISPATCH_PRIORITY);
+      pthread_attr_setinheritsched(&thread_attr, PTHREAD_EXPLICIT_SCHED);
+      pthread_attr_setschedpolicy(&thread_attr, SCHED_FIFO);
+      pthread_attr_setschedparam(&thread_attr, &priority_holder);
+   }
+
+#ifdef OS_VIRTUAL_TIME
+   OS_timebase_table[timebase_id].vtime_next     = 0;
+   OS_timebase_table[timebase_id].vtime_interval = 0;
+   OS_VirtualTimeThreadStart();
+#endif
+
+   /*
+   ** The dispatcher checks host_thread to tell whether it still owns the
+   ** time base, so keep the table locked until it has been stored
+   */
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+   status = pthread_create(&thread, &thread_attr, OS_TimeBaseDispatcher, (void *)(cpuaddr)timebase_id);
+   pthread_attr_destroy(&thread_attr);
+   if ( status != 0 )
+   {
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+#ifdef OS_VIRTUAL_TIME
+      OS_VirtualTimeThreadEnd(NULL);
+#endif
+      if ( sync_mode == OS_TIMEBASE_SYNC_TIMERFD )
+      {
+         close(fd);
+      }
+      OS_timebase_table[timebase_id].host_fd = -1;
+      return OS_TIMER_ERR_INTERNAL;
+   }
+
+   OS_timebase_table[timebase_id].host_thread = thread;
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   return OS_SUCCESS;
+}
+
+/*
+** Program the host timer of a time base: first tick after start_time, then
+** every interval_time, in microseconds. Zero start_time stops it. Called
+** with the timer table locked.
+*/
+static int OS_TimeBaseProgram(uint32 timebase_id, uint32 start_time, uint32 interval_time)
+{
+#ifdef OS_VIRTUAL_TIME
+   OS_timebase_internal_record_t *timebase;
+   uint64              now;
+
+   timebase = &OS_timebase_table[timebase_id];
+
+   OS_GetMonotonicTime(&now);
+   timebase->vtime_next     = (start_time > 0) ? now + ((uint64)start_time * 1000) : 0;
+   timebase->vtime_interval = (uint64)interval_time * 1000;
+
+   /*
+   ** The dispatcher waits on the time base entry for the schedule to change
+   */
+   OS_VirtualTimeCondBroadcast(timebase);
+
+   return 0;
+#else
+   struct itimerspec   timeout;
+
+   OS_UsecToTimespec(start_time, &(timeout.it_value));
+   OS_UsecToTimespec(interval_time, &(timeout.it_interval));
+
+   return timerfd_settime(OS_timebase_table[timebase_id].host_fd, 0, &timeout, NULL);
+#endif
+}
+
+/******************************************************************************
+ **  Function:  OS_UsecToTimespec
+ **
+ **  Purpose:  Convert Microseconds to a POSIX timespec structure.
+ **
+ */
+void OS_UsecToTimespec(uint32 usecs, struct timespec *time_spec)
+{
+	
+   if ( usecs < 1000000 )
+   {
+      time_spec->tv_nsec = (usecs * 1000);
+      time_spec->tv_sec = 0;
+   }
+   else
+   {
+      time_spec->tv_sec = usecs / 1000000;
+      time_spec->tv_nsec = (usecs % 1000000) * 1000;
+   }
+	
+}
+
+/******************************************************************************
+ **  Function:  OS_TimespecToUsec
+ **
+ **  Purpose:  Convert a POSIX timespec structure to microseconds
+ **
+ */
+void OS_TimespecToUsec(struct timespec time_spec, uint32 *usecs)
+{
+   /*
+    ** Need to account for maximum number of seconds that will fit in the
+    ** 32 bit usec integer
+    */
+   if ( time_spec.tv_sec > MAX_SECS_IN_USEC )
+   {
+      time_spec.tv_sec = MAX_SECS_IN_USEC;
+   }
+   *usecs = (time_spec.tv_sec * 1000000 ) + (time_spec.tv_nsec / 1000 );
+}
+
+
+
+
+/****************************************************************************************
+                                   Time Base API
+****************************************************************************************/
+
+/*
+** Reserve a time base entry and start its dispatcher, for both kinds of
+** OS_TimeBaseCreate
+*/
+static int32 OS_TimeBaseCreateCommon(uint32 *timer_id, const char *timebase_name,
+                                     OS_TimerSync_t external_sync, int sync_fd)
+{
+   uint32              possible_tbid;
+   uint32              i;
+   int32               status;
+   sigset_t            previous;
+   sigset_t            mask;
+
+   if ( timer_id == NULL || timebase_name == NULL )
+   {
+      return OS_INVALID_POINTER;
+   }
+
+   if ( strlen(timebase_name) >= OS_MAX_API_NAME )
+   {
+      return OS_ERR_NAME_TOO_LONG;
+   }
+
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+   for ( possible_tbid = 0; possible_tbid < OS_MAX_TIMEBASES; possible_tbid++ )
+   {
+      if ( OS_timebase_table[possible_tbid].free == TRUE )
+         break;
+   }
+
+   if ( possible_tbid >= OS_MAX_TIMEBASES )
+   {
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+      return OS_ERR_NO_FREE_IDS;
+   }
+
+   for ( i = 0; i < OS_MAX_TIMEBASES; i++ )
+   {
+      if ( OS_timebase_table[i].free == FALSE &&
+           strcmp(timebase_name, OS_timebase_table[i].name) == 0 )
+      {
+         OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+         return OS_ERR_NAME_TAKEN;
+      }
+   }
+
+   /*
+   ** Set the free flag to false to make sure no other task grabs it
+   */
+   OS_timebase_table[possible_tbid].free          = FALSE;
+   OS_timebase_table[possible_tbid].creator       = OS_FindCreator();
+   strcpy(OS_timebase_table[possible_tbid].name, timebase_name);
+   OS_timebase_table[possible_tbid].external_sync = external_sync;
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   status = OS_TimeBaseStart(possible_tbid, sync_fd);
+   if ( status != OS_SUCCESS )
+   {
+      OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+      OS_timebase_table[possible_tbid].free          = TRUE;
+      OS_timebase_table[possible_tbid].creator       = UNINITIALIZED;
+      OS_timebase_table[possible_tbid].external_sync = NULL;
+      strcpy(OS_timebase_table[possible_tbid].name, "");
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+      return status;
+   }
+
+   *timer_id = possible_tbid;
+
+   return OS_SUCCESS;
+
+}/* end OS_TimeBaseCreateCommon */
+
+/******************************************************************************
+**  Function:  OS_TimeBaseCreate
+**
+**  Purpose:  Create a new OSAL Time Base. The time base starts its own
+**            dispatcher thread, which services every timer added to it
+**            with OS_TimerAdd.
+**
+**            With an external_sync function the dispatcher calls it in a
+**            loop instead of waiting on a host timer. The function must
+**            block until the next pulse, in a call that is a cancellation
+**            point (read, poll, nanosleep, ...), and return the number of
+**            ticks that went by; zero or less means no tick. The time base
+**            still needs OS_TimeBaseSet to give the nominal length of a tick
+**            that its timers are counted in.
+**
+**  Returns: OS_INVALID_POINTER if timer_id or timebase_name are NULL
+**           OS_ERR_NAME_TOO_LONG if the name is too long to be stored
+**           OS_ERR_NO_FREE_IDS if there are no more free time base Ids
+**           OS_ERR_NAME_TAKEN if there is already a time base with the same name
+**           OS_TIMER_ERR_UNAVAILABLE if the host timer could not be created
+**           OS_TIMER_ERR_INTERNAL if the dispatcher thread could not be started
+**           OS_SUCCESS if success
+*/
+int32 OS_TimeBaseCreate(uint32 *timer_id, const char *timebase_name, OS_TimerSync_t external_sync)
+{
+   return OS_TimeBaseCreateCommon(timer_id, timebase_name, external_sync, -1);
+
+}/* end OS_TimeBaseCreate */
+
+/******************************************************************************
+**  Function:  OS_TimeBaseCreateFd
+**
+**  Purpose:  Create a new OSAL Time Base that is driven by a file descriptor
+**            instead of a host timer: an eventfd or timerfd, whose 64 bit
+**            count is the number of ticks, or a pipe, socket or character
+**            device, where every byte read is one tick. The time base does
+**            not own sync_fd and leaves it open when it is deleted. If the
+**            descriptor fails or reaches end of file the time base stops
+**            ticking.
+**
+**            OS_TimeBaseSet gives the nominal length of a tick, which the
+**            timers on the time base are counted in.
+**
+**  Returns: OS_INVALID_POINTER if timer_id or timebase_name are NULL
+**           OS_TIMER_ERR_INVALID_ARGS if sync_fd is not an open descriptor
+**           OS_ERR_NAME_TOO_LONG if the name is too long to be stored
+**           OS_ERR_NO_FREE_IDS if there are no more free time base Ids
+**           OS_ERR_NAME_TAKEN if there is already a time base with the same name
+**           OS_TIMER_ERR_INTERNAL if the dispatcher thread could not be started
+**           OS_SUCCESS if success
+*/
+int32 OS_TimeBaseCreateFd(uint32 *timer_id, const char *timebase_name, int32 sync_fd)
+{
+   if ( timer_id == NULL || timebase_name == NULL )
+   {
+      return OS_INVALID_POINTER;
+   }
+
+   if ( sync_fd < 0 )
+   {
+      return OS_TIMER_ERR_INVALID_ARGS;
+   }
+
+   return OS_TimeBaseCreateCommon(timer_id, timebase_name, NULL, sync_fd);
+
+}/* end OS_TimeBaseCreateFd */
+
+/******************************************************************************
+**  Function:  OS_TimeBaseSet
+**
+**  Purpose:  Program the tick of a time base. The first tick comes start_time
+**            usecs from now, then one every interval_time usecs. A start_time
+**            of zero stops the time base.
+**
+**            Timers on the time base count in ticks of interval_time, or of
+**            start_time for a one-shot time base, and are re-armed against
+**            the new tick here.
+**
+**  Returns: OS_ERR_INVALID_ID if the id passed in is not a valid time base
+**           OS_TIMER_ERR_INTERNAL if the host timer could not be programmed
+**           OS_SUCCESS if success
+*/
+int32 OS_TimeBaseSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
+{
+   uint32             i;
+   int                status;
+   sigset_t           previous;
+   sigset_t           mask;
+
+   if ( timer_id >= OS_MAX_TIMEBASES || OS_timebase_table[timer_id].free == TRUE ||
+        OS_timebase_table[timer_id].deleting == TRUE )
+   {
+      return OS_ERR_INVALID_ID;
+   }
+
+   /*
+   ** Round up the accuracy of the start time and interval times 
+   */
+   if (( start_time > 0 ) && ( start_time < os_clock_accuracy ))
+   {
+      start_time = os_clock_accuracy;
+   }
+ 
+   if (( interval_time > 0) && ( interval_time < os_clock_accuracy ))
+   {
+      interval_time = os_clock_accuracy;
+   }
+
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+   OS_timebase_table[timer_id].start_time    = start_time;
+   OS_timebase_table[timer_id].interval_time = interval_time;
+   OS_timebase_table[timer_id].running       = (start_time > 0) ? TRUE : FALSE;
+   if ( interval_time > 0 )
+   {
+      OS_timebase_table[timer_id].accuracy  = interval_time;
+      OS_timebase_table[timer_id].tick_usec = interval_time;
+   }
+   else
+   {
+      OS_timebase_table[timer_id].accuracy  = os_clock_accuracy;
+      OS_timebase_table[timer_id].tick_usec = start_time;
+   }
+
+   for ( i = 0; i < OS_MAX_TIMERS; i++ )
+   {
+      if ( OS_timer_table[i].free == FALSE && OS_timer_table[i].timebase_id == timer_id )
+      {
+         OS_timer_table[i].accuracy = OS_timebase_table[timer_id].accuracy;
+         OS_TimerArm(i);
+      }
+   }
+
+   /*
+   ** A time base driven from outside ticks whenever its sync source says so
+   */
+   status = 0;
+   if ( OS_timebase_table[timer_id].sync_mode == OS_TIMEBASE_SYNC_TIMERFD )
+   {
+      status = OS_TimeBaseProgram(timer_id, start_time, interval_time);
+   }
+
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   if ( status < 0 )
+   {
+      return OS_TIMER_ERR_INTERNAL;
+   }
+
+   return OS_SUCCESS;
+
+}/* end OS_TimeBaseSet */
+
+/******************************************************************************
+**  Function:  OS_TimeBaseDelete
+**
+**  Purpose:  Stop the dispatcher of a time base and release it. Timers that
+**            are still attached to the time base are deleted with it.
+**            This may be called from a callback running on the time base.
+**            If several tasks delete the same time base at once, only the
+**            first one stops it; the others get OS_ERR_INVALID_ID.
+**
+**  Returns: OS_ERR_INVALID_ID if the id passed in is not a valid time base,
+**           or it is already being deleted
+**           OS_SUCCESS if success
+*/
+int32 OS_TimeBaseDelete(uint32 timer_id)
+{
+   uint32     i;
+   int        fd;
+   pthread_t  thread;
+   sigset_t   previous;
+   sigset_t   mask;
+
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+   if ( timer_id >= OS_MAX_TIMEBASES || OS_timebase_table[timer_id].free == TRUE ||
+        OS_timebase_table[timer_id].deleting == TRUE )
+   {
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+      return OS_ERR_INVALID_ID;
+   }
+
+   /*
+   ** Only this caller may cancel and join the dispatcher
+   */
+   OS_timebase_table[timer_id].deleting = TRUE;
+   thread = OS_timebase_table[timer_id].host_thread;
+
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   /*
+   ** When called from one of its own callbacks the dispatcher notices the
+   ** deletion once the callback returns, and exits by itself
+   */
+   if ( !pthread_equal(thread, pthread_self()) )
+   {
+      pthread_cancel(thread);
+      pthread_join(thread, NULL);
+   }
+
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+   for ( i = 0; i < OS_MAX_TIMERS; i++ )
+   {
+      if ( OS_timer_table[i].free == FALSE && OS_timer_table[i].timebase_id == timer_id )
+      {
+         OS_TimerDisarm(i);
+         OS_timer_table[i].free    = TRUE;
+         OS_timer_table[i].creator = UNINITIALIZED;
+         strcpy(OS_timer_table[i].name, "");
+      }
    }
-   else
+
+   fd = -1;
+   if ( OS_timebase_table[timer_id].sync_mode == OS_TIMEBASE_SYNC_TIMERFD )
    {
-      time_spec->tv_sec = usecs / 1000000;
-      time_spec->tv_nsec = (usecs % 1000000) * 1000;
+      fd = OS_timebase_table[timer_id].host_fd;
    }
-	
-}
+   OS_timebase_table[timer_id].host_fd       = -1;
+   OS_timebase_table[timer_id].external_sync = NULL;
+   OS_timebase_table[timer_id].running = FALSE;
+   OS_timebase_table[timer_id].deleting = FALSE;
+   OS_timebase_table[timer_id].free    = TRUE;
+   OS_timebase_table[timer_id].creator = UNINITIALIZED;
+   strcpy(OS_timebase_table[timer_id].name, "");
 
-/******************************************************************************
- **  Function:  OS_TimespecToUsec
- **
- **  Purpose:  Convert a POSIX timespec structure to microseconds
- **
- */
-void OS_TimespecToUsec(struct timespec time_spec, uint32 *usecs)
-{
-   /*
-    ** Need to account for maximum number of seconds that will fit in the
-    ** 32 bit usec integer
-    */
-   if ( time_spec.tv_sec > MAX_SECS_IN_USEC )
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   if ( fd >= 0 )
    {
-      time_spec.tv_sec = MAX_SECS_IN_USEC;
+      close(fd);
    }
-   *usecs = (time_spec.tv_sec * 1000000 ) + (time_spec.tv_nsec / 1000 );
-}
 
+   return OS_SUCCESS;
+
+}/* end OS_TimeBaseDelete */
+
+/***********************************************************************************
+**
+**    Name: OS_TimeBaseGetIdByName
+**
+**    Purpose: This function tries to find a Time Base Id given the name 
+**             The id is returned through timer_id
+**
+**    Returns: OS_INVALID_POINTER if timer_id or timebase_name are NULL pointers
+**             OS_ERR_NAME_TOO_LONG if the name given is to long to have been stored
+**             OS_ERR_NAME_NOT_FOUND if the name was not found in the table
+**             OS_SUCCESS if success
+**             
+*/
+int32 OS_TimeBaseGetIdByName (uint32 *timer_id, const char *timebase_name)
+{
+    uint32 i;
+
+    if (timer_id == NULL || timebase_name == NULL)
+    {
+        return OS_INVALID_POINTER;
+    }
+
+    if (strlen(timebase_name) >= OS_MAX_API_NAME)
+    {
+        return OS_ERR_NAME_TOO_LONG;
+    }
+
+    for (i = 0; i < OS_MAX_TIMEBASES; i++)
+    {
+        if (OS_timebase_table[i].free != TRUE &&
+                (strcmp (OS_timebase_table[i].name , (char*) timebase_name) == 0))
+        {
+            *timer_id = i;
+            return OS_SUCCESS;
+        }
+    }
+   
+    return OS_ERR_NAME_NOT_FOUND;
+    
+}/* end OS_TimeBaseGetIdByName */
 
 
 /****************************************************************************************
@@ -220,42 +1493,25 @@ void OS_TimespecToUsec(struct timespec time_spec, uint32 *usecs)
 ****************************************************************************************/
 
 /******************************************************************************
-**  Function:  OS_TimerCreate
+**  Function:  OS_TimerAllocate
 **
-**  Purpose:  Create a new OSAL Timer
+**  Purpose:  Reserve a timer table entry and attach it to a time base.
+**            Common code for OS_TimerCreate and OS_TimerAdd.
 **
-**  Arguments:
-**
-**  Return:
+**  Return:   OS_ERR_NO_FREE_IDS, OS_ERR_NAME_TAKEN or OS_SUCCESS
 */
-int32 OS_TimerCreate(uint32 *timer_id, const char *timer_name, uint32 *clock_accuracy, OS_TimerCallback_t  callback_ptr)
+static int32 OS_TimerAllocate(uint32 *timer_id, const char *timer_name, uint32 timebase_id)
 {
    uint32    possible_tid;
    int32     i;
    sigset_t  previous;
    sigset_t  mask;
 
-   int                status;
-   struct  sigaction  sig_act;
-   struct  sigevent   evp;
-
-   if ( timer_id == NULL || timer_name == NULL || clock_accuracy == NULL)
-   {
-        return OS_INVALID_POINTER;
-   }
-
-   /* 
-   ** we don't want to allow names too long
-   ** if truncated, two names might be the same 
-   */
-   if (strlen(timer_name) > OS_MAX_API_NAME)
+   if ( OS_timer_table == NULL )
    {
-      return OS_ERR_NAME_TOO_LONG;
+      return OS_ERR_NO_FREE_IDS;
    }
 
-   /* 
-   ** Check Parameters 
-   */
    OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
     
    for(possible_tid = 0; possible_tid < OS_MAX_TIMERS; possible_tid++)
@@ -264,7 +1520,6 @@ int32 OS_TimerCreate(uint32 *timer_id, const char *timer_name, uint32 *clock_acc
          break;
    }
 
-
    if( possible_tid >= OS_MAX_TIMERS || OS_timer_table[possible_tid].free != TRUE)
    {
         OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
@@ -284,60 +1539,120 @@ int32 OS_TimerCreate(uint32 *timer_id, const char *timer_name, uint32 *clock_acc
        }
    }
 
+   OS_timer_table[possible_tid].creator          = OS_FindCreator();
+   strncpy(OS_timer_table[possible_tid].name, timer_name, OS_MAX_API_NAME);
+   OS_timer_table[possible_tid].start_time       = 0;
+   OS_timer_table[possible_tid].interval_time    = 0;
+   OS_timer_table[possible_tid].accuracy         = OS_timebase_table[timebase_id].accuracy;
+   OS_timer_table[possible_tid].callback_ptr     = NULL;
+   OS_timer_table[possible_tid].arg_callback_ptr = NULL;
+   OS_timer_table[possible_tid].callback_arg     = NULL;
+   OS_timer_table[possible_tid].timebase_id      = timebase_id;
+   OS_timer_table[possible_tid].active           = FALSE;
+   OS_timer_table[possible_tid].expiry           = 0;
+   OS_timer_table[possible_tid].interval_ticks   = 0;
+   OS_timer_table[possible_tid].wheel_level      = OS_TIMER_NONE;
+   OS_timer_table[possible_tid].fire_pending     = FALSE;
+   OS_TimerClearStats(possible_tid);
+   OS_timer_table[possible_tid].free             = FALSE;
+
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   *timer_id = possible_tid;
+
+   return OS_SUCCESS;
+}
+
+/******************************************************************************
+**  Function:  OS_TimerCreate
+**
+**  Purpose:  Create a new OSAL Timer. All of these timers share one internal
+**            time base, started by the first OS_TimerCreate, that ticks every
+**            OS_TIMER_TICK_USEC while any of them is armed. That tick is the
+**            resolution of the timer and is returned in clock_accuracy.
+**
+**  Arguments:
+**
+**  Return:
+*/
+int32 OS_TimerCreate(uint32 *timer_id, const char *timer_name, uint32 *clock_accuracy, OS_TimerCallback_t  callback_ptr)
+{
+   uint32    possible_tid;
+   uint32    start_timebase;
+   int32     status;
+   sigset_t  previous;
+   sigset_t  mask;
+
+   if ( timer_id == NULL || timer_name == NULL || clock_accuracy == NULL)
+   {
+        return OS_INVALID_POINTER;
+   }
+
+   /* 
+   ** we don't want to allow names too long
+   ** if truncated, two names might be the same 
+   */
+   if (strlen(timer_name) >= OS_MAX_API_NAME)
+   {
+      return OS_ERR_NAME_TOO_LONG;
+   }
+
    /*
    ** Verify callback parameter
    */
    if (callback_ptr == NULL ) 
    {
-      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
       return OS_TIMER_ERR_INVALID_ARGS;
    }    
 
-   /* 
-   ** Set the possible timer Id to not free so that
-   ** no other task can try to use it 
-   */
-   OS_timer_table[possible_tid].free = FALSE;
-   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
-
-   OS_timer_table[possible_tid].creator = OS_FindCreator();
-   strncpy(OS_timer_table[possible_tid].name, timer_name, OS_MAX_API_NAME);
-   OS_timer_table[possible_tid].start_time = 0;
-   OS_timer_table[possible_tid].interval_time = 0;
-    
-   OS_timer_table[possible_tid].callback_ptr = callback_ptr;
-
    /*
-   **  Initialize the sigaction and sigevent structures for the handler.
+   ** Reserve the timer first, so that a full or duplicate timer table
+   ** is reported as such rather than as a time base problem
    */
-   memset((void *)&sig_act, 0, sizeof(sig_act));
-   sigemptyset(&sig_act.sa_mask);
-   sig_act.sa_handler = OS_TimerSignalHandler;
-   sig_act.sa_flags = SA_RESTART; 
+   status = OS_TimerAllocate(&possible_tid, timer_name, OS_TIMER_TIMEBASE);
+   if ( status != OS_SUCCESS )
+   {
+      return status;
+   }
 
-   memset((void *)&evp, 0, sizeof(evp));
-   evp.sigev_notify = SIGEV_SIGNAL; 
-   evp.sigev_signo = OS_STARTING_SIGNAL - possible_tid;
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+   start_timebase = OS_timebase_table[OS_TIMER_TIMEBASE].free;
+   OS_timebase_table[OS_TIMER_TIMEBASE].free = FALSE;
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
 
-   /*
-   ** Create the timer
-   */
-   status = timer_create(CLOCK_REALTIME, &evp, (timer_t *)&(OS_timer_table[possible_tid].host_timerid));
-   if (status < 0) 
+   if ( start_timebase == TRUE )
    {
-      OS_timer_table[possible_tid].free = TRUE;
-      return ( OS_TIMER_ERR_UNAVAILABLE);
+      status = OS_TimeBaseStart(OS_TIMER_TIMEBASE, -1);
+
+      OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+      if ( status != OS_SUCCESS )
+      {
+         OS_timebase_table[OS_TIMER_TIMEBASE].free = TRUE;
+         OS_timer_table[possible_tid].free = TRUE;
+         strcpy(OS_timer_table[possible_tid].name, "");
+      }
+      else
+      {
+         OS_timebase_table[OS_TIMER_TIMEBASE].tick_usec = OS_TIMER_TICK_USEC;
+         OS_timebase_table[OS_TIMER_TIMEBASE].accuracy  = OS_TIMER_TICK_USEC;
+      }
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+      if ( status != OS_SUCCESS )
+      {
+         return OS_TIMER_ERR_UNAVAILABLE;
+      }
    }
-   
-   /*
-   ** Set the signal action for the timer
-   */
-   sigaction(OS_STARTING_SIGNAL - possible_tid, &(sig_act), 0); 
+
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+   OS_timer_table[possible_tid].accuracy     = OS_TIMER_TICK_USEC;
+   OS_timer_table[possible_tid].callback_ptr = callback_ptr;
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
 
    /*
    ** Return the clock accuracy to the user
    */
-   *clock_accuracy = os_clock_accuracy;
+   *clock_accuracy = OS_TIMER_TICK_USEC;
 
    /*
    ** Return timer ID 
@@ -348,20 +1663,100 @@ int32 OS_TimerCreate(uint32 *timer_id, const char *timer_name, uint32 *clock_acc
 }
 
 /******************************************************************************
-**  Function:  OS_TimerSet
+**  Function:  OS_TimerAdd
 **
-**  Purpose:  
+**  Purpose:  Create a new OSAL Timer on an existing time base. The timer is
+**            advanced by the time base ticks, so its resolution is the
+**            interval of the time base. callback_arg is passed to the
+**            callback each time the timer fires.
 **
-**  Arguments:
-**    (none)
+**  Return:   OS_INVALID_POINTER if timer_id or timer_name are NULL
+**            OS_ERR_NAME_TOO_LONG if the name is too long to be stored
+**            OS_TIMER_ERR_INVALID_ARGS if callback_ptr is NULL
+**            OS_ERR_INVALID_ID if timebase_id is not a valid time base
+**            OS_ERR_NO_FREE_IDS if there are no more free timer Ids
+**            OS_ERR_NAME_TAKEN if there is already a timer with the same name
+**            OS_SUCCESS if success
+*/
+int32 OS_TimerAdd(uint32 *timer_id, const char *timer_name, uint32 timebase_id, OS_ArgCallback_t  callback_ptr, void *callback_arg)
+{
+   uint32    possible_tid;
+   int32     status;
+   sigset_t  previous;
+   sigset_t  mask;
+
+   if ( timer_id == NULL || timer_name == NULL )
+   {
+      return OS_INVALID_POINTER;
+   }
+
+   if ( strlen(timer_name) >= OS_MAX_API_NAME )
+   {
+      return OS_ERR_NAME_TOO_LONG;
+   }
+
+   if ( callback_ptr == NULL )
+   {
+      return OS_TIMER_ERR_INVALID_ARGS;
+   }
+
+   if ( timebase_id >= OS_MAX_TIMEBASES || OS_timebase_table[timebase_id].free == TRUE ||
+        OS_timebase_table[timebase_id].deleting == TRUE )
+   {
+      return OS_ERR_INVALID_ID;
+   }
+
+   status = OS_TimerAllocate(&possible_tid, timer_name, timebase_id);
+   if ( status != OS_SUCCESS )
+   {
+      return status;
+   }
+
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+   OS_timer_table[possible_tid].callback_arg     = callback_arg;
+   OS_timer_table[possible_tid].arg_callback_ptr = callback_ptr;
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   *timer_id = possible_tid;
+
+   return OS_SUCCESS;
+
+}/* end OS_TimerAdd */
+
+/******************************************************************************
+**  Function:  OS_TimerSet
 **
-**  Return:
-**    (none)
+**  Purpose:  Arm a timer. It fires start_time usecs from now, then every
+**            interval_time usecs, both rounded up to whole ticks of its
+**            time base. A start_time of zero disarms the timer.
+**            Arming an OS_TimerCreate timer starts the internal time base
+**            if it is idle.
+**
+**  Return:   OS_ERR_INVALID_ID if the id passed in is not a valid timer
+**            OS_TIMER_ERR_INTERNAL if the host timer could not be programmed
+**            OS_SUCCESS if success
 */
 int32 OS_TimerSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
 {
-   int    status;
-   struct itimerspec timeout;
+   return OS_TimerSet64(timer_id, start_time, interval_time);
+}
+
+/******************************************************************************
+**  Function:  OS_TimerSet64
+**
+**  Purpose:  Same as OS_TimerSet, with 64 bit start and interval times in
+**            usecs, for timers longer than the 4294 secs that fit in 32 bits.
+**
+**  Return:   OS_ERR_INVALID_ID if the id passed in is not a valid timer
+**            OS_TIMER_ERR_INTERNAL if the host timer could not be programmed
+**            OS_SUCCESS if success
+*/
+int32 OS_TimerSet64(uint32 timer_id, uint64 start_time, uint64 interval_time)
+{
+   OS_timebase_internal_record_t *timebase;
+   int32              status;
+   sigset_t           previous;
+   sigset_t           mask;
 
    /* 
    ** Check to see if the timer_id given is valid 
@@ -384,66 +1779,91 @@ int32 OS_TimerSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
       interval_time = os_clock_accuracy;
    }
 
+   status = OS_SUCCESS;
+
    /*
    ** Save the start and interval times 
    */
-   OS_timer_table[timer_id].start_time = start_time;
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
+
+   OS_TimerDisarm(timer_id);
+   OS_TimerClearStats(timer_id);
+   OS_timer_table[timer_id].start_time    = start_time;
    OS_timer_table[timer_id].interval_time = interval_time;
 
-   /*
-   ** Convert from Microseconds to timespec structures
-   */
-   OS_UsecToTimespec(start_time, &(timeout.it_value));
-   OS_UsecToTimespec(interval_time, &(timeout.it_interval));
-	
-   /*
-   ** Program the real timer
-   */
-   status = timer_settime((timer_t)(OS_timer_table[timer_id].host_timerid), 
-                             0,              /* Flags field can be zero */
-                             &timeout,       /* struct itimerspec */
-		             NULL);         /* Oldvalue */
-   if (status < 0) 
+   timebase = &OS_timebase_table[OS_timer_table[timer_id].timebase_id];
+   if ( start_time > 0 )
    {
-      return ( OS_TIMER_ERR_INTERNAL);
+      OS_timer_table[timer_id].active = TRUE;
+      timebase->active_timers++;
+      OS_TimerArm(timer_id);
    }
-	
-   return OS_SUCCESS;
+
+   if ( OS_timer_table[timer_id].timebase_id == OS_TIMER_TIMEBASE &&
+        timebase->active_timers > 0 && timebase->running == FALSE )
+   {
+      if ( OS_TimeBaseProgram(OS_TIMER_TIMEBASE, OS_TIMER_TICK_USEC, OS_TIMER_TICK_USEC) < 0 )
+      {
+         status = OS_TIMER_ERR_INTERNAL;
+      }
+      else
+      {
+         timebase->running = TRUE;
+      }
+   }
+
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
+
+   return status;
 }
 
 
 /******************************************************************************
 **  Function:  OS_TimerDelete
 **
-**  Purpose: 
-**
-**  Arguments:
-**    (none)
+**  Purpose:  Delete a timer, cancelling it if it is armed. If its callback
+**            is running, this waits for the callback to return, so the
+**            callback state can be released as soon as this returns. A
+**            callback that deletes its own timer does not wait.
 **
-**  Return:
-**    (none)
+**  Return:   OS_ERR_INVALID_ID if the id passed in is not a valid timer
+**            OS_SUCCESS if success
 */
 int32 OS_TimerDelete(uint32 timer_id)
 {
-   int status;
+   OS_timebase_internal_record_t *timebase;
+   sigset_t  previous;
+   sigset_t  mask;
+
+   OS_InterruptSafeLock(&OS_timer_table_mut, &mask, &previous);
 
    /* 
    ** Check to see if the timer_id given is valid 
    */
    if (timer_id >= OS_MAX_TIMERS || OS_timer_table[timer_id].free == TRUE)
    {
+      OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
       return OS_ERR_INVALID_ID;
    }
 
-   /*
-   ** Delete the timer 
-   */
-   status = timer_delete((timer_t)(OS_timer_table[timer_id].host_timerid));
-   OS_timer_table[timer_id].free = TRUE;
-   if (status < 0)
+   OS_TimerDisarm(timer_id);
+
+   timebase = &OS_timebase_table[OS_timer_table[timer_id].timebase_id];
+   while ( timebase->callback_timer == timer_id &&
+           !pthread_equal(timebase->host_thread, pthread_self()) )
    {
-      return ( OS_TIMER_ERR_INTERNAL);
+#ifdef OS_VIRTUAL_TIME
+      OS_VirtualTimeCondTimedWait(&OS_timer_callback_cv, &OS_timer_table_mut, NULL);
+#else
+      pthread_cond_wait(&OS_timer_callback_cv, &OS_timer_table_mut);
+#endif
    }
+
+   OS_timer_table[timer_id].free    = TRUE;
+   OS_timer_table[timer_id].creator = UNINITIALIZED;
+   strcpy(OS_timer_table[timer_id].name, "");
+
+   OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
 	
    return OS_SUCCESS;
 }
@@ -502,6 +1922,8 @@ int32 OS_TimerGetIdByName (uint32 *timer_id, const char *timer_name)
 **
 **    Purpose: This function will pass back a pointer to structure that contains 
 **             all of the relevant info( name and creator) about the specified timer.
+**             It also reports how late the callbacks have run and how many
+**             expiries were overrun since the timer was last set.
 **             
 **    Returns: OS_ERR_INVALID_ID if the id passed in is not a valid timer 
 **             OS_INVALID_POINTER if the timer_prop pointer is null
@@ -532,47 +1954,30 @@ int32 OS_TimerGetInfo (uint32 timer_id, OS_timer_prop_t *timer_prop)
 
     timer_prop ->creator       = OS_timer_table[timer_id].creator;
     strcpy(timer_prop-> name, OS_timer_table[timer_id].name);
-    timer_prop ->start_time    = OS_timer_table[timer_id].start_time;
-    timer_prop ->interval_time = OS_timer_table[timer_id].interval_time;
+    /*
+    ** Times set with OS_TimerSet64 may not fit
+    */
+    timer_prop ->start_time    = (OS_timer_table[timer_id].start_time > 0xFFFFFFFF) ?
+                                 0xFFFFFFFF : (uint32)OS_timer_table[timer_id].start_time;
+    timer_prop ->interval_time = (OS_timer_table[timer_id].interval_time > 0xFFFFFFFF) ?
+                                 0xFFFFFFFF : (uint32)OS_timer_table[timer_id].interval_time;
     timer_prop ->accuracy      = OS_timer_table[timer_id].accuracy;
+
+    timer_prop ->fire_count    = OS_timer_table[timer_id].fire_count;
+    timer_prop ->overrun_count = OS_timer_table[timer_id].overrun_count;
+    timer_prop ->min_latency   = (int32)(OS_timer_table[timer_id].min_latency / 1000);
+    timer_prop ->max_latency   = (int32)(OS_timer_table[timer_id].max_latency / 1000);
+    timer_prop ->mean_latency  = 0;
+    if ( OS_timer_table[timer_id].fire_count > 0 )
+    {
+       timer_prop ->mean_latency = (int32)(OS_timer_table[timer_id].total_latency /
+                                           (int64)OS_timer_table[timer_id].fire_count / 1000);
+    }
+    memcpy(timer_prop ->latency_histogram, OS_timer_table[timer_id].latency_histogram,
+           sizeof(timer_prop ->latency_histogram));
     
     OS_InterruptSafeUnlock(&OS_timer_table_mut, &previous);
 
     return OS_SUCCESS;
     
 } /* end OS_TimerGetInfo */
-
-/****************************************************************
- * TIME BASE API
- *
- * This is not implemented by this OSAL, so return "OS_ERR_NOT_IMPLEMENTED"
- * for all calls defined by this API.  This is necessary for forward
- * compatibility (runtime code can check for this return code and use
- * an alternative API where appropriate).
- */
-
-int32 OS_TimeBaseCreate(uint32 *timer_id, const char *timebase_name, OS_TimerSync_t external_sync)
-{
-    return OS_ERR_NOT_IMPLEMENTED;
-}
-
-int32 OS_TimeBaseSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
-{
-    return OS_ERR_NOT_IMPLEMENTED;
-}
-
-int32 OS_TimeBaseDelete(uint32 timer_id)
-{
-    return OS_ERR_NOT_IMPLEMENTED;
-}
-
-int32 OS_TimeBaseGetIdByName (uint32 *timer_id, const char *timebase_name)
-{
-    return OS_ERR_NOT_IMPLEMENTED;
-}
-
-int32 OS_TimerAdd(uint32 *timer_id, const char *timer_name, uint32 timebase_id, OS_ArgCallback_t  callback_ptr, void *callback_arg)
-{
-    return OS_ERR_NOT_IMPLEMENTED;
-}
-
@@ -0,0 +1,69 @@
+/*
+** File   : osfiber.c
+**
+**      Copyright (c) 2004-2006, United States government as represented by the 
+**      administrator of the National Aeronautics Space Administration.  
+**      All rights reserved. This software was created at NASAs Goddard 
+**      Space Flight Center pursuant to government contracts.
+**
+**      This is governed by the NASA Open Source Agreement and may be used, 
+**      distributed and modified only pursuant to the terms of that agreement.
+**
+** Purpose: This file contains the OSAL Fiber API for RTEMS
+*/
+
+/****************************************************************************************
+                                    INCLUDE FILES
+****************************************************************************************/
+#define _USING_RTEMS_INCLUDES_
+
+#include <rtems.h>
+
+#include "common_types.h"
+#include "osapi.h"
+
+/****************************************************************
+ * FIBER API
+ *
+ * This is not implemented by this OSAL, so return "OS_ERR_NOT_IMPLEMENTED"
+ * for all calls defined by this API.  This is necessary for forward
+ * compatibility (runtime code can check for this return code and use
+ * an alternative API where appropriate).
+ */
+
+int32 OS_FiberCreate(uint32 *fiber_id, const char *fiber_name, OS_FiberEntry_t entry_point,
+                     void *arg, uint32 stack_size)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberRun(void)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberYield(void)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberGetId(uint32 *fiber_id)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberQueueGet(uint32 queue_id, void *data, uint32 size, uint32 *size_copied,
+                       int32 timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberBinSemWait(uint32 sem_id, int32 timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_FiberCountSemWait(uint32 sem_id, int32 timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
@@ -447,6 +447,20 @@ int32 OS_open   (const char *path,  int32 access,  uint32  mode)
  
 } /* end OS_open */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_openPrealloc
+
+    Purpose: opens a file like OS_open. Blocks cannot be allocated ahead on this
+             OS, so size_hint is ignored.
+
+    Returns: as for OS_open
+---------------------------------------------------------------------------------------*/
+
+int32 OS_openPrealloc (const char *path, int32 access, uint32 mode, int64 size_hint)
+{
+    return OS_open(path, access, mode);
+} /* end OS_openPrealloc */
+
 
 /*--------------------------------------------------------------------------------------
     Name: OS_close
@@ -583,6 +597,83 @@ int32 OS_write (int32  filedes, void *buffer, uint32 nbytes)
     
 }/* end OS_write */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_readv
+
+    Notes: Not implemented on this OS
+---------------------------------------------------------------------------------------*/
+
+int32 OS_readv (int32  filedes, const os_iovec_t *iov, int32 iovcnt)
+{
+    return OS_FS_UNIMPLEMENTED;
+} /* end OS_readv */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_writev
+
+    Notes: Not implemented on this OS
+---------------------------------------------------------------------------------------*/
+
+int32 OS_writev (int32  filedes, const os_iovec_t *iov, int32 iovcnt)
+{
+    return OS_FS_UNIMPLEMENTED;
+} /* end OS_writev */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_pread
+
+    Notes: Not implemented on this OS
+---------------------------------------------------------------------------------------*/
+
+int32 OS_pread (int32  filedes, void *buffer, uint32 nbytes, int64 offset)
+{
+    return OS_FS_UNIMPLEMENTED;
+} /* end OS_pread */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_pwrite
+
+    Notes: Not implemented on this OS
+---------------------------------------------------------------------------------------*/
+
+int32 OS_pwrite (int32  filedes, void *buffer, uint32 nbytes, int64 offset)
+{
+    return OS_FS_UNIMPLEMENTED;
+} /* end OS_pwrite */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_fsync
+
+    Notes: Not implemented on this OS
+---------------------------------------------------------------------------------------*/
+
+int32 OS_fsync (int32  filedes)
+{
+    return OS_FS_UNIMPLEMENTED;
+} /* end OS_fsync */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_fdatasync
+
+    Notes: Not implemented on this OS
+---------------------------------------------------------------------------------------*/
+
+int32 OS_fdatasync (int32  filedes)
+{
+    return OS_FS_UNIMPLEMENTED;
+} /* end OS_fdatasync */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_fallocate
+
+    Notes: Not implemented on this OS
+---------------------------------------------------------------------------------------*/
+
+int32 OS_fallocate (int32  filedes, uint32 mode, int64 offset, int64 length)
+{
+    return OS_FS_UNIMPLEMENTED;
+} /* end OS_fallocate */
+
 /*--------------------------------------------------------------------------------------
     Name: OS_chmod
 
@@ -703,6 +794,50 @@ int32 OS_lseek  (int32  filedes, int32 offset, uint32 whence)
  
 }/* end OS_lseek */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_read64
+
+    Notes: Not implemented on this OS
+---------------------------------------------------------------------------------------*/
+
+int64 OS_read64 (int32  filedes, void *buffer, uint64 nbytes)
+{
+    return OS_FS_UNIMPLEMENTED;
+} /* end OS_read64 */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_write64
+
+    Notes: Not implemented on this OS
+---------------------------------------------------------------------------------------*/
+
+int64 OS_write64 (int32  filedes, void *buffer, uint64 nbytes)
+{
+    return OS_FS_UNIMPLEMENTED;
+} /* end OS_write64 */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_stat64
+
+    Notes: Not implemented on this OS
+---------------------------------------------------------------------------------------*/
+
+int32 OS_stat64 (const char *path, os_fstat64_t *filestats)
+{
+    return OS_FS_UNIMPLEMENTED;
+} /* end OS_stat64 */
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_lseek64
+
+    Notes: Not implemented on this OS
+---------------------------------------------------------------------------------------*/
+
+int64 OS_lseek64 (int32  filedes, int64 offset, uint32 whence)
+{
+    return OS_FS_UNIMPLEMENTED;
+} /* end OS_lseek64 */
+
 /*--------------------------------------------------------------------------------------
     Name: OS_remove
 
@@ -999,6 +1134,21 @@ int32 OS_cp (const char *src, const char *dest)
      
 }/*end OS_cp */
 
+/*--------------------------------------------------------------------------------------
+    Name: OS_cpProgress
+    
+    Purpose: Copies a single file from src to dest, reporting progress to callback.
+             Not implemented on this OS.
+
+    Returns: OS_FS_UNIMPLEMENTED
+---------------------------------------------------------------------------------------*/
+
+int32 OS_cpProgress (const char *src, const char *dest, OS_FileProgress_t callback, void *arg)
+{
+    return OS_FS_UNIMPLEMENTED;
+
+}/*end OS_cpProgress */
+
 /*--------------------------------------------------------------------------------------
     Name: OS_mv
     
@@ -1264,6 +1414,17 @@ void  OS_rewinddir (os_dirp_t directory )
        rewinddir( directory);
     }
 }
+
+/*--------------------------------------------------------------------------------------
+    Name: OS_ReadDirBatch
+
+    Notes: Not implemented on this OS
+---------------------------------------------------------------------------------------*/
+
+int32 OS_ReadDirBatch (os_dirp_t directory, os_dirent_info_t *entries, uint32 max_entries)
+{
+    return OS_FS_UNIMPLEMENTED;
+} /* end OS_ReadDirBatch */
 /*--------------------------------------------------------------------------------------
     Name: OS_rmdir
     
@@ -1494,6 +1655,148 @@ int32 OS_ShellOutputToFile(char* Cmd, int32 OS_fd)
 
 }/* end OS_ShellOutputToFile */
 
+/* --------------------------------------------------------------------------------------
+    Name: OS_ShellOutputToFileLimited
+    
+    Purpose: Takes a shell command in and writes the output of that command to the
+             specified file, with a time and output size limit. Not implemented on
+             this OS.
+    
+    Returns: OS_FS_UNIMPLEMENTED
+ ---------------------------------------------------------------------------------------*/
+int32 OS_ShellOutputToFileLimited(char* Cmd, int32 OS_fd, uint32 timeout_msecs, uint32 max_bytes)
+{
+    return OS_FS_UNIMPLEMENTED;
+
+}/* end OS_ShellOutputToFileLimited */
+
+/****************************************************************
+ * ASYNCHRONOUS I/O API
+ *
+ * This is not implemented by this OSAL, so return "OS_FS_UNIMPLEMENTED"
+ * for all calls defined by this API.
+ */
+
+int32 OS_AsyncQueueCreate (uint32 *queue_id, const char *queue_name, uint32 flags)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_AsyncQueueDelete (uint32 queue_id)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_AsyncRead (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                    int64 offset, void *user_data)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_AsyncWrite (uint32 queue_id, int32 filedes, void *buffer, uint32 nbytes,
+                     int64 offset, void *user_data)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_AsyncFsync (uint32 queue_id, int32 filedes, void *user_data)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_AsyncWait (uint32 queue_id, OS_async_completion_t *completion, int32 msecs)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+/****************************************************************
+ * MEMORY-MAPPED FILE API
+ *
+ * This is not implemented by this OSAL, so return "OS_FS_UNIMPLEMENTED"
+ * for all calls defined by this API.
+ */
+
+int32 OS_mmap (int32 filedes, int64 offset, uint32 length, int32 access, void **addr)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_mmapFile (const char *path, int32 access, void **addr, uint32 *length)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_munmap (void *addr, uint32 length)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_msync (void *addr, uint32 length)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_madvise (void *addr, uint32 length, uint32 advice)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+/****************************************************************
+ * BUFFERED STREAM API
+ *
+ * This is not implemented by this OSAL, so return "OS_FS_UNIMPLEMENTED"
+ * for all calls defined by this API.
+ */
+
+int32 OS_StreamOpen (uint32 *stream_id, int32 filedes, uint32 buffer_size,
+                     uint32 flush_msecs, uint32 flags)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_StreamWrite (uint32 stream_id, const void *buffer, uint32 nbytes)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_StreamFlush (uint32 stream_id)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_StreamClose (uint32 stream_id)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+/****************************************************************
+ * SYNC GROUP API
+ *
+ * This is not implemented by this OSAL, so return "OS_FS_UNIMPLEMENTED"
+ * for all calls defined by this API.
+ */
+
+int32 OS_SyncGroupCreate (uint32 *group_id, uint32 flush_msecs, uint32 max_pending,
+                          uint32 flags)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_SyncGroupAdd (uint32 group_id, int32 filedes)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_SyncGroupCommit (uint32 group_id)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
+int32 OS_SyncGroupDelete (uint32 group_id)
+{
+    return OS_FS_UNIMPLEMENTED;
+}
+
 /* --------------------------------------------------------------------------------------
 Name: OS_FDGetInfo
     
@@ -383,6 +383,25 @@ int32 OS_TimerSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
    return OS_SUCCESS;
 }
 
+/******************************************************************************
+**  Function:  OS_TimerSet64
+**
+**  Purpose:  OS_TimerSet with 64 bit times. Only times that fit in 32 bits
+**            are supported on this OS.
+**
+**  Return:   OS_TIMER_ERR_INVALID_ARGS if a time does not fit in 32 bits,
+**            otherwise as OS_TimerSet
+*/
+int32 OS_TimerSet64(uint32 timer_id, uint64 start_time, uint64 interval_time)
+{
+   if ( start_time > 0xFFFFFFFF || interval_time > 0xFFFFFFFF )
+   {
+      return OS_TIMER_ERR_INVALID_ARGS;
+   }
+
+   return OS_TimerSet(timer_id, (uint32)start_time, (uint32)interval_time);
+}
+
 /******************************************************************************
 **  Function:  OS_TimerDelete
 **
@@ -513,6 +532,7 @@ int32 OS_TimerGetInfo (uint32 timer_id, OS_timer_prop_t *timer_prop)
     */
     status = rtems_semaphore_obtain (OS_timer_table_sem, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
 
+    memset(timer_prop, 0, sizeof(OS_timer_prop_t));
     timer_prop ->creator       = OS_timer_table[timer_id].creator;
     strcpy(timer_prop-> name, OS_timer_table[timer_id].name);
     timer_prop ->start_time    = OS_timer_table[timer_id].start_time;
@@ -539,6 +559,11 @@ int32 OS_TimeBaseCreate(uint32 *timer_id, const char *timebase_name, OS_TimerSyn
     return OS_ERR_NOT_IMPLEMENTED;
 }
 
+int32 OS_TimeBaseCreateFd(uint32 *timer_id, const char *timebase_name, int32 sync_fd)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
 int32 OS_TimeBaseSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
 {
     return OS_ERR_NOT_IMPLEMENTED;
@@ -752,6 +752,23 @@ int32 OS_TaskDelay (uint32 milli_second)
 
 }/* end OS_TaskDelay */
 
+/*---------------------------------------------------------------------------------------
+   Name: OS_TaskPeriodInit / OS_TaskDelayUntil
+
+   Purpose: Absolute-time periodic delays are not implemented by this OSAL port.
+
+   returns: OS_ERR_NOT_IMPLEMENTED
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskPeriodInit (OS_task_period_t *period, uint32 period_usecs)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}/* end OS_TaskPeriodInit */
+
+int32 OS_TaskDelayUntil (OS_task_period_t *period)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}/* end OS_TaskDelayUntil */
+
 
 /*---------------------------------------------------------------------------------------
    Name: OS_TaskSetPriority
@@ -955,6 +972,19 @@ int32 OS_TaskGetInfo (uint32 task_id, OS_task_prop_t *task_prop)
 
 } /* end OS_TaskGetInfo */
 
+/*---------------------------------------------------------------------------------------
+    Name: OS_TaskGetStats
+
+    Purpose: Runtime statistics (CPU time, context switches, stack usage) are not
+             collected by this OSAL port.
+
+    Returns: OS_ERR_NOT_IMPLEMENTED
+---------------------------------------------------------------------------------------*/
+int32 OS_TaskGetStats (uint32 task_id, OS_task_stats_t *task_stats)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_TaskGetStats */
+
 /*--------------------------------------------------------------------------------------
      Name: OS_TaskInstallDeleteHandler
 
@@ -2737,6 +2767,34 @@ int32 OS_SetLocalTime(OS_time_t *time_struct)
 
 } /* end OS_SetLocalTime */
 
+/*---------------------------------------------------------------------------------------
+ * Name: OS_GetMonotonicTime
+ * 
+ * Purpose: Returns the time in nanoseconds from CLOCK_MONOTONIC, for measuring intervals
+ * ------------------------------------------------------------------------------------*/
+
+int32 OS_GetMonotonicTime(uint64 *time_nsecs)
+{
+   int               status;
+   struct  timespec  time;
+
+   if (time_nsecs == NULL)
+   {
+      return OS_INVALID_POINTER;
+   }
+
+   status = clock_gettime(CLOCK_MONOTONIC, &time);
+   if (status != 0)
+   {
+        return OS_ERROR;
+   }
+
+   *time_nsecs = ((uint64)time.tv_sec * 1000000000) + time.tv_nsec;
+
+   return OS_SUCCESS;
+
+} /* end OS_GetMonotonicTime */
+
 /****************************************************************************************
                                  INT API
 ****************************************************************************************/
@@ -2918,6 +2976,58 @@ int32 OS_HeapGetInfo       (OS_heap_prop_t *heap_prop)
 
 }
 
+/*---------------------------------------------------------------------------------------
+   Name: OS_MemLockGetInfo
+
+   Purpose: Memory locking is not used by this OSAL port.
+
+   Returns: OS_ERR_NOT_IMPLEMENTED
+---------------------------------------------------------------------------------------*/
+int32 OS_MemLockGetInfo (OS_mem_lock_prop_t *mem_lock_prop)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+/****************************************************************
+ * MEMORY POOL API
+ *
+ * This is not implemented by this OSAL, so return "OS_ERR_NOT_IMPLEMENTED"
+ * for all calls defined by this API.  This is necessary for forward
+ * compatibility (runtime code can check for this return code and use
+ * an alternative API where appropriate).
+ */
+
+int32 OS_MemPoolCreate(uint32 *pool_id, const char *pool_name, uint32 block_size,
+                       uint32 num_blocks, uint32 flags)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_MemPoolDelete(uint32 pool_id)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_MemPoolAlloc(uint32 pool_id, void **block)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_MemPoolFree(uint32 pool_id, void *block)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_MemPoolGetIdByName(uint32 *pool_id, const char *pool_name)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_MemPoolGetInfo(uint32 pool_id, OS_mem_pool_prop_t *pool_prop)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
 /*---------------------------------------------------------------------------------------
  *  Name: OS_GetErrorName()
 ---------------------------------------------------------------------------------------*/
@@ -2996,6 +3106,12 @@ int32 OS_GetErrorName(int32 error_num, os_err_name_t * err_name)
             strcpy(local_name,"OS_TIMER_ERR_UNAVAILABLE"); break;
         case OS_TIMER_ERR_INTERNAL:
             strcpy(local_name,"OS_TIMER_ERR_INTERNAL"); break;
+        case OS_ERR_PERIOD_OVERRUN:
+            strcpy(local_name,"OS_ERR_PERIOD_OVERRUN"); break;
+        case OS_ERR_POOL_EMPTY:
+            strcpy(local_name,"OS_ERR_POOL_EMPTY"); break;
+        case OS_ERR_OUTPUT_TRUNCATED:
+            strcpy(local_name,"OS_ERR_OUTPUT_TRUNCATED"); break;
 
         default: strcpy(local_name,"ERROR_UNKNOWN");
                  return_code = OS_ERROR;
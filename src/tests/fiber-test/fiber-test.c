@@ -0,0 +1,239 @@
+/*
+** Fiber test: many fibers on one task, fiber-aware semaphore waits,
+** and a measurement of the fiber switch time
+*/
+#include <stdio.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/* Define setup and check functions for UT assert */
+void FiberSetup(void);
+void FiberCheck(void);
+
+#define HOST_TASK_STACK_SIZE  0x4000
+#define HOST_TASK_PRIORITY    101
+#define GIVER_TASK_STACK_SIZE 0x4000
+#define GIVER_TASK_PRIORITY   100
+
+#define FIBER_STACK_SIZE      0x4000
+#define NUM_WORKER_FIBERS     100
+#define WORKER_LOOPS          10
+#define NUM_GIVES             5
+#define SWITCH_LOOPS          100000
+
+uint32 host_task_stack[HOST_TASK_STACK_SIZE];
+uint32 host_task_id;
+uint32 giver_task_stack[GIVER_TASK_STACK_SIZE];
+uint32 giver_task_id;
+
+uint32 bin_sem_id;
+uint32 count_sem_id;
+uint32 unused_sem_id;
+
+uint32 worker_counts[NUM_WORKER_FIBERS];
+uint32 bin_sem_takes;
+uint32 count_sem_takes;
+int32  timed_wait_status;
+int32  fiber_run_status;
+int32  yield_outside_status;
+uint32 fiber_failures;
+uint32 switch_count;
+uint32 switch_nsecs;
+
+void WorkerFiber(void *arg)
+{
+   uint32 *count = (uint32 *)arg;
+   uint32  i;
+
+   for (i = 0; i < WORKER_LOOPS; i++)
+   {
+      ++(*count);
+      if (OS_FiberYield() != OS_SUCCESS)
+      {
+         ++fiber_failures;
+      }
+   }
+}
+
+void BinSemFiber(void *arg)
+{
+   uint32 i;
+
+   for (i = 0; i < NUM_GIVES; i++)
+   {
+      if (OS_FiberBinSemWait(bin_sem_id, OS_PEND) == OS_SUCCESS)
+      {
+         ++bin_sem_takes;
+      }
+   }
+}
+
+void CountSemFiber(void *arg)
+{
+   uint32 i;
+
+   for (i = 0; i < NUM_GIVES; i++)
+   {
+      if (OS_FiberCountSemWait(count_sem_id, 5000) == OS_SUCCESS)
+      {
+         ++count_sem_takes;
+      }
+   }
+}
+
+void TimedWaitFiber(void *arg)
+{
+   timed_wait_status = OS_FiberBinSemWait(unused_sem_id, 50);
+}
+
+void SwitchFiber(void *arg)
+{
+   uint32 i;
+
+   for (i = 0; i < SWITCH_LOOPS; i++)
+   {
+      OS_FiberYield();
+      ++switch_count;
+   }
+}
+
+void host_task(void)
+{
+   uint32     i;
+   uint32     fiber_id;
+   int32      status;
+   char       name[OS_MAX_API_NAME];
+   OS_time_t  start_time;
+   OS_time_t  end_time;
+
+   OS_TaskRegister();
+
+   yield_outside_status = OS_FiberYield();
+
+   for (i = 0; i < NUM_WORKER_FIBERS; i++)
+   {
+      snprintf(name, sizeof(name), "Worker%u", (unsigned int)i);
+      status = OS_FiberCreate(&fiber_id, name, WorkerFiber, &worker_counts[i], FIBER_STACK_SIZE);
+      if (status != OS_SUCCESS)
+      {
+         ++fiber_failures;
+      }
+   }
+
+   status  = OS_FiberCreate(&fiber_id, "BinSemWaiter", BinSemFiber, NULL, FIBER_STACK_SIZE);
+   status |= OS_FiberCreate(&fiber_id, "CountSemWaiter", CountSemFiber, NULL, FIBER_STACK_SIZE);
+   status |= OS_FiberCreate(&fiber_id, "TimedWaiter", TimedWaitFiber, NULL, FIBER_STACK_SIZE);
+   if (status != OS_SUCCESS)
+   {
+      ++fiber_failures;
+   }
+
+   fiber_run_status = OS_FiberRun();
+
+   /*
+   ** Time the fiber switch with two fibers that only yield to each other
+   */
+   status  = OS_FiberCreate(&fiber_id, "Switch1", SwitchFiber, NULL, FIBER_STACK_SIZE);
+   status |= OS_FiberCreate(&fiber_id, "Switch2", SwitchFiber, NULL, FIBER_STACK_SIZE);
+   if (status != OS_SUCCESS)
+   {
+      ++fiber_failures;
+   }
+
+   OS_GetLocalTime(&start_time);
+   status = OS_FiberRun();
+   OS_GetLocalTime(&end_time);
+   if (status != OS_SUCCESS)
+   {
+      ++fiber_failures;
+   }
+
+   switch_nsecs = (((end_time.seconds - start_time.seconds) * 1000000) +
+                   end_time.microsecs - start_time.microsecs) * 1000 / (2 * SWITCH_LOOPS);
+
+   OS_ApplicationShutdown(TRUE);
+   OS_TaskExit();
+}
+
+void giver_task(void)
+{
+   uint32 i;
+
+   OS_TaskRegister();
+
+   for (i = 0; i < NUM_GIVES; i++)
+   {
+      OS_TaskDelay(20);
+      OS_BinSemGive(bin_sem_id);
+      OS_CountSemGive(count_sem_id);
+   }
+
+   OS_TaskExit();
+}
+
+void FiberCheck(void)
+{
+   uint32 i;
+   uint32 bad_counts = 0;
+
+   for (i = 0; i < NUM_WORKER_FIBERS; i++)
+   {
+      if (worker_counts[i] != WORKER_LOOPS)
+      {
+         ++bad_counts;
+      }
+   }
+
+   UtAssert_True(yield_outside_status == OS_ERR_INVALID_ID, "OS_FiberYield outside a fiber Rc=%d", (int)yield_outside_status);
+   UtAssert_True(fiber_run_status == OS_SUCCESS, "OS_FiberRun Rc=%d", (int)fiber_run_status);
+   UtAssert_True(fiber_failures == 0, "Fiber failures = %u", (unsigned int)fiber_failures);
+   UtAssert_True(bad_counts == 0, "Worker fibers with wrong loop count = %u", (unsigned int)bad_counts);
+   UtAssert_True(bin_sem_takes == NUM_GIVES, "Binary sem takes (%u) == gives (%u)", (unsigned int)bin_sem_takes, (unsigned int)NUM_GIVES);
+   UtAssert_True(count_sem_takes == NUM_GIVES, "Counting sem takes (%u) == gives (%u)", (unsigned int)count_sem_takes, (unsigned int)NUM_GIVES);
+   UtAssert_True(timed_wait_status == OS_SEM_TIMEOUT, "Timed wait Rc=%d", (int)timed_wait_status);
+   UtAssert_True(switch_count == 2 * SWITCH_LOOPS, "Switch loops = %u", (unsigned int)switch_count);
+
+   UtPrintf("Fiber switch time = %u nanoseconds\n", (unsigned int)switch_nsecs);
+}
+
+void OS_Application_Startup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(FiberCheck, FiberSetup, NULL, "FiberTest");
+}
+
+void FiberSetup(void)
+{
+   int32 status;
+
+   status = OS_BinSemCreate(&bin_sem_id, "BinSem1", 0, 0);
+   UtAssert_True(status == OS_SUCCESS, "BinSem1 create Id=%u Rc=%d", (unsigned int)bin_sem_id, (int)status);
+
+   status = OS_BinSemCreate(&unused_sem_id, "BinSem2", 0, 0);
+   UtAssert_True(status == OS_SUCCESS, "BinSem2 create Id=%u Rc=%d", (unsigned int)unused_sem_id, (int)status);
+
+   status = OS_CountSemCreate(&count_sem_id, "CountSem1", 0, 0);
+   UtAssert_True(status == OS_SUCCESS, "CountSem1 create Id=%u Rc=%d", (unsigned int)count_sem_id, (int)status);
+
+   status = OS_TaskCreate(&host_task_id, "FiberHost", host_task, host_task_stack, HOST_TASK_STACK_SIZE, HOST_TASK_PRIORITY, 0);
+   UtAssert_True(status == OS_SUCCESS, "FiberHost create Id=%u Rc=%d", (unsigned int)host_task_id, (int)status);
+
+   status = OS_TaskCreate(&giver_task_id, "Giver", giver_task, giver_task_stack, GIVER_TASK_STACK_SIZE, GIVER_TASK_PRIORITY, 0);
+   UtAssert_True(status == OS_SUCCESS, "Giver create Id=%u Rc=%d", (unsigned int)giver_task_id, (int)status);
+
+   /*
+    * Call OS_IdleLoop so the tasks can run
+    * The fiber host task calls OS_ApplicationShutdown when done which will continue the test
+    */
+   OS_IdleLoop();
+}
@@ -0,0 +1,265 @@
+/*
+** Timer latency test: measures how late timer callbacks run when the OSAL
+** dispatches them from a thread, next to a plain POSIX timer whose expiry
+** is delivered as a signal, and checks that the OSAL callbacks can use
+** the OSAL locking calls.
+*/
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/* Define setup and check functions for UT assert */
+void TimerLatencySetup(void);
+void TimerLatencyCheck(void);
+
+#define TASK_STACK_SIZE   0x4000
+#define TASK_PRIORITY     100
+
+#define NUM_SAMPLES       200
+#define TIMER_START_USEC  10000
+#define TIMER_PERIOD_USEC 10000
+
+#define LATENCY_SIGNAL    (SIGRTMIN + 2)
+
+typedef struct
+{
+   uint32 count;
+   int64  min_nsecs;
+   int64  max_nsecs;
+   int64  total_nsecs;
+} latency_stats_t;
+
+uint32 latency_task_stack[TASK_STACK_SIZE];
+uint32 latency_task_id;
+uint32 latency_mutex_id;
+uint32 latency_timer_id;
+
+struct timespec thread_expected;
+struct timespec signal_expected;
+struct timespec signal_stamps[NUM_SAMPLES];
+volatile uint32 signal_count;
+
+latency_stats_t thread_stats;
+latency_stats_t signal_stats;
+OS_timer_prop_t thread_timer_prop;
+uint32          lock_failures;
+int32           timer_create_status;
+int32           timer_set_status;
+int             signal_timer_status;
+
+int64 TimespecDiffNsecs(const struct timespec *later, const struct timespec *earlier)
+{
+   return ((int64)(later->tv_sec - earlier->tv_sec) * 1000000000) +
+          (later->tv_nsec - earlier->tv_nsec);
+}
+
+void TimespecAddUsecs(struct timespec *ts, uint32 usecs)
+{
+   ts->tv_sec  += usecs / 1000000;
+   ts->tv_nsec += (usecs % 1000000) * 1000;
+   if (ts->tv_nsec >= 1000000000)
+   {
+      ts->tv_nsec -= 1000000000;
+      ++ts->tv_sec;
+   }
+}
+
+void LatencyAddSample(latency_stats_t *stats, int64 nsecs)
+{
+   if (stats->count == 0 || nsecs < stats->min_nsecs)
+   {
+      stats->min_nsecs = nsecs;
+   }
+   if (stats->count == 0 || nsecs > stats->max_nsecs)
+   {
+      stats->max_nsecs = nsecs;
+   }
+   stats->total_nsecs += nsecs;
+   ++stats->count;
+}
+
+/*
+** OSAL timer callback: runs on the dispatcher thread, so it may block on
+** an OSAL mutex like any task
+*/
+void LatencyTimerCallback(uint32 timer_id)
+{
+   struct timespec now;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+
+   if (thread_stats.count >= NUM_SAMPLES)
+   {
+      return;
+   }
+
+   LatencyAddSample(&thread_stats, TimespecDiffNsecs(&now, &thread_expected));
+   TimespecAddUsecs(&thread_expected, TIMER_PERIOD_USEC);
+
+   if (OS_MutSemTake(latency_mutex_id) != OS_SUCCESS ||
+       OS_MutSemGive(latency_mutex_id) != OS_SUCCESS)
+   {
+      ++lock_failures;
+   }
+}
+
+/*
+** Signal handler for the POSIX timer: only takes a time stamp
+*/
+void LatencySignalHandler(int signo)
+{
+   if (signal_count < NUM_SAMPLES)
+   {
+      clock_gettime(CLOCK_MONOTONIC, &signal_stamps[signal_count]);
+      ++signal_count;
+   }
+}
+
+void MeasureThreadDispatch(void)
+{
+   uint32 timeout;
+
+   timer_create_status = OS_TimerCreate(&latency_timer_id, "LatencyTimer", &timeout, LatencyTimerCallback);
+   if (timer_create_status != OS_SUCCESS)
+   {
+      return;
+   }
+
+   clock_gettime(CLOCK_MONOTONIC, &thread_expected);
+   TimespecAddUsecs(&thread_expected, TIMER_START_USEC);
+   timer_set_status = OS_TimerSet(latency_timer_id, TIMER_START_USEC, TIMER_PERIOD_USEC);
+
+   for (timeout = 0; thread_stats.count < NUM_SAMPLES && timeout < 2 * NUM_SAMPLES; timeout++)
+   {
+      OS_TaskDelay(TIMER_PERIOD_USEC / 1000);
+   }
+
+   OS_TimerGetInfo(latency_timer_id, &thread_timer_prop);
+   OS_TimerDelete(latency_timer_id);
+}
+
+void MeasureSignalDispatch(void)
+{
+   struct sigaction  action;
+   struct sigevent   event;
+   struct itimerspec timeout;
+   timer_t           host_timer;
+   uint32            i;
+
+   memset(&action, 0, sizeof(action));
+   action.sa_handler = LatencySignalHandler;
+   sigemptyset(&action.sa_mask);
+   sigaction(LATENCY_SIGNAL, &action, NULL);
+
+   memset(&event, 0, sizeof(event));
+   event.sigev_notify = SIGEV_SIGNAL;
+   event.sigev_signo  = LATENCY_SIGNAL;
+
+   signal_timer_status = timer_create(CLOCK_MONOTONIC, &event, &host_timer);
+   if (signal_timer_status != 0)
+   {
+      return;
+   }
+
+   /*
+   ** An absolute start time gives the exact expiry of every sample
+   */
+   clock_gettime(CLOCK_MONOTONIC, &signal_expected);
+   TimespecAddUsecs(&signal_expected, TIMER_START_USEC);
+   timeout.it_value = signal_expected;
+   timeout.it_interval.tv_sec  = 0;
+   timeout.it_interval.tv_nsec = TIMER_PERIOD_USEC * 1000;
+   signal_timer_status = timer_settime(host_timer, TIMER_ABSTIME, &timeout, NULL);
+
+   for (i = 0; signal_count < NUM_SAMPLES && i < 2 * NUM_SAMPLES; i++)
+   {
+      OS_TaskDelay(TIMER_PERIOD_USEC / 1000);
+   }
+
+   timer_delete(host_timer);
+
+   for (i = 0; i < signal_count; i++)
+   {
+      LatencyAddSample(&signal_stats, TimespecDiffNsecs(&signal_stamps[i], &signal_expected));
+      TimespecAddUsecs(&signal_expected, TIMER_PERIOD_USEC);
+   }
+}
+
+void latency_task(void)
+{
+   OS_TaskRegister();
+
+   MeasureThreadDispatch();
+   MeasureSignalDispatch();
+
+   OS_ApplicationShutdown(TRUE);
+   OS_TaskExit();
+}
+
+void PrintLatency(const char *mode, const latency_stats_t *stats)
+{
+   if (stats->count == 0)
+   {
+      return;
+   }
+
+   UtPrintf("%s dispatch latency: min %ld, avg %ld, max %ld usecs over %u expirations\n", mode,
+            (long)(stats->min_nsecs / 1000), (long)(stats->total_nsecs / stats->count / 1000),
+            (long)(stats->max_nsecs / 1000), (unsigned int)stats->count);
+}
+
+void TimerLatencyCheck(void)
+{
+   UtAssert_True(timer_create_status == OS_SUCCESS, "OS_TimerCreate Rc=%d", (int)timer_create_status);
+   UtAssert_True(timer_set_status == OS_SUCCESS, "OS_TimerSet Rc=%d", (int)timer_set_status);
+   UtAssert_True(thread_stats.count == NUM_SAMPLES, "Thread dispatch samples = %u", (unsigned int)thread_stats.count);
+   UtAssert_True(lock_failures == 0, "Mutex take/give failures in callback = %u", (unsigned int)lock_failures);
+   UtAssert_True(thread_stats.count == 0 || thread_stats.min_nsecs >= 0, "No callback ran early");
+   UtAssert_True(signal_timer_status == 0, "POSIX timer setup Rc=%d", signal_timer_status);
+   UtAssert_True(signal_stats.count == NUM_SAMPLES, "Signal dispatch samples = %u", (unsigned int)signal_stats.count);
+
+   PrintLatency("Thread", &thread_stats);
+   PrintLatency("Signal", &signal_stats);
+
+   UtPrintf("OS_TimerGetInfo: %u callbacks, %u overruns, latency min %d, mean %d, max %d usecs\n",
+            (unsigned int)thread_timer_prop.fire_count, (unsigned int)thread_timer_prop.overrun_count,
+            (int)thread_timer_prop.min_latency, (int)thread_timer_prop.mean_latency,
+            (int)thread_timer_prop.max_latency);
+}
+
+void OS_Application_Startup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(TimerLatencyCheck, TimerLatencySetup, NULL, "TimerLatencyTest");
+}
+
+void TimerLatencySetup(void)
+{
+   int32 status;
+
+   status = OS_MutSemCreate(&latency_mutex_id, "LatencyMutex", 0);
+   UtAssert_True(status == OS_SUCCESS, "LatencyMutex create Id=%u Rc=%d", (unsigned int)latency_mutex_id, (int)status);
+
+   status = OS_TaskCreate(&latency_task_id, "LatencyTask", latency_task, latency_task_stack, TASK_STACK_SIZE, TASK_PRIORITY, 0);
+   UtAssert_True(status == OS_SUCCESS, "LatencyTask create Id=%u Rc=%d", (unsigned int)latency_task_id, (int)status);
+
+   /*
+    * Call OS_IdleLoop so the task can run
+    * The task calls OS_ApplicationShutdown when done which will continue the test
+    */
+   OS_IdleLoop();
+}
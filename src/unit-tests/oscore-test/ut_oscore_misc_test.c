@@ -642,6 +642,100 @@ UT_os_setlocaltime_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_GetMonotonicTime(uint64 *time_nsecs)
+** Purpose: Returns the monotonic time in nanoseconds
+** Parameters: *time_nsecs - a pointer that will hold the time
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERROR if the OS call failed
+**          OS_SUCCESS if succeeded
+**          OS_ERR_NOT_IMPLEMENTED
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_ERR_NOT_IMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-argument condition
+**   1) Call this routine with a null-pointer argument
+**   2) Expect the returned value to be
+**        (a) OS_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: OS-call-failure condition
+**   1) Setup test to cause the OS call to fail inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_ERROR
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call this routine many times in a row and expect the time never to go back
+**   2) Call this routine before and after a 100 msec delay
+**   3) Expect the difference to be at least 100 msecs and less than 1 sec
+**--------------------------------------------------------------------------------*/
+void UT_os_getmonotonictime_test()
+{
+    uint64 prev_nsecs = 0, curr_nsecs = 0, start_nsecs = 0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc = NULL;
+    int32 res = 0, idx = 0, i = 0, backwards = 0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_GetMonotonicTime(NULL);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_getmonotonictime_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+    res = OS_GetMonotonicTime(NULL);
+    if (res == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    res = OS_GetMonotonicTime(&prev_nsecs);
+    for (i=0; (i < 10000) && (res == OS_SUCCESS); i++)
+    {
+        res = OS_GetMonotonicTime(&curr_nsecs);
+        if (curr_nsecs < prev_nsecs)
+            backwards++;
+        prev_nsecs = curr_nsecs;
+    }
+
+    start_nsecs = curr_nsecs;
+    OS_TaskDelay(100);
+    if (res == OS_SUCCESS)
+        res = OS_GetMonotonicTime(&curr_nsecs);
+
+    UT_OS_LOG_MACRO("\nOS_GetMonotonicTime() - #3 Nominal [100 msec delay measured as %ld usecs]\n",
+                    (long)((curr_nsecs - start_nsecs) / 1000));
+
+    if ((res == OS_SUCCESS) && (backwards == 0) &&
+        (curr_nsecs - start_nsecs >= 100000000) &&
+        (curr_nsecs - start_nsecs < 1000000000))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_getmonotonictime_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_GetMonotonicTime", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: void OS_GetErrorName(int32 error_num, os_err_name_t * err_name)
 ** Purpose: Returns the string name of the error value
@@ -797,6 +891,405 @@ UT_os_heapgetinfo_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_MemLockGetInfo(OS_mem_lock_prop_t *mem_lock_prop)
+** Purpose: Returns how much of the process memory is locked and resident
+** Parameters: *mem_lock_prop - pointer to memory locking information structure
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERROR if the OS call failed
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_memlockgetinfo_test(void)
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0;
+    OS_mem_lock_prop_t memLockProp;
+    const char* testDesc = NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_MemLockGetInfo(&memLockProp);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_memlockgetinfo_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    res = OS_MemLockGetInfo(NULL);
+    if (res == OS_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    res = OS_MemLockGetInfo(&memLockProp);
+    if ((res == OS_SUCCESS) && (memLockProp.resident_bytes > 0) &&
+        (memLockProp.locked == FALSE || memLockProp.locked_bytes > 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_memlockgetinfo_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_MemLockGetInfo", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_MemPoolCreate(uint32 *pool_id, const char *pool_name,
+**                               uint32 block_size, uint32 num_blocks, uint32 flags)
+** Purpose: Creates a pool of fixed size memory blocks
+** Parameters: *pool_id - pointer that will hold the id of the new pool
+**             *pool_name - name of the new pool
+**             block_size - size of each block, in bytes
+**             num_blocks - number of blocks in the pool
+**             flags - reserved, must be 0
+** Returns: OS_INVALID_POINTER if a pointer passed in is null
+**          OS_ERR_NAME_TOO_LONG if the name is too long
+**          OS_ERROR if the geometry or flags are invalid or the OS call failed
+**          OS_ERR_NAME_TAKEN if the name is already used
+**          OS_ERR_NO_FREE_IDS if the pool table is full
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_mempoolcreate_test(void)
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0, i = 0, j = 0;
+    uint32 poolIds[OS_MAX_MEM_POOLS+1];
+    char poolName[OS_MAX_API_NAME];
+    char longPoolName[OS_MAX_API_NAME+5];
+    const char* testDesc = NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_MemPoolCreate(&poolIds[0], "Good", 32, 8, 0);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_mempoolcreate_test_exit_tag;
+    }
+
+    /* Clean up */
+    OS_MemPoolDelete(poolIds[0]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_MemPoolCreate(NULL, "Pool1", 32, 8, 0) == OS_INVALID_POINTER) &&
+        (OS_MemPoolCreate(&poolIds[0], NULL, 32, 8, 0) == OS_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Name-too-long";
+
+    memset(longPoolName, 'X', sizeof(longPoolName));
+    longPoolName[sizeof(longPoolName)-1] = '\0';
+
+    res = OS_MemPoolCreate(&poolIds[0], longPoolName, 32, 8, 0);
+    if (res == OS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-geometry-arg";
+
+    if ((OS_MemPoolCreate(&poolIds[0], "Pool1", 0, 8, 0) == OS_ERROR) &&
+        (OS_MemPoolCreate(&poolIds[0], "Pool1", 32, 0, 0) == OS_ERROR) &&
+        (OS_MemPoolCreate(&poolIds[0], "Pool1", 0x10000, 0x10000, 0) == OS_ERROR))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Reserved-flags-arg";
+
+    if (OS_MemPoolCreate(&poolIds[0], "Pool1", 32, 8, 1) == OS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 No-free-IDs";
+
+    for (i=0; i <= OS_MAX_MEM_POOLS; i++)
+    {
+        memset(poolName, '\0', sizeof(poolName));
+        UT_os_sprintf(poolName, "MEMPOOL%d", (int)i);
+
+        res = OS_MemPoolCreate(&poolIds[i], poolName, 32, 8, 0);
+        if (res != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    if ((i == OS_MAX_MEM_POOLS) && (res == OS_ERR_NO_FREE_IDS))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    for (j=0; j < i; j++)
+    {
+        OS_MemPoolDelete(poolIds[j]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Duplicate-name";
+
+    if (OS_MemPoolCreate(&poolIds[0], "DUPLICATE", 32, 8, 0) != OS_SUCCESS)
+    {
+        testDesc = "#6 Duplicate-name - Mem Pool Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        res = OS_MemPoolCreate(&poolIds[1], "DUPLICATE", 32, 8, 0);
+        if (res == OS_ERR_NAME_TAKEN)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_MemPoolDelete(poolIds[0]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#7 Nominal";
+
+    res = OS_MemPoolCreate(&poolIds[0], "Good", 32, 8, 0);
+    if ((res == OS_SUCCESS) && (OS_MemPoolDelete(poolIds[0]) == OS_SUCCESS))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_mempoolcreate_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_MemPoolCreate", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_MemPoolAlloc(uint32 pool_id, void **block)
+**         int32 OS_MemPoolFree(uint32 pool_id, void *block)
+** Purpose: Takes a block from, and returns a block to, a memory pool
+** Parameters: pool_id - id of the pool
+**             block - address of the block
+** Returns: OS_INVALID_POINTER if the block pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in is not a valid pool
+**          OS_ERR_POOL_EMPTY if the pool has no free blocks
+**          OS_ERROR_ADDRESS_MISALIGNED if the block is not the start of a block
+**          OS_ERROR if the block is not from this pool or is already free
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_mempoolallocfree_test(void)
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0, i = 0;
+    uint32 poolId = 0;
+    void *blocks[5];
+    void *extra = NULL;
+    OS_mem_pool_prop_t poolProp;
+    const char* testDesc = NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_MemPoolAlloc(99999, &extra);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_mempoolallocfree_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    if ((OS_MemPoolAlloc(99999, &extra) == OS_ERR_INVALID_ID) &&
+        (OS_MemPoolFree(99999, &extra) == OS_ERR_INVALID_ID))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    if (OS_MemPoolCreate(&poolId, "AllocFree", 20, 4, 0) != OS_SUCCESS)
+    {
+        testDesc = "#2 Null-pointer-arg - Mem Pool Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_mempoolallocfree_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Null-pointer-arg";
+
+    if ((OS_MemPoolAlloc(poolId, NULL) == OS_INVALID_POINTER) &&
+        (OS_MemPoolFree(poolId, NULL) == OS_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Pool-empty";
+
+    for (i=0; i < 5; i++)
+    {
+        res = OS_MemPoolAlloc(poolId, &blocks[i]);
+        if (res != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    if ((i == 4) && (res == OS_ERR_POOL_EMPTY))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Invalid-block-arg";
+
+    if ((i == 4) &&
+        (OS_MemPoolFree(poolId, &extra) == OS_ERROR) &&
+        (OS_MemPoolFree(poolId, (char *)blocks[0] + 1) == OS_ERROR_ADDRESS_MISALIGNED))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Double-free";
+
+    if ((i == 4) &&
+        (OS_MemPoolFree(poolId, blocks[3]) == OS_SUCCESS) &&
+        (OS_MemPoolFree(poolId, blocks[3]) == OS_ERROR))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Nominal";
+
+    res = OS_MemPoolAlloc(poolId, &extra);
+    if ((res == OS_SUCCESS) && (extra == blocks[3]) &&
+        (((cpuaddr)extra % 16) == 0) &&
+        (OS_MemPoolFree(poolId, extra) == OS_SUCCESS) &&
+        (OS_MemPoolGetInfo(poolId, &poolProp) == OS_SUCCESS) &&
+        (poolProp.block_size == 32) && (poolProp.num_blocks == 4) &&
+        (poolProp.blocks_free == 1) && (poolProp.blocks_used_max == 4) &&
+        (poolProp.alloc_count == 5) && (poolProp.alloc_failures == 1))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_MemPoolDelete(poolId);
+
+UT_os_mempoolallocfree_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_MemPoolAlloc/Free", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_MemPoolGetIdByName(uint32 *pool_id, const char *pool_name)
+** Purpose: Returns the id of the memory pool with the given name
+** Parameters: *pool_id - pointer that will hold the id of the pool
+**             *pool_name - name of the pool
+** Returns: OS_INVALID_POINTER if a pointer passed in is null
+**          OS_ERR_NAME_TOO_LONG if the name is too long
+**          OS_ERR_NAME_NOT_FOUND if no pool has the name
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_mempoolgetidbyname_test(void)
+{
+    UT_OsApiInfo_t apiInfo;
+    int32 res = 0, idx = 0;
+    uint32 poolId = 0, foundId = 0;
+    char longPoolName[OS_MAX_API_NAME+5];
+    const char* testDesc = NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_MemPoolGetIdByName(&foundId, "InvalidName");
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_mempoolgetidbyname_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_MemPoolGetIdByName(NULL, "InvalidName") == OS_INVALID_POINTER) &&
+        (OS_MemPoolGetIdByName(&foundId, NULL) == OS_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Name-too-long";
+
+    memset(longPoolName, 'Y', sizeof(longPoolName));
+    longPoolName[sizeof(longPoolName)-1] = '\0';
+
+    res = OS_MemPoolGetIdByName(&foundId, longPoolName);
+    if (res == OS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Name-not-found";
+
+    res = OS_MemPoolGetIdByName(&foundId, "NameNotFound");
+    if (res == OS_ERR_NAME_NOT_FOUND)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    if (OS_MemPoolCreate(&poolId, "Good", 32, 8, 0) != OS_SUCCESS)
+    {
+        testDesc = "#4 Nominal - Mem Pool Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_mempoolgetidbyname_test_exit_tag;
+    }
+
+    res = OS_MemPoolGetIdByName(&foundId, "Good");
+    if ((res == OS_SUCCESS) && (foundId == poolId))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_MemPoolDelete(poolId);
+
+UT_os_mempoolgetidbyname_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_MemPoolGetIdByName", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*================================================================================*
 ** End of File: ut_oscore_misc_test.c
 **================================================================================*/
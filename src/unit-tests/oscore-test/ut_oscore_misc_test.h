@@ -44,10 +44,16 @@ void UT_os_milli2ticks_test(void);
 
 void UT_os_getlocaltime_test(void);
 void UT_os_setlocaltime_test(void);
+void UT_os_getmonotonictime_test(void);
 
 void UT_os_geterrorname_test(void);
 
 void UT_os_heapgetinfo_test(void);
+void UT_os_memlockgetinfo_test(void);
+
+void UT_os_mempoolcreate_test(void);
+void UT_os_mempoolallocfree_test(void);
+void UT_os_mempoolgetidbyname_test(void);
 
 /*--------------------------------------------------------------------------------*/
 
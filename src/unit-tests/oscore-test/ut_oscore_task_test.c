@@ -669,6 +669,105 @@ UT_os_task_delay_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_TaskDelayUntil
+** Purpose: Suspends the calling task until the next release of its periodic schedule
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERROR if the schedule was not initialized or sleep failed
+**          OS_ERR_PERIOD_OVERRUN if the release time had already passed
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_task_delay_until_test()
+{
+    int32 res=0, idx=0, i=0;
+    UT_OsApiInfo_t apiInfo;
+    OS_task_period_t period;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TaskPeriodInit(&period, 10000);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_task_delay_until_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_TaskPeriodInit(NULL, 10000) == OS_INVALID_POINTER) &&
+        (OS_TaskDelayUntil(NULL) == OS_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-period-arg";
+
+    res = OS_TaskPeriodInit(&period, 0);
+    if (res == OS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Period-overrun";
+
+    res = OS_TaskPeriodInit(&period, 1000);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#3 Period-overrun - Period-Init failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        /* Sleep past several release times */
+        OS_TaskDelay(20);
+
+        res = OS_TaskDelayUntil(&period);
+        if ((res == OS_ERR_PERIOD_OVERRUN) && (period.overruns == 1) &&
+            (period.last_missed > 0) && (period.missed_periods == period.last_missed))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    res = OS_TaskPeriodInit(&period, 20000);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#4 Nominal - Period-Init failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        for (i = 0; i < 5; i++)
+        {
+            res = OS_TaskDelayUntil(&period);
+            if (res != OS_SUCCESS)
+            {
+                break;
+            }
+        }
+
+        if (res == OS_SUCCESS)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+UT_os_task_delay_until_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TaskDelayUntil", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: OS_TaskSetPriority
 ** Purpose: Sets task priority for the given task id
@@ -1161,6 +1260,103 @@ UT_os_task_get_info_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_TaskGetStats
+** Purpose: Returns runtime statistics about the given task id
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in is not a valid task id
+**          OS_ERROR if the OS calls to get the statistics fail
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_task_get_stats_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    OS_task_stats_t task_stats;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TaskGetStats(99999, &task_stats);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_task_get_stats_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    res = OS_TaskGetStats(99999, &task_stats);
+    if (res == OS_ERR_INVALID_ID)
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-pointer-arg";
+
+    /* Setup */
+    res = OS_TaskCreate(&g_task_ids[2], g_task_names[2], generic_test_task, g_task_stacks[2],
+                        UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#2 Invalid-pointer-arg - Task-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        res = OS_TaskGetStats(g_task_ids[2], NULL);
+        if (res == OS_INVALID_POINTER)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Delay to let child task run */
+        OS_TaskDelay(500);
+
+        /* Reset test environment */
+        res = OS_TaskDelete(g_task_ids[2]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    /* Setup */
+    res = OS_TaskCreate(&g_task_ids[3], g_task_names[3], generic_test_task, g_task_stacks[3],
+                        UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#3 Nominal - Task-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        /* Delay to let child task run and use some of its stack */
+        OS_TaskDelay(500);
+
+        res = OS_TaskGetStats(g_task_ids[3], &task_stats);
+        if ((res == OS_SUCCESS) &&
+            (task_stats.voluntary_switches > 0) &&
+            (task_stats.stack_high_water > 0) &&
+            (task_stats.stack_high_water <= task_stats.stack_size))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        res = OS_TaskDelete(g_task_ids[3]);
+    }
+
+UT_os_task_get_stats_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TaskGetStats", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*================================================================================*
 ** End of File: ut_oscore_task_test.c
 **================================================================================*/
@@ -44,7 +44,9 @@ void UT_os_task_register_test(void);
 void UT_os_task_get_id(void);
 void UT_os_task_get_id_by_name_test(void);
 void UT_os_task_get_info_test(void);
+void UT_os_task_get_stats_test(void);
 void UT_os_task_delay_test(void);
+void UT_os_task_delay_until_test(void);
 void UT_os_task_get_id_test(void);
 
 /*--------------------------------------------------------------------------------*/
@@ -52,6 +52,7 @@ void UT_os_init_task_set_priority_test(void);
 void UT_os_init_task_get_id_test(void);
 void UT_os_init_task_get_id_by_name_test(void);
 void UT_os_init_task_get_info_test(void);
+void UT_os_init_task_get_stats_test(void);
 
 /*--------------------------------------------------------------------------------*
 ** Local function definitions
@@ -166,6 +167,16 @@ void UT_os_init_task_get_info_test()
     g_task_names[3] = "GetInfo_Nominal";
 }
 
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_init_task_get_stats_test()
+{
+    g_task_names[0] = "GetStats_NotImpl";
+    g_task_names[1] = "GetStats_InvId";
+    g_task_names[2] = "GetStats_InvPtr";
+    g_task_names[3] = "GetStats_Nominal";
+}
+
 /*--------------------------------------------------------------------------------*
 ** Main
 **--------------------------------------------------------------------------------*/
@@ -234,6 +245,7 @@ void OS_Application_Startup(void)
 
     UT_os_init_task_delay_test();
     UT_os_task_delay_test();
+    UT_os_task_delay_until_test();
 
     UT_os_init_task_set_priority_test();
     UT_os_task_set_priority_test();
@@ -252,6 +264,9 @@ void OS_Application_Startup(void)
     UT_os_init_task_get_info_test();
     UT_os_task_get_info_test();
 
+    UT_os_init_task_get_stats_test();
+    UT_os_task_get_stats_test();
+
     UT_os_geterrorname_test();
 
     UT_os_tick2micros_test();
@@ -261,6 +276,14 @@ void OS_Application_Startup(void)
     UT_os_getlocaltime_test();
     UT_OS_LOG_MACRO("============================================\n")
     UT_os_setlocaltime_test();
+    UT_os_getmonotonictime_test();
+
+    UT_os_heapgetinfo_test();
+    UT_os_memlockgetinfo_test();
+
+    UT_os_mempoolcreate_test();
+    UT_os_mempoolallocfree_test();
+    UT_os_mempoolgetidbyname_test();
 
     UT_os_teardown("ut_oscore");
 
@@ -263,8 +263,14 @@ void OS_Application_Startup(void)
     UT_os_getlocaltime_test();
     UT_OS_LOG_MACRO("============================================\n")
     UT_os_setlocaltime_test();
+    UT_os_getmonotonictime_test();
 
     UT_os_heapgetinfo_test();
+    UT_os_memlockgetinfo_test();
+
+    UT_os_mempoolcreate_test();
+    UT_os_mempoolallocfree_test();
+    UT_os_mempoolgetidbyname_test();
 
     UT_os_int_attachhandler_test();
     UT_os_int_enable_test();
@@ -759,6 +759,155 @@ UT_os_rewinddir_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_ReadDirBatch(os_dirp_t directory, os_dirent_info_t *entries,
+**                              uint32 max_entries)
+** Purpose: Reads several directory entries, with their type, size and time
+** Parameters: directory - a directory descriptor pointer that was returned from
+**                         a call to OS_opendir()
+**             *entries - array that will hold the entries read
+**             max_entries - number of elements in entries
+** Returns: OS_FS_ERR_INVALID_POINTER if a pointer passed in is NULL
+**          OS_FS_ERROR if OS call failed
+**          The number of entries read, 0 at the end of the directory
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null directory and a null entries pointer
+**   2) Expect both returned values to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Call OS_mkdir() to create a directory, and create a subdirectory and a
+**      file with some data in it
+**   2) Call OS_opendir() with directory name used in #1 as argument
+**   3) Call this routine repeatedly for one entry at a time until it returns 0
+**   4) Expect 4 entries in all, with the file reported as a file of the size
+**      written and the subdirectory reported as a directory
+**   5) Call OS_rewinddir() and this routine for all entries at once
+**   6) Expect the returned value to be
+**        (a) 4
+**--------------------------------------------------------------------------------*/
+void UT_os_readdirbatch_test()
+{
+    int32 idx=0, fileDesc=-1, status=0, numEntries=0;
+    boolean fileOk=FALSE, dirOk=FALSE;
+    os_dirp_t dirHdl=NULL;
+    os_dirent_info_t entries[UT_OS_FILE_MAX_DIRS];
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    strcpy(g_subdirNames[0], " ");
+    strcpy(g_fileName, " ");
+    strcpy(g_dirName, " ");
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_ReadDirBatch(NULL, NULL, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_readdirbatch_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_dirName, '\0', sizeof(g_dirName));
+    snprintf(g_dirName, sizeof(g_dirName), "%s/rdbatch_Nominal", g_mntName);
+    if (OS_mkdir(g_dirName, 755) != OS_FS_SUCCESS)
+    {
+        testDesc = "#1 Null-pointer-arg - Dir-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_readdirbatch_test_exit_tag;
+    }
+
+    dirHdl = OS_opendir(g_dirName);
+    if ((OS_ReadDirBatch(NULL, entries, UT_OS_FILE_MAX_DIRS) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_ReadDirBatch(dirHdl, NULL, UT_OS_FILE_MAX_DIRS) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    OS_closedir(dirHdl);
+    dirHdl = NULL;
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    memset(g_subdirNames[0], '\0', sizeof(g_subdirNames[0]));
+    memset(g_fileName, '\0', sizeof(g_fileName));
+    if ((snprintf(g_subdirNames[0], sizeof(g_subdirNames[0]), "%s/%s",
+                  g_dirName, g_tgtSubdirs[0]) >= (int)sizeof(g_subdirNames[0])) ||
+        (snprintf(g_fileName, sizeof(g_fileName), "%s/rdbatch_File.txt",
+                  g_dirName) >= (int)sizeof(g_fileName)))
+    {
+        testDesc = "#2 Nominal - Path-too-long";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_readdirbatch_test_exit_tag;
+    }
+
+    fileDesc = OS_creat(g_fileName, OS_READ_WRITE);
+    if ((OS_mkdir(g_subdirNames[0], 755) != OS_FS_SUCCESS) ||
+        (fileDesc < 0) ||
+        (OS_write(fileDesc, "0123456789", 10) != 10))
+    {
+        testDesc = "#2 Nominal - Dir/file-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_readdirbatch_test_exit_tag;
+    }
+
+    dirHdl = OS_opendir(g_dirName);
+    if (dirHdl == NULL)
+    {
+        testDesc = "#2 Nominal - Dir-open failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_readdirbatch_test_exit_tag;
+    }
+
+    /* One entry per call, so every call has to carry on where the last one stopped */
+    status = OS_ReadDirBatch(dirHdl, entries, 1);
+    while (status == 1 && numEntries < 2 * UT_OS_FILE_MAX_DIRS)
+    {
+        ++numEntries;
+        if ((strcmp(entries[0].FileName, "rdbatch_File.txt") == 0) &&
+            (entries[0].FileType == OS_DIRENT_TYPE_FILE) &&
+            (entries[0].FileSize == 10))
+            fileOk = TRUE;
+        else if ((strcmp(entries[0].FileName, g_tgtSubdirs[0]) == 0) &&
+                 (entries[0].FileType == OS_DIRENT_TYPE_DIR))
+            dirOk = TRUE;
+
+        status = OS_ReadDirBatch(dirHdl, entries, 1);
+    }
+
+    OS_rewinddir(dirHdl);
+
+    if ((status == 0) && (numEntries == 4) && (fileOk == TRUE) && (dirOk == TRUE) &&
+        (OS_ReadDirBatch(dirHdl, entries, UT_OS_FILE_MAX_DIRS) == 4))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_readdirbatch_test_exit_tag:
+    /* Reset test environment */
+    OS_closedir(dirHdl);
+    OS_close(fileDesc);
+    OS_remove(g_fileName);
+    OS_rmdir(g_subdirNames[0]);
+    OS_rmdir(g_dirName);
+
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_ReadDirBatch", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: int32 OS_rmdir(const char *path)
 ** Purpose: Removes the specified directory
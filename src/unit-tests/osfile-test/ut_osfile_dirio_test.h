@@ -40,6 +40,7 @@ void UT_os_opendir_test(void);
 void UT_os_closedir_test(void);
 void UT_os_readdir_test(void);
 void UT_os_rewinddir_test(void);
+void UT_os_readdirbatch_test(void);
 void UT_os_removedir_test(void);
 
 /*--------------------------------------------------------------------------------*/
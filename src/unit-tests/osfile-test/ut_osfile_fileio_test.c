@@ -636,6 +636,92 @@ UT_os_openfile_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_openPrealloc(const char *path, int32 access, uint32 mode,
+**                              int64 size_hint)
+** Purpose: Opens a file and allocates blocks for size_hint bytes of it
+** Parameters: *path - pointer to the absolute path name of the file
+**             access - access flags, as for OS_open
+**             mode - file permission mode, as for OS_open
+**             size_hint - number of bytes to allocate blocks for
+** Returns: as for OS_open
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Call this routine with a size hint of 1 MB
+**   2) Expect the returned value to be
+**        (a) a file descriptor value greater than or equal to 0 __and__
+**        (b) the file size to be 0
+**   3) Call OS_write() to append to the file
+**   4) Expect the file size to be the number of bytes written
+**--------------------------------------------------------------------------------*/
+void UT_os_openprealloc_test()
+{
+    int32 idx=0;
+    os_fstat64_t fstats1, fstats2;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_openPrealloc(NULL, OS_READ_WRITE, 0644, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_openprealloc_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_openPrealloc(NULL, OS_READ_WRITE, 0644, 4096) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Prealloc_Nom.txt", g_mntName);
+
+    g_fDescs[0] = OS_openPrealloc(g_fNames[0], OS_WRITE_ONLY, 0644, 1024 * 1024);
+    if (g_fDescs[0] < 0)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        goto UT_os_openprealloc_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "SOMETHING IS ROTTEN IN THE STATE OF DENMARK");
+    if ((OS_stat64(g_fNames[0], &fstats1) == OS_FS_SUCCESS) &&
+        (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) == strlen(g_writeBuff)) &&
+        (OS_stat64(g_fNames[0], &fstats2) == OS_FS_SUCCESS) &&
+        (fstats1.FileSize == 0) && (fstats2.FileSize == strlen(g_writeBuff)))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_openprealloc_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_openPrealloc", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: int32 OS_close(int32 filedes)
 ** Purpose: Closes a file of a given file descriptor
@@ -1085,18 +1171,15 @@ UT_os_writefile_test_exit_tag:
 }
 
 /*--------------------------------------------------------------------------------*
-** Syntax: int32 OS_lseek(int32 filedes, int32 offset, uint32 whence)
-** Purpose: Moves the read/write pointer of a given file descriptor to the given offset
-** Parameters: filedes - file descriptor of the given file
-**             offset - number of bytes to offset the read/write pointer from its position
-**                      dictated by whence
-**             whence - tells offset where to begin offsetting
-**                         OS_SEEK_SET - starts at beginning of file
-**                         OS_SEEK_CUR - starts at the current read/write pointer
-**                         OS_SEEK_END - starts at the end of the file
-** Returns: OS_FS_ERR_INVALID_FD is the file descriptor passed in is invalid
-**          OS_FS_ERROR if the OS call failed or the whence value is invalid
-**          The new offset from the beginning of the given file
+** Syntax: int32 OS_readv(int32 filedes, const os_iovec_t *iov, int32 iovcnt)
+** Purpose: Reads from the file of a given file descriptor into a list of buffers
+** Parameters: filedes - a file descriptor
+**             *iov - array describing the buffers to fill
+**             iovcnt - number of entries in iov
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if the OS call failed
+**          The number of bytes read if succeeded
 **          OS_FS_UNIMPLEMENTED if not implemented
 ** -----------------------------------------------------
 ** Test #0: Not-implemented condition
@@ -1104,149 +1187,150 @@ UT_os_writefile_test_exit_tag:
 **   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
 **   3) Otherwise, continue
 ** -----------------------------------------------------
-** Test #1: Invalid-file-desc-arg condition
-**   1) Call this routine 3 times with a file descriptors of 0, -1, and (OS_MAX_NUM_OPEN_FILES+5)
-**      respectively as argument
-**   2) Expect all three returned values to be
-**        (a) OS_FS_ERR_INVALID_FD
-** -----------------------------------------------------
-** Test #2: Invalid-whence-arg condition
-**   1) Call this routine with invalid "whence" value as argument
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
 **   2) Expect the returned value to be
-**        (a) OS_FS_ERROR
-** -----------------------------------------------------
-** Test #3: OS-call-failure condition
-**   1) Setup the test to fail OS call inside this routine
-**   2) Call this routine
-**   3) Expect the returned value to be
-**        (a) OS_FS_ERROR
+**        (a) OS_FS_ERR_INVALID_POINTER
 ** -----------------------------------------------------
-** Test #4: Nominal condition
-**   1) Call OS_creat() to create and open a file
+** Test #2: Invalid-file-desc-arg condition
+**   1) Call this routine with an invalid file descriptor as argument
 **   2) Expect the returned value to be
-**        (a) a file descriptor value greater than or equal to 0
-**   3) Call OS_write() to write something to the file opened in #1
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call OS_creat() to create a file and OS_write() to write a string to it
+**   2) Call OS_lseek() to rewind to the beginning of the file
+**   3) Call this routine with two buffers that split the string
 **   4) Expect the returned value to be
-**        (a) the number of bytes that is equal to the number of bytes in the write buffer __and__
-**        (b) the file position is now at the end of the file
-**   5) Call this routine repeatedly with the file descriptor returned in #1, and different
-**      offset and whence value each time
-**   6) Expect the returned value each time to be
-**        (a) the expected file position value given the arguments
+**        (a) the length of the string __and__
+**        (b) the two buffers to hold the two parts of the string
 **--------------------------------------------------------------------------------*/
-void UT_os_lseekfile_test()
+void UT_os_readvfile_test()
 {
+    int32 idx=0;
     UT_OsApiInfo_t apiInfo;
+    os_iovec_t iov[2];
     const char* testDesc=NULL;
-    int32 idx=0, buffLen=0, pos1=0, pos2=0, pos3=0;
 
     UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
 
     /*-----------------------------------------------------*/
     testDesc = "API not implemented";
 
-    if (OS_lseek(99999, 0, OS_SEEK_CUR) == OS_FS_UNIMPLEMENTED)
+    if (OS_readv(99999, NULL, 0) == OS_FS_UNIMPLEMENTED)
     {
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
-        goto UT_os_lseekfile_test_exit_tag;
+        goto UT_os_readvfile_test_exit_tag;
     }
 
     /*-----------------------------------------------------*/
-    testDesc = "#1 Invalid-file-desc-arg";
+    testDesc = "#1 Null-pointer-arg";
 
-    if (OS_lseek(99999, 0, OS_SEEK_SET) == OS_FS_ERR_INVALID_FD)
+    if (OS_readv(0, NULL, 1) == OS_FS_ERR_INVALID_POINTER)
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#2 Invalid-whence-arg";
+    testDesc = "#2 Invalid-file-desc-arg";
 
-    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
-    UT_os_sprintf(g_fNames[0], "%s/Seek_InvWhence.txt", g_mntName);
-    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
-    if (g_fDescs[0] < 0)
-    {
-        testDesc = "#2 Invalid-whence-arg - File-create failed";
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-    }
+    iov[0].iov_base = g_readBuff;
+    iov[0].iov_len  = sizeof(g_readBuff);
+    if (OS_readv(99999, iov, 1) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
-    {
-        if (OS_lseek(g_fDescs[0], 0, 123456) == OS_FS_ERROR)
-            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
-        else
-            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-    }
-
-    /* Reset test environment */
-    OS_close(g_fDescs[0]);
-    OS_remove(g_fNames[0]);
-
-    /*-----------------------------------------------------*/
-    testDesc = "#3 OS-call-failure";
-
-    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#4 Nominal";
+    testDesc = "#3 Nominal";
 
     memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
-    UT_os_sprintf(g_fNames[0], "%s/Seek_Nominal.txt", g_mntName);
+    UT_os_sprintf(g_fNames[0], "%s/Readv_Nominal.txt", g_mntName);
 
     g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
     if (g_fDescs[0] < 0)
     {
-        testDesc = "#4 Nominal - File-create failed";
+        testDesc = "#3 Nominal - File-create failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_lseekfile_test_exit_tag;
+        goto UT_os_readvfile_test_exit_tag;
     }
 
     memset(g_writeBuff, '\0', sizeof(g_writeBuff));
-    strcpy(g_writeBuff, "THE BROWN FOX JUMPS OVER THE LAZY DOG.");
-    buffLen = (int32)strlen(g_writeBuff);
-
-    if (OS_write(g_fDescs[0], g_writeBuff, buffLen) != buffLen)
+    strcpy(g_writeBuff, "HEADERPAYLOAD");
+    if ((OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff)) ||
+        (OS_lseek(g_fDescs[0], 0, OS_SEEK_SET) != OS_FS_SUCCESS))
     {
-        testDesc = "#4 Nominal - File-write failed";
+        testDesc = "#3 Nominal - File-write failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_lseekfile_test_exit_tag;
+
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+
+        goto UT_os_readvfile_test_exit_tag;
     }
 
-    pos1 = OS_lseek(g_fDescs[0], 10, OS_SEEK_SET);
-    pos2 = OS_lseek(g_fDescs[0], 7, OS_SEEK_CUR);
-    pos3 = OS_lseek(g_fDescs[0], -16, OS_SEEK_END);
-    if ((pos1 < 0) || (g_writeBuff[pos1] != 'F') ||
-        (pos2 < 0) || (g_writeBuff[pos2] != 'P') ||
-        (pos3 < 0) || (g_writeBuff[pos3] != 'E'))
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-    else
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    iov[0].iov_base = g_readBuff;
+    iov[0].iov_len  = 6;
+    iov[1].iov_base = g_readBuff + 10;
+    iov[1].iov_len  = sizeof(g_readBuff) - 10;
+    if ((OS_readv(g_fDescs[0], iov, 2) == strlen(g_writeBuff)) &&
+        (strncmp(g_readBuff, "HEADER", 6) == 0) &&
+        (strcmp(g_readBuff + 10, "PAYLOAD") == 0))
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /* Reset test environment */
     OS_close(g_fDescs[0]);
     OS_remove(g_fNames[0]);
 
-UT_os_lseekfile_test_exit_tag:
-    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_lseek", idx)
+UT_os_readvfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_readv", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
 /*--------------------------------------------------------------------------------*
-** Syntax: int32 OS_chmod(const char *path, uint32 access)
-** Purpose: Changes access mode of a given file name
-** Parameters: *path - pointer to the path/name of the given file
-**             access - file access flags
-** Returns: OS_FS_UNIMPLEMENTED if not implemented
+** Syntax: int32 OS_writev(int32 filedes, const os_iovec_t *iov, int32 iovcnt)
+** Purpose: Writes a list of buffers to the file of a given file descriptor
+** Parameters: filedes - a file descriptor
+**             *iov - array describing the buffers to write
+**             iovcnt - number of entries in iov
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if the OS call failed
+**          The number of bytes written if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
 ** -----------------------------------------------------
 ** Test #0: Not-implemented condition
 **   1) Call this routine
 **   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
 **   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-file-desc-arg condition
+**   1) Call this routine with an invalid file descriptor as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call OS_creat() to create a file
+**   2) Call this routine with a header, a payload and a trailer buffer
+**   3) Expect the returned value to be
+**        (a) the total length of the three buffers
+**   4) Call OS_lseek() and OS_read() to read the file back
+**   5) Expect the file to hold the three buffers one after the other
 **--------------------------------------------------------------------------------*/
-void UT_os_chmodfile_test()
+void UT_os_writevfile_test()
 {
     int32 idx=0;
     UT_OsApiInfo_t apiInfo;
+    os_iovec_t iov[3];
     const char* testDesc=NULL;
 
     UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
@@ -1254,27 +1338,80 @@ void UT_os_chmodfile_test()
     /*-----------------------------------------------------*/
     testDesc = "API not implemented";
 
-    if (OS_chmod(NULL, 0644) == OS_FS_UNIMPLEMENTED)
+    if (OS_writev(99999, NULL, 0) == OS_FS_UNIMPLEMENTED)
     {
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
-        goto UT_os_chmodfile_test_exit_tag;
+        goto UT_os_writevfile_test_exit_tag;
     }
 
-UT_os_chmodfile_test_exit_tag:
-    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_chmod", idx)
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_writev(0, NULL, 1) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-file-desc-arg";
+
+    iov[0].iov_base = g_writeBuff;
+    iov[0].iov_len  = sizeof(g_writeBuff);
+    if (OS_writev(99999, iov, 1) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Writev_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#3 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_writevfile_test_exit_tag;
+    }
+
+    iov[0].iov_base = "HEADER";
+    iov[0].iov_len  = 6;
+    iov[1].iov_base = "PAYLOAD";
+    iov[1].iov_len  = 7;
+    iov[2].iov_base = "CRC";
+    iov[2].iov_len  = 3;
+
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if ((OS_writev(g_fDescs[0], iov, 3) == 16) &&
+        (OS_lseek(g_fDescs[0], 0, OS_SEEK_SET) == OS_FS_SUCCESS) &&
+        (OS_read(g_fDescs[0], g_readBuff, sizeof(g_readBuff)) == 16) &&
+        (strcmp(g_readBuff, "HEADERPAYLOADCRC") == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_writevfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_writev", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
 /*--------------------------------------------------------------------------------*
-** Syntax: int32 OS_stat(const char *path, os_fstat_t *filestats)
-** Purpose: Returns file information about a given file name
-** Parameters: *path - pointer to the file/name of a given file
-**             *filestats - pointer that will hold file information
-** Returns: OS_FS_ERR_INVALID_POINTER if any of the pointers passed in is null
-**          OS_FS_ERR_PATH_INVALID if the path is invalid
-**          OS_FS_ERR_PATH_TOO_LONG if the path name is too long
+** Syntax: int32 OS_pread(int32 filedes, void *buffer, uint32 nbytes, int64 offset)
+** Purpose: Reads nbytes from the given offset of the file of a given file descriptor
+** Parameters: filedes - a file descriptor
+**             *buffer - pointer that will hold the data read from file
+**             nbytes - the maximum number of bytes to copy to buffer
+**             offset - position in the file to read from
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
 **          OS_FS_ERROR if the OS call failed
-**          OS_FS_SUCCESS if succeeded
+**          The number of bytes read if succeeded
 **          OS_FS_UNIMPLEMENTED if not implemented
 ** -----------------------------------------------------
 ** Test #0: Not-implemented condition
@@ -1287,153 +1424,110 @@ UT_os_chmodfile_test_exit_tag:
 **   2) Expect the returned value to be
 **        (a) OS_FS_ERR_INVALID_POINTER
 ** -----------------------------------------------------
-** Test #2: Invalid-path-arg condition
-**   1) Call this routine with a non-existing path as argument
+** Test #2: Invalid-file-desc-arg condition
+**   1) Call this routine with an invalid file descriptor as argument
 **   2) Expect the returned value to be
-**        (a) OS_FS_ERR_PATH_INVALID
+**        (a) OS_FS_ERR_INVALID_FD
 ** -----------------------------------------------------
-** Test #3: Path-too-long-arg condition
-**   1) Call this routine with a path of length greater than OS_MAX_PATH_LEN as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERR_PATH_TOO_LONG
-** -----------------------------------------------------
-** Test #4: OS-call-failure condition
-**   1) Setup the test to fail the OS call inside this routine
-**   2) Call this routine
+** Test #3: Nominal condition
+**   1) Call OS_creat() to create a file and OS_write() to write a string to it
+**   2) Call this routine to read the middle of the string
 **   3) Expect the returned value to be
-**        (a) OS_FS_ERROR
-** -----------------------------------------------------
-** Test #5: Nominal condition
-**   1) Call OS_creat() to create and open a file
-**   2) Expect the returned value to be
-**        (a) a file descriptor value greater than or equal to 0
-**   3) Call this routine with the file name used in #1
-**   4) Expect the returned value to be
-**        (a) OS_FS_SUCCESS
-**   5) Call OS_write() to cause a file modification to occur
-**   6) Expect the returned value to be
-**        (a) number of bytes written to be equal to the length of write buffer
-**   7) Call OS_close() to flush and close the file written to in #5
-**   8) Expect the returned value to be
-**        (a) OS_FS_SUCCESS
-**   9) Call this routine again with the file name used in #1
-**  10) Expect the returned value to be
-**        (a) OS_FS_SUCCESS __and__
-**        (b) fstats1 returned in #3 and fstats2 returned in #9 to be not equal
+**        (a) the number of bytes asked for __and__
+**        (b) the buffer to hold that part of the string
+**   4) Call OS_lseek() to get the file position
+**   5) Expect it to still be the end of the string
 **--------------------------------------------------------------------------------*/
-void UT_os_statfile_test()
+void UT_os_preadfile_test()
 {
     int32 idx=0;
     UT_OsApiInfo_t apiInfo;
     const char* testDesc=NULL;
-    os_fstat_t fstats1, fstats2;
 
     UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
 
     /*-----------------------------------------------------*/
     testDesc = "API not implemented";
 
-    if (OS_stat(NULL, NULL) == OS_FS_UNIMPLEMENTED)
+    if (OS_pread(99999, NULL, 0, 0) == OS_FS_UNIMPLEMENTED)
     {
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
-        goto UT_os_statfile_test_exit_tag;
+        goto UT_os_preadfile_test_exit_tag;
     }
 
     /*-----------------------------------------------------*/
     testDesc = "#1 Null-pointer-arg";
 
-    if ((OS_stat(NULL, &fstats1) == OS_FS_ERR_INVALID_POINTER) &&
-        (OS_stat(g_fNames[0], NULL) == OS_FS_ERR_INVALID_POINTER))
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
-    else
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-
-    /*-----------------------------------------------------*/
-    testDesc = "#2 Invalid-path-arg";
-
-    if (OS_stat(g_invalidPath, &fstats1) == OS_FS_ERR_PATH_INVALID)
+    if (OS_pread(0, NULL, sizeof(g_readBuff), 0) == OS_FS_ERR_INVALID_POINTER)
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#3 Path-too-long-arg";
+    testDesc = "#2 Invalid-file-desc-arg";
 
-    if (OS_stat(g_longPathName, &fstats1) == OS_FS_ERR_PATH_TOO_LONG)
+    if (OS_pread(99999, g_readBuff, sizeof(g_readBuff), 0) == OS_FS_ERR_INVALID_FD)
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#4 OS-call-failure";
-
-    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
-
-    /*-----------------------------------------------------*/
-    testDesc = "#5 Nominal";
+    testDesc = "#3 Nominal";
 
     memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
-    UT_os_sprintf(g_fNames[0], "%s/Stat_Nominal.txt", g_mntName);
+    UT_os_sprintf(g_fNames[0], "%s/Pread_Nominal.txt", g_mntName);
 
     g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
     if (g_fDescs[0] < 0)
     {
-        testDesc = "#5 Nominal - File-create failed";
+        testDesc = "#3 Nominal - File-create failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_statfile_test_exit_tag;
-    }
-
-    if (OS_stat(g_fNames[0], &fstats1) != OS_FS_SUCCESS)
-    {
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-        goto UT_os_statfile_test_exit_tag;
+        goto UT_os_preadfile_test_exit_tag;
     }
 
     memset(g_writeBuff, '\0', sizeof(g_writeBuff));
-    strcpy(g_writeBuff, "HOW NOW, BROWN COW?");
+    strcpy(g_writeBuff, "0123456789ABCDEF");
     if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
     {
-        testDesc = "#5 Nominal - File-write failed";
+        testDesc = "#3 Nominal - File-write failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_statfile_test_exit_tag;
-    }
 
-    if (OS_close(g_fDescs[0]) != OS_FS_SUCCESS)
-    {
-        testDesc = "#5 Nominal - File-close failed";
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_statfile_test_exit_tag;
-    }
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
 
-    if (OS_stat(g_fNames[0], &fstats2) != OS_FS_SUCCESS)
-    {
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-        goto UT_os_statfile_test_exit_tag;
+        goto UT_os_preadfile_test_exit_tag;
     }
 
-    if (memcmp(&fstats1, &fstats2, sizeof(fstats1)) != 0)
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if ((OS_pread(g_fDescs[0], g_readBuff, 4, 10) == 4) &&
+        (strcmp(g_readBuff, "ABCD") == 0) &&
+        (OS_lseek(g_fDescs[0], 0, OS_SEEK_CUR) == strlen(g_writeBuff)))
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /* Reset test environment */
+    OS_close(g_fDescs[0]);
     OS_remove(g_fNames[0]);
 
-UT_os_statfile_test_exit_tag:
-    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_stat", idx)
+UT_os_preadfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_pread", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
 /*--------------------------------------------------------------------------------*
-** Syntax: int32 OS_remove(const char *path)
-** Purpose: Removes the given file name
-** Parameters: *path - pointer to the path/name of the file to be removed
+** Syntax: int32 OS_pwrite(int32 filedes, void *buffer, uint32 nbytes, int64 offset)
+** Purpose: Writes nbytes from the given buffer at the given offset of the file of
+**          a given file descriptor
+** Parameters: filedes - a file descriptor
+**             *buffer - pointer that holds the data to be written to file
+**             nbytes - the maximum number of bytes to copy to file
+**             offset - position in the file to write to
 ** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
-**          OS_FS_ERR_PATH_INVALID if the path is invalid
-**          OS_FS_ERR_PATH_TOO_LONG if the path name is too long
-**          OS_FS_ERR_NAME_TOO_LONG if the name is too long
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
 **          OS_FS_ERROR if the OS call failed
-**          OS_FS_SUCCESS if succeeded
+**          The number of bytes written if succeeded
 **          OS_FS_UNIMPLEMENTED if not implemented
 ** -----------------------------------------------------
 ** Test #0: Not-implemented condition
@@ -1446,42 +1540,22 @@ UT_os_statfile_test_exit_tag:
 **   2) Expect the returned value to be
 **        (a) OS_FS_ERR_INVALID_POINTER
 ** -----------------------------------------------------
-** Test #2: Invalid-path-arg condition
-**   1) Call this routine with a non-existing path as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERR_PATH_INVALID
-** -----------------------------------------------------
-** Test #3: Path-too-long-arg condition
-**   1) Call this routine with a path of length greater than OS_MAX_PATH_LEN as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERR_PATH_TOO_LONG
-** -----------------------------------------------------
-** Test #4: Name-too-long-arg condition
-**   1) Call this routine with just a file name (no absolute path) as argument
+** Test #2: Invalid-file-desc-arg condition
+**   1) Call this routine with an invalid file descriptor as argument
 **   2) Expect the returned value to be
-**        (a) OS_FS_ERR_NAME_TOO_LONG
+**        (a) OS_FS_ERR_INVALID_FD
 ** -----------------------------------------------------
-** Test #5: OS-call-failure condition
-**   1) Setup the test to fail the OS call inside this routine
-**   2) Call this routine
+** Test #3: Nominal condition
+**   1) Call OS_creat() to create a file and OS_write() to write a string to it
+**   2) Call this routine to overwrite the middle of the string
 **   3) Expect the returned value to be
-**        (a) OS_FS_ERROR
-** -----------------------------------------------------
-** Test #6: Nominal condition
-**   1) Call OS_creat() to create and open a file
-**   2) Expect the returned value to be
-**        (a) a file descriptor value greater than or equal to 0
-**   3) Call this routine with path/file name used in #1 as argument
-**   4) Expect the returned value to be
-**        (a) OS_FS_SUCCESS
-**   5) Call OS_stat() to get file status on the deleted file
-**   6) Expect the returned values to be
-**        (a) OS_FS_ERROR
+**        (a) the number of bytes written
+**   4) Call OS_lseek() and OS_read() to read the file back
+**   5) Expect the string to hold the overwritten part
 **--------------------------------------------------------------------------------*/
-void UT_os_removefile_test()
+void UT_os_pwritefile_test()
 {
     int32 idx=0;
-    os_fstat_t fstats;
     UT_OsApiInfo_t apiInfo;
     const char* testDesc=NULL;
 
@@ -1490,95 +1564,80 @@ void UT_os_removefile_test()
     /*-----------------------------------------------------*/
     testDesc = "API not implemented";
 
-    if (OS_remove(NULL) == OS_FS_UNIMPLEMENTED)
+    if (OS_pwrite(99999, NULL, 0, 0) == OS_FS_UNIMPLEMENTED)
     {
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
-        goto UT_os_removefile_test_exit_tag;
+        goto UT_os_pwritefile_test_exit_tag;
     }
 
     /*-----------------------------------------------------*/
     testDesc = "#1 Null-pointer-arg";
 
-    if (OS_remove(NULL) == OS_FS_ERR_INVALID_POINTER)
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
-    else
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-
-    /*-----------------------------------------------------*/
-    testDesc = "#2 Invalid-path-arg";
-
-    if (OS_remove(g_invalidPath) == OS_FS_ERR_PATH_INVALID)
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
-    else
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-
-    /*-----------------------------------------------------*/
-    testDesc = "#3 Path-too-long-arg";
-
-    if (OS_remove(g_longPathName) == OS_FS_ERR_PATH_TOO_LONG)
+    if (OS_pwrite(0, NULL, sizeof(g_writeBuff), 0) == OS_FS_ERR_INVALID_POINTER)
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#4 Name-too-long-arg";
+    testDesc = "#2 Invalid-file-desc-arg";
 
-    if (OS_remove(g_longFileName) == OS_FS_ERR_NAME_TOO_LONG)
+    if (OS_pwrite(99999, g_writeBuff, sizeof(g_writeBuff), 0) == OS_FS_ERR_INVALID_FD)
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#5 OS-call-failure";
-
-    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
-
-    /*-----------------------------------------------------*/
-    testDesc = "#6 Nominal";
+    testDesc = "#3 Nominal";
 
     memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
-    UT_os_sprintf(g_fNames[0], "%s/Remove_Nominal.txt", g_mntName);
+    UT_os_sprintf(g_fNames[0], "%s/Pwrite_Nominal.txt", g_mntName);
 
-    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
     if (g_fDescs[0] < 0)
     {
-        testDesc = "#6 Nominal - File-create failed";
+        testDesc = "#3 Nominal - File-create failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_removefile_test_exit_tag;
+        goto UT_os_pwritefile_test_exit_tag;
     }
 
-    UT_os_print_fdtable("FD TABLE _AFTER_ FILE CREATION FOR OS_remove()");
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "0123456789ABCDEF");
+    if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
+    {
+        testDesc = "#3 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
 
-    /* TODO: Check to see if OS_remove() can delete an opened file.
-     *       If so, OS_FDTable should get clean up afterward. */
-    OS_close(g_fDescs[0]);
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
 
-    if (OS_remove(g_fNames[0]) != OS_FS_SUCCESS)
-    {
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-        goto UT_os_removefile_test_exit_tag;
+        goto UT_os_pwritefile_test_exit_tag;
     }
 
-    UT_os_print_fdtable("FD TABLE _AFTER_ FILE REMOVAL FOR OS_remove()");
-
-    if (OS_stat(g_fNames[0], &fstats) == OS_FS_ERROR)
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if ((OS_pwrite(g_fDescs[0], "wxyz", 4, 10) == 4) &&
+        (OS_lseek(g_fDescs[0], 0, OS_SEEK_SET) == OS_FS_SUCCESS) &&
+        (OS_read(g_fDescs[0], g_readBuff, sizeof(g_readBuff)) == strlen(g_writeBuff)) &&
+        (strcmp(g_readBuff, "0123456789wxyzEF") == 0))
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
-UT_os_removefile_test_exit_tag:
-    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_remove", idx)
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_pwritefile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_pwrite", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
 /*--------------------------------------------------------------------------------*
-** Syntax: int32 OS_rename(const char *old, const char *new)
-** Purpose: Renames the given file name to the new file name
-** Parameters: *old - pointer to the path/name of the file to be renamed
-**             *new - pointer to the new path/name of the file
-** Returns: OS_FS_ERR_INVALID_POINTER if any of the pointers passed in is null
-**          OS_FS_ERR_PATH_TOO_LONG if the path name is too long
-**          OS_FS_ERR_NAME_TOO_LONG if the name is too long
+** Syntax: int32 OS_fsync(int32 filedes)
+**         int32 OS_fdatasync(int32 filedes)
+** Purpose: Waits until the written data of a file is on the device
+** Parameters: filedes - file descriptor of the given file
+** Returns: OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
 **          OS_FS_ERROR if the OS call failed
 **          OS_FS_SUCCESS if succeeded
 **          OS_FS_UNIMPLEMENTED if not implemented
@@ -1588,47 +1647,20 @@ UT_os_removefile_test_exit_tag:
 **   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
 **   3) Otherwise, continue
 ** -----------------------------------------------------
-** Test #1: Null-pointer-arg condition
-**   1) Call this routine with a null pointer as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERR_INVALID_POINTER
-** -----------------------------------------------------
-** Test #2: Invalid-path-arg condition
-**   1) Call this routine with a non-existing path as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERR_PATH_INVALID
-** -----------------------------------------------------
-** Test #3: Path-too-long-arg condition
-**   1) Call this routine with a path of length greater than OS_MAX_PATH_LEN as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERR_PATH_TOO_LONG
-** -----------------------------------------------------
-** Test #4: Name-too-long-arg condition
-**   1) Call this routine with just a file name (no absolute path) as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERR_NAME_TOO_LONG
-** -----------------------------------------------------
-** Test #5: OS-call-failure condition
-**   1) Setup the test to fail the OS call inside this routine
-**   2) Call this routine
-**   3) Expect the returned value to be
-**        (a) OS_FS_ERROR
+** Test #1: Invalid-file-desc-arg condition
+**   1) Call OS_fsync and OS_fdatasync with an invalid file descriptor
+**   2) Expect both returned values to be
+**        (a) OS_FS_ERR_INVALID_FD
 ** -----------------------------------------------------
-** Test #6: Nominal condition
-**   1) Call OS_creat() to create and open a file
-**   2) Expect the returned value to be
-**        (a) a file descriptor value greater than or equal to 0
-**   3) Call this routine with path/file name used in #1 as argument for old name
-**   4) Expect the returned value to be
+** Test #2: Nominal condition
+**   1) Call OS_creat() to create and open a file, and OS_write() to write to it
+**   2) Call OS_fdatasync and OS_fsync with the file descriptor returned in #1
+**   3) Expect both returned values to be
 **        (a) OS_FS_SUCCESS
-**   5) Call OS_stat() to get file status on the old name used in #3
-**   6) Expect the returned values to be
-**        (a) OS_FS_ERROR
 **--------------------------------------------------------------------------------*/
-void UT_os_renamefile_test()
+void UT_os_fsync_test()
 {
     int32 idx=0;
-    os_fstat_t fstats;
     UT_OsApiInfo_t apiInfo;
     const char* testDesc=NULL;
 
@@ -1637,36 +1669,877 @@ void UT_os_renamefile_test()
     /*-----------------------------------------------------*/
     testDesc = "API not implemented";
 
-    if (OS_rename(NULL, NULL) == OS_FS_UNIMPLEMENTED)
+    if (OS_fsync(99999) == OS_FS_UNIMPLEMENTED)
     {
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
-        goto UT_os_renamefile_test_exit_tag;
+        goto UT_os_fsync_test_exit_tag;
     }
 
     /*-----------------------------------------------------*/
-    testDesc = "#1 Null-pointer-arg";
-
-    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
-    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
-    UT_os_sprintf(g_fNames[0], "%s/oldName.txt", g_mntName);
-    UT_os_sprintf(g_fNames[1], "%s/newName.txt", g_mntName);
+    testDesc = "#1 Invalid-file-desc-arg";
 
-    if ((OS_rename(NULL, g_fNames[1]) == OS_FS_ERR_INVALID_POINTER) &&
-        (OS_rename(g_fNames[0], NULL) == OS_FS_ERR_INVALID_POINTER))
+    if ((OS_fsync(99999) == OS_FS_ERR_INVALID_FD) &&
+        (OS_fdatasync(99999) == OS_FS_ERR_INVALID_FD))
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#2 Invalid-path-arg";
-
-    if (OS_rename(g_invalidPath, g_invalidPath) == OS_FS_ERR_PATH_INVALID)
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
-    else
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    testDesc = "#2 Nominal";
 
-    /*-----------------------------------------------------*/
-    testDesc = "#3 Path-too-long-arg";
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Fsync_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "NEITHER A BORROWER NOR A LENDER BE");
+    if ((g_fDescs[0] < 0) ||
+        (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff)))
+    {
+        testDesc = "#2 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        if (g_fDescs[0] >= 0)
+        {
+            OS_close(g_fDescs[0]);
+            OS_remove(g_fNames[0]);
+        }
+        goto UT_os_fsync_test_exit_tag;
+    }
+
+    if ((OS_fdatasync(g_fDescs[0]) == OS_FS_SUCCESS) &&
+        (OS_fsync(g_fDescs[0]) == OS_FS_SUCCESS))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_fsync_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_fsync/OS_fdatasync", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_fallocate(int32 filedes, uint32 mode, int64 offset, int64 length)
+** Purpose: Allocates or frees the blocks of a range of a file
+** Parameters: filedes - file descriptor of the given file
+**             mode - 0, OS_FALLOC_KEEP_SIZE or OS_FALLOC_PUNCH_HOLE
+**             offset - start of the range
+**             length - number of bytes in the range
+** Returns: OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if the mode or range is invalid or the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-file-desc-arg condition
+**   1) Call this routine with an invalid file descriptor
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #2: Invalid-arg condition
+**   1) Call this routine with an unknown mode, a negative offset and a zero length
+**   2) Expect all returned values to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call this routine with mode 0 for the first 64 KB
+**   3) Expect the file size to be 64 KB
+**   4) Call this routine with OS_FALLOC_KEEP_SIZE for the next 64 KB
+**   5) Expect the file size to still be 64 KB
+**   6) Call this routine with OS_FALLOC_PUNCH_HOLE for the first 4 KB
+**   7) Expect the file size to still be 64 KB
+**--------------------------------------------------------------------------------*/
+void UT_os_fallocate_test()
+{
+    int32 idx=0;
+    os_fstat64_t fstats1, fstats2, fstats3;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_fallocate(99999, 0, 0, 1) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_fallocate_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-file-desc-arg";
+
+    if (OS_fallocate(99999, 0, 0, 1) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Falloc_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#2 Invalid-arg - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_fallocate_test_exit_tag;
+    }
+
+    if ((OS_fallocate(g_fDescs[0], 0x80, 0, 1) == OS_FS_ERROR) &&
+        (OS_fallocate(g_fDescs[0], 0, -1, 1) == OS_FS_ERROR) &&
+        (OS_fallocate(g_fDescs[0], 0, 0, 0) == OS_FS_ERROR))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    if ((OS_fallocate(g_fDescs[0], 0, 0, 65536) == OS_FS_SUCCESS) &&
+        (OS_stat64(g_fNames[0], &fstats1) == OS_FS_SUCCESS) &&
+        (OS_fallocate(g_fDescs[0], OS_FALLOC_KEEP_SIZE, 65536, 65536) == OS_FS_SUCCESS) &&
+        (OS_stat64(g_fNames[0], &fstats2) == OS_FS_SUCCESS) &&
+        (OS_fallocate(g_fDescs[0], OS_FALLOC_PUNCH_HOLE, 0, 4096) == OS_FS_SUCCESS) &&
+        (OS_stat64(g_fNames[0], &fstats3) == OS_FS_SUCCESS) &&
+        (fstats1.FileSize == 65536) && (fstats2.FileSize == 65536) &&
+        (fstats3.FileSize == 65536))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_fallocate_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_fallocate", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_lseek(int32 filedes, int32 offset, uint32 whence)
+** Purpose: Moves the read/write pointer of a given file descriptor to the given offset
+** Parameters: filedes - file descriptor of the given file
+**             offset - number of bytes to offset the read/write pointer from its position
+**                      dictated by whence
+**             whence - tells offset where to begin offsetting
+**                         OS_SEEK_SET - starts at beginning of file
+**                         OS_SEEK_CUR - starts at the current read/write pointer
+**                         OS_SEEK_END - starts at the end of the file
+** Returns: OS_FS_ERR_INVALID_FD is the file descriptor passed in is invalid
+**          OS_FS_ERROR if the OS call failed or the whence value is invalid
+**          The new offset from the beginning of the given file
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-file-desc-arg condition
+**   1) Call this routine 3 times with a file descriptors of 0, -1, and (OS_MAX_NUM_OPEN_FILES+5)
+**      respectively as argument
+**   2) Expect all three returned values to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #2: Invalid-whence-arg condition
+**   1) Call this routine with invalid "whence" value as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: OS-call-failure condition
+**   1) Setup the test to fail OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #4: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Expect the returned value to be
+**        (a) a file descriptor value greater than or equal to 0
+**   3) Call OS_write() to write something to the file opened in #1
+**   4) Expect the returned value to be
+**        (a) the number of bytes that is equal to the number of bytes in the write buffer __and__
+**        (b) the file position is now at the end of the file
+**   5) Call this routine repeatedly with the file descriptor returned in #1, and different
+**      offset and whence value each time
+**   6) Expect the returned value each time to be
+**        (a) the expected file position value given the arguments
+**--------------------------------------------------------------------------------*/
+void UT_os_lseekfile_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    int32 idx=0, buffLen=0, pos1=0, pos2=0, pos3=0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_lseek(99999, 0, OS_SEEK_CUR) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_lseekfile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-file-desc-arg";
+
+    if (OS_lseek(99999, 0, OS_SEEK_SET) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-whence-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Seek_InvWhence.txt", g_mntName);
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#2 Invalid-whence-arg - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if (OS_lseek(g_fDescs[0], 0, 123456) == OS_FS_ERROR)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Seek_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#4 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_lseekfile_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "THE BROWN FOX JUMPS OVER THE LAZY DOG.");
+    buffLen = (int32)strlen(g_writeBuff);
+
+    if (OS_write(g_fDescs[0], g_writeBuff, buffLen) != buffLen)
+    {
+        testDesc = "#4 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_lseekfile_test_exit_tag;
+    }
+
+    pos1 = OS_lseek(g_fDescs[0], 10, OS_SEEK_SET);
+    pos2 = OS_lseek(g_fDescs[0], 7, OS_SEEK_CUR);
+    pos3 = OS_lseek(g_fDescs[0], -16, OS_SEEK_END);
+    if ((pos1 < 0) || (g_writeBuff[pos1] != 'F') ||
+        (pos2 < 0) || (g_writeBuff[pos2] != 'P') ||
+        (pos3 < 0) || (g_writeBuff[pos3] != 'E'))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_lseekfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_lseek", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int64 OS_lseek64(int32 filedes, int64 offset, uint32 whence)
+**         int64 OS_read64(int32 filedes, void *buffer, uint64 nbytes)
+**         int64 OS_write64(int32 filedes, void *buffer, uint64 nbytes)
+**         int32 OS_stat64(const char *path, os_fstat64_t *filestats)
+** Purpose: Seeks, reads, writes and stats files past the 2 GB limit of the
+**          32-bit calls
+** Parameters: filedes - file descriptor of the given file
+**             offset, whence - as for OS_lseek
+**             *buffer, nbytes - as for OS_read and OS_write
+**             *path, *filestats - as for OS_stat
+** Returns: OS_FS_ERR_INVALID_FD is the file descriptor passed in is invalid
+**          OS_FS_ERR_INVALID_POINTER if a pointer passed in is null
+**          OS_FS_ERROR if the OS call failed
+**          The new offset, the number of bytes read or written, or OS_FS_SUCCESS
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-file-desc-arg condition
+**   1) Call OS_lseek64, OS_read64 and OS_write64 with an invalid file descriptor
+**   2) Expect all returned values to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #2: Null-pointer-arg condition
+**   1) Call OS_read64, OS_write64 and OS_stat64 with a null pointer
+**   2) Expect all returned values to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call OS_lseek64 to move past 4 GB and OS_write64 to write a record there
+**   3) Call OS_stat64 on the file
+**   4) Expect the file size to be the offset plus the record length
+**   5) Call OS_lseek64 back to the record and OS_read64 to read it
+**   6) Expect the data read to match the data written
+**--------------------------------------------------------------------------------*/
+void UT_os_largefile_test()
+{
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    int32 idx=0;
+    int64 buffLen=0, offset=0;
+    os_fstat64_t fstats;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_lseek64(99999, 0, OS_SEEK_CUR) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_largefile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-file-desc-arg";
+
+    if ((OS_lseek64(99999, 0, OS_SEEK_SET) == OS_FS_ERR_INVALID_FD) &&
+        (OS_read64(99999, g_readBuff, 1) == OS_FS_ERR_INVALID_FD) &&
+        (OS_write64(99999, g_writeBuff, 1) == OS_FS_ERR_INVALID_FD))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Null-pointer-arg";
+
+    if ((OS_read64(0, NULL, 1) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_write64(0, NULL, 1) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_stat64(NULL, &fstats) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_stat64(g_mntName, NULL) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Seek64_Nom.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#3 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_largefile_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A RECORD PAST THE FOUR GIGABYTE MARK.");
+    buffLen = (int64)strlen(g_writeBuff);
+
+    /* The file is sparse, so this takes no real space on the disk */
+    offset = ((int64)5 << 30);
+    if ((OS_lseek64(g_fDescs[0], offset, OS_SEEK_SET) != offset) ||
+        (OS_write64(g_fDescs[0], g_writeBuff, buffLen) != buffLen))
+    {
+        testDesc = "#3 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+        goto UT_os_largefile_test_exit_tag;
+    }
+
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if ((OS_stat64(g_fNames[0], &fstats) == OS_FS_SUCCESS) &&
+        (fstats.FileSize == (uint64)(offset + buffLen)) &&
+        (OS_lseek64(g_fDescs[0], -buffLen, OS_SEEK_END) == offset) &&
+        (OS_read64(g_fDescs[0], g_readBuff, sizeof(g_readBuff)) == buffLen) &&
+        (strncmp(g_readBuff, g_writeBuff, buffLen) == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_largefile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_lseek64/OS_read64/OS_write64/OS_stat64", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_chmod(const char *path, uint32 access)
+** Purpose: Changes access mode of a given file name
+** Parameters: *path - pointer to the path/name of the given file
+**             access - file access flags
+** Returns: OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+**--------------------------------------------------------------------------------*/
+void UT_os_chmodfile_test()
+{
+    int32 idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_chmod(NULL, 0644) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_chmodfile_test_exit_tag;
+    }
+
+UT_os_chmodfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_chmod", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_stat(const char *path, os_fstat_t *filestats)
+** Purpose: Returns file information about a given file name
+** Parameters: *path - pointer to the file/name of a given file
+**             *filestats - pointer that will hold file information
+** Returns: OS_FS_ERR_INVALID_POINTER if any of the pointers passed in is null
+**          OS_FS_ERR_PATH_INVALID if the path is invalid
+**          OS_FS_ERR_PATH_TOO_LONG if the path name is too long
+**          OS_FS_ERROR if the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-path-arg condition
+**   1) Call this routine with a non-existing path as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_INVALID
+** -----------------------------------------------------
+** Test #3: Path-too-long-arg condition
+**   1) Call this routine with a path of length greater than OS_MAX_PATH_LEN as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_TOO_LONG
+** -----------------------------------------------------
+** Test #4: OS-call-failure condition
+**   1) Setup the test to fail the OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Expect the returned value to be
+**        (a) a file descriptor value greater than or equal to 0
+**   3) Call this routine with the file name used in #1
+**   4) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
+**   5) Call OS_write() to cause a file modification to occur
+**   6) Expect the returned value to be
+**        (a) number of bytes written to be equal to the length of write buffer
+**   7) Call OS_close() to flush and close the file written to in #5
+**   8) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
+**   9) Call this routine again with the file name used in #1
+**  10) Expect the returned value to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) fstats1 returned in #3 and fstats2 returned in #9 to be not equal
+**--------------------------------------------------------------------------------*/
+void UT_os_statfile_test()
+{
+    int32 idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    os_fstat_t fstats1, fstats2;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_stat(NULL, NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_statfile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_stat(NULL, &fstats1) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_stat(g_fNames[0], NULL) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-path-arg";
+
+    if (OS_stat(g_invalidPath, &fstats1) == OS_FS_ERR_PATH_INVALID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Path-too-long-arg";
+
+    if (OS_stat(g_longPathName, &fstats1) == OS_FS_ERR_PATH_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Stat_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#5 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_statfile_test_exit_tag;
+    }
+
+    if (OS_stat(g_fNames[0], &fstats1) != OS_FS_SUCCESS)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        goto UT_os_statfile_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "HOW NOW, BROWN COW?");
+    if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
+    {
+        testDesc = "#5 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_statfile_test_exit_tag;
+    }
+
+    if (OS_close(g_fDescs[0]) != OS_FS_SUCCESS)
+    {
+        testDesc = "#5 Nominal - File-close failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_statfile_test_exit_tag;
+    }
+
+    if (OS_stat(g_fNames[0], &fstats2) != OS_FS_SUCCESS)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        goto UT_os_statfile_test_exit_tag;
+    }
+
+    if (memcmp(&fstats1, &fstats2, sizeof(fstats1)) != 0)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_remove(g_fNames[0]);
+
+UT_os_statfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_stat", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_remove(const char *path)
+** Purpose: Removes the given file name
+** Parameters: *path - pointer to the path/name of the file to be removed
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERR_PATH_INVALID if the path is invalid
+**          OS_FS_ERR_PATH_TOO_LONG if the path name is too long
+**          OS_FS_ERR_NAME_TOO_LONG if the name is too long
+**          OS_FS_ERROR if the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-path-arg condition
+**   1) Call this routine with a non-existing path as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_INVALID
+** -----------------------------------------------------
+** Test #3: Path-too-long-arg condition
+**   1) Call this routine with a path of length greater than OS_MAX_PATH_LEN as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_TOO_LONG
+** -----------------------------------------------------
+** Test #4: Name-too-long-arg condition
+**   1) Call this routine with just a file name (no absolute path) as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_NAME_TOO_LONG
+** -----------------------------------------------------
+** Test #5: OS-call-failure condition
+**   1) Setup the test to fail the OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #6: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Expect the returned value to be
+**        (a) a file descriptor value greater than or equal to 0
+**   3) Call this routine with path/file name used in #1 as argument
+**   4) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
+**   5) Call OS_stat() to get file status on the deleted file
+**   6) Expect the returned values to be
+**        (a) OS_FS_ERROR
+**--------------------------------------------------------------------------------*/
+void UT_os_removefile_test()
+{
+    int32 idx=0;
+    os_fstat_t fstats;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_remove(NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_removefile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_remove(NULL) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-path-arg";
+
+    if (OS_remove(g_invalidPath) == OS_FS_ERR_PATH_INVALID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Path-too-long-arg";
+
+    if (OS_remove(g_longPathName) == OS_FS_ERR_PATH_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Name-too-long-arg";
+
+    if (OS_remove(g_longFileName) == OS_FS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Remove_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#6 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_removefile_test_exit_tag;
+    }
+
+    UT_os_print_fdtable("FD TABLE _AFTER_ FILE CREATION FOR OS_remove()");
+
+    /* TODO: Check to see if OS_remove() can delete an opened file.
+     *       If so, OS_FDTable should get clean up afterward. */
+    OS_close(g_fDescs[0]);
+
+    if (OS_remove(g_fNames[0]) != OS_FS_SUCCESS)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        goto UT_os_removefile_test_exit_tag;
+    }
+
+    UT_os_print_fdtable("FD TABLE _AFTER_ FILE REMOVAL FOR OS_remove()");
+
+    if (OS_stat(g_fNames[0], &fstats) == OS_FS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_removefile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_remove", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_rename(const char *old, const char *new)
+** Purpose: Renames the given file name to the new file name
+** Parameters: *old - pointer to the path/name of the file to be renamed
+**             *new - pointer to the new path/name of the file
+** Returns: OS_FS_ERR_INVALID_POINTER if any of the pointers passed in is null
+**          OS_FS_ERR_PATH_TOO_LONG if the path name is too long
+**          OS_FS_ERR_NAME_TOO_LONG if the name is too long
+**          OS_FS_ERROR if the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-path-arg condition
+**   1) Call this routine with a non-existing path as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_INVALID
+** -----------------------------------------------------
+** Test #3: Path-too-long-arg condition
+**   1) Call this routine with a path of length greater than OS_MAX_PATH_LEN as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_TOO_LONG
+** -----------------------------------------------------
+** Test #4: Name-too-long-arg condition
+**   1) Call this routine with just a file name (no absolute path) as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_NAME_TOO_LONG
+** -----------------------------------------------------
+** Test #5: OS-call-failure condition
+**   1) Setup the test to fail the OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #6: Nominal condition
+**   1) Call OS_creat() to create and open a file
+**   2) Expect the returned value to be
+**        (a) a file descriptor value greater than or equal to 0
+**   3) Call this routine with path/file name used in #1 as argument for old name
+**   4) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
+**   5) Call OS_stat() to get file status on the old name used in #3
+**   6) Expect the returned values to be
+**        (a) OS_FS_ERROR
+**--------------------------------------------------------------------------------*/
+void UT_os_renamefile_test()
+{
+    int32 idx=0;
+    os_fstat_t fstats;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_rename(NULL, NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_renamefile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
+    UT_os_sprintf(g_fNames[0], "%s/oldName.txt", g_mntName);
+    UT_os_sprintf(g_fNames[1], "%s/newName.txt", g_mntName);
+
+    if ((OS_rename(NULL, g_fNames[1]) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_rename(g_fNames[0], NULL) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-path-arg";
+
+    if (OS_rename(g_invalidPath, g_invalidPath) == OS_FS_ERR_PATH_INVALID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Path-too-long-arg";
 
     if (OS_rename(g_longPathName, g_longPathName) == OS_FS_ERR_PATH_TOO_LONG)
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
@@ -1674,65 +2547,1754 @@ void UT_os_renamefile_test()
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#4 Name-too-long-arg";
+    testDesc = "#4 Name-too-long-arg";
+
+    if (OS_rename(g_longFileName, g_longFileName) == OS_FS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    memset(g_fNames[0], '\0', sizeof(g_fNames[1]));
+    UT_os_sprintf(g_fNames[0], "%s/Rename_Nom_Old.txt", g_mntName);
+    UT_os_sprintf(g_fNames[1], "%s/Rename_Nom_New.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#6 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_renamefile_test_exit_tag;
+    }
+
+    if (OS_rename(g_fNames[0], g_fNames[1]) != OS_FS_SUCCESS)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        goto UT_os_renamefile_test_exit_tag;
+    }
+
+    if (OS_stat(g_fNames[0], &fstats) == OS_FS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[1]);
+
+UT_os_renamefile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_rename", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_cp(const char *src, const char *dest)
+** Purpose: Copies the given file to a new specified file
+** Parameters: *src - pointer to the absolute path of the file to be copied
+**             *dest - pointer to the absolute path of the new file
+** Returns: OS_FS_ERR_INVALID_POINTER if any of the pointers passed in is null
+**          OS_FS_ERR_PATH_INVALID if the path is invalid
+**          OS_FS_ERR_PATH_TOO_LONG if the path name is too long
+**          OS_FS_ERR_NAME_TOO_LONG if the name is too long
+**          OS_FS_ERROR if the OS call failed
+**          OS_FS_SUCCESS if succeeded
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-path-arg condition
+**   1) Call this routine with a non-existing path as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_INVALID
+** -----------------------------------------------------
+** Test #3: Path-too-long-arg condition
+**   1) Call this routine with a path of length greater than OS_MAX_PATH_LEN as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_TOO_LONG
+** -----------------------------------------------------
+** Test #4: Name-too-long-arg condition
+**   1) Call this routine with just a file name (no absolute path) as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_NAME_TOO_LONG
+** -----------------------------------------------------
+** Test #5: OS-call-failure condition
+**   1) Setup the test to fail the OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #6: Nominal condition
+**   1) Call OS_stat() with a non-existing file name as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERROR
+**   3) Call OS_creat() to create and open a file
+**   4) Expect the returned value to be
+**        (a) a file descriptor value greater than or equal to 0
+**   5) Call this routine with file name used in #3 as old file and file name used
+**      in #1 as new file
+**   6) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
+**   7) Call OS_stat() again as in #1
+**   8) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
+** -----------------------------------------------------
+** Test #7: Same-file condition
+**   1) Call OS_creat() to create and open a file, and write 10 bytes to it
+**   2) Call this routine with the file name used in #1 as both old and new file
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR __and__
+**        (b) the file to still hold its 10 bytes
+**--------------------------------------------------------------------------------*/
+void UT_os_copyfile_test()
+{
+    int32 idx=0;
+    os_fstat_t fstats;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_cp(NULL, NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_copyfile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
+    UT_os_sprintf(g_fNames[0], "%s/oldName.txt", g_mntName);
+    UT_os_sprintf(g_fNames[1], "%s/newName.txt", g_mntName);
+
+    if ((OS_cp(NULL, g_fNames[1]) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_cp(g_fNames[0], NULL) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-path-arg";
+
+    if (OS_cp(g_invalidPath, g_invalidPath) == OS_FS_ERR_PATH_INVALID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Path-too-long-arg";
+
+    if (OS_cp(g_longPathName, g_longPathName) == OS_FS_ERR_PATH_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Name-too-long-arg";
+
+    if (OS_cp(g_longFileName, g_longFileName) == OS_FS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
+    UT_os_sprintf(g_fNames[0], "%s/Cp_Nom_Old.txt", g_mntName);
+    UT_os_sprintf(g_fNames[1], "%s/Cp_Nom_New.txt", g_mntName);
+
+    if (OS_stat(g_fNames[1], &fstats) != OS_FS_ERROR)
+    {
+        testDesc = "#6 Nominal - File-stat failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_copyfile_test_exit_tag;
+    }
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#6 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_copyfile_test_exit_tag;
+    }
+
+    if (OS_close(g_fDescs[0]) != OS_FS_SUCCESS)
+    {
+        testDesc = "#6 Nominal - File-close failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_copyfile_test_exit_tag;
+    }
+
+    if (OS_cp(g_fNames[0], g_fNames[1]) != OS_FS_SUCCESS)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        goto UT_os_copyfile_test_exit_tag;
+    }
+
+    if (OS_stat(g_fNames[1], &fstats) == OS_FS_SUCCESS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_remove(g_fNames[0]);
+    OS_remove(g_fNames[1]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#7 Same-file";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Cp_Same.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
+    if ((g_fDescs[0] < 0) ||
+        (OS_write(g_fDescs[0], "0123456789", 10) != 10) ||
+        (OS_close(g_fDescs[0]) != OS_FS_SUCCESS))
+    {
+        testDesc = "#7 Same-file - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_copyfile_test_exit_tag;
+    }
+
+    if ((OS_cp(g_fNames[0], g_fNames[0]) == OS_FS_ERROR) &&
+        (OS_stat(g_fNames[0], &fstats) == OS_FS_SUCCESS) &&
+        (fstats.st_size == 10))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_remove(g_fNames[0]);
+
+UT_os_copyfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_cp", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_cpProgress(const char *src, const char *dest,
+**                             OS_FileProgress_t callback, void *arg)
+** Purpose: Copies the given file to a new specified file, calling the given
+**          callback as the copy progresses
+** Parameters: *src - pointer to the absolute path of the file to be copied
+**             *dest - pointer to the absolute path of the new file
+**             callback - function to report progress to, or null
+**             *arg - argument passed to the callback
+** Returns: OS_FS_ERR_INVALID_POINTER if any of the path pointers passed in is null
+**          OS_FS_ERROR if the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Call OS_creat() to create a file and write some data to it
+**   2) Call this routine with the file name used in #1 as source and a file
+**      name containing a space as destination
+**   3) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
+**   4) Expect the callback to have been called, last with both byte counts equal
+**      to the size of the data written in #1
+**   5) Read the new file back and expect it to hold the data written in #1
+**--------------------------------------------------------------------------------*/
+void UT_os_copyfileprogress_callback(uint64 bytes_done, uint64 bytes_total, void *arg)
+{
+    uint64 *progress = arg;
+
+    progress[0] = bytes_done;
+    progress[1] = bytes_total;
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_copyfileprogress_test()
+{
+    int32 idx=0;
+    uint64 progress[2];
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_cpProgress(NULL, NULL, NULL, NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_copyfileprogress_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
+    UT_os_sprintf(g_fNames[0], "%s/CpProg_Old.txt", g_mntName);
+    UT_os_sprintf(g_fNames[1], "%s/CpProg New.txt", g_mntName);
+
+    if ((OS_cpProgress(NULL, g_fNames[1], NULL, NULL) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_cpProgress(g_fNames[0], NULL, NULL, NULL) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#2 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_copyfileprogress_test_exit_tag;
+    }
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
+    {
+        testDesc = "#2 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+
+        goto UT_os_copyfileprogress_test_exit_tag;
+    }
+
+    OS_close(g_fDescs[0]);
+
+    progress[0] = 0;
+    progress[1] = 0;
+    if (OS_cpProgress(g_fNames[0], g_fNames[1], UT_os_copyfileprogress_callback, progress) != OS_FS_SUCCESS)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        OS_remove(g_fNames[0]);
+        goto UT_os_copyfileprogress_test_exit_tag;
+    }
+
+    g_fDescs[1] = OS_open(g_fNames[1], OS_READ_ONLY, 0644);
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if ((progress[0] == strlen(g_writeBuff)) && (progress[1] == strlen(g_writeBuff)) &&
+        (g_fDescs[1] >= 0) &&
+        (OS_read(g_fDescs[1], g_readBuff, sizeof(g_readBuff)) == strlen(g_writeBuff)) &&
+        (strcmp(g_readBuff, g_writeBuff) == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[1]);
+    OS_remove(g_fNames[0]);
+    OS_remove(g_fNames[1]);
+
+UT_os_copyfileprogress_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_cpProgress", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_mv(const char *src, const char *dest)
+** Purpose: Moves the given file to a new specified file
+** Parameters: *src - pointer to the absolute path of the file to be moved
+**             *dest - pointer to the aboslute path of the new file
+** Returns: OS_FS_ERR_INVALID_POINTER if any of the pointers passed in is null
+**          OS_FS_ERR_INVALID_PATH if path is invalid
+**          OS_FS_ERR_PATH_TOO_LONG if the path name is too long
+**          OS_FS_ERR_NAME_TOO_LONG if the name is too long
+**          OS_FS_ERROR if the OS call failed
+**          OS_FS_SUCCESS if succeeded
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-path-arg condition
+**   1) Call this routine with a non-existing path as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_INVALID
+** -----------------------------------------------------
+** Test #3: Path-too-long-arg condition
+**   1) Call this routine with a path of length greater than OS_MAX_PATH_LEN as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_TOO_LONG
+** -----------------------------------------------------
+** Test #4: Name-too-long-arg condition
+**   1) Call this routine with just a file name (no absolute path) as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_NAME_TOO_LONG
+** -----------------------------------------------------
+** Test #5: OS-call-failure condition
+**   1) Setup the test to fail the OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #6: Nominal condition
+**   1) Call OS_stat() with a non-existing file name as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERROR
+**   3) Call OS_creat() to create and open a file
+**   4) Expect the returned value to be
+**        (a) a file descriptor value greater than or equal to 0
+**   5) Call this routine with file name used in #3 as old file and file name used
+**      in #1 as new file
+**   6) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
+**   7) Call OS_stat() again as in #1
+**   8) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
+**   9) Call OS_stat() on the file name used in #3
+**  10) Expect the returned value to be
+**        (a) not OS_FS_SUCCESS
+** -----------------------------------------------------
+** Test #7: Same-file condition
+**   1) Call OS_creat() to create and open a file, and write 10 bytes to it
+**   2) Call this routine with the file name used in #1 as both old and new file
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR __and__
+**        (b) the file to still exist and hold its 10 bytes
+**--------------------------------------------------------------------------------*/
+void UT_os_movefile_test()
+{
+    int32 idx=0;
+    os_fstat_t fstats;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_mv(NULL, NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_movefile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
+    UT_os_sprintf(g_fNames[0], "%s/oldName.txt", g_mntName);
+    UT_os_sprintf(g_fNames[1], "%s/newName.txt", g_mntName);
+
+    if ((OS_mv(NULL, g_fNames[1]) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_mv(g_fNames[0], NULL) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-path-arg";
+
+    if (OS_mv(g_invalidPath, g_invalidPath) == OS_FS_ERR_PATH_INVALID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Path-too-long-arg";
+
+    if (OS_mv(g_longPathName, g_longPathName) == OS_FS_ERR_PATH_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Name-too-long-arg";
+
+    if (OS_mv(g_longFileName, g_longFileName) == OS_FS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    memset(g_fNames[0], '\0', sizeof(g_fNames[1]));
+    UT_os_sprintf(g_fNames[0], "%s/Mv_Nom_Old.txt", g_mntName);
+    UT_os_sprintf(g_fNames[1], "%s/Mv_Nom_New.txt", g_mntName);
+
+    if (OS_stat(g_fNames[1], &fstats) != OS_FS_ERROR)
+    {
+        testDesc = "#6 Nominal - File-stat failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_movefile_test_exit_tag;
+    }
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#6 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_movefile_test_exit_tag;
+    }
+
+    /* Close file before moving */
+    if (OS_close(g_fDescs[0]) != OS_FS_SUCCESS)
+    {
+        testDesc = "#6 Nominal - File-close failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_movefile_test_exit_tag;
+    }
+
+    if (OS_mv(g_fNames[0], g_fNames[1]) != OS_FS_SUCCESS)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        goto UT_os_movefile_test_exit_tag;
+    }
+
+    if ((OS_stat(g_fNames[1], &fstats) == OS_FS_SUCCESS) &&
+        (OS_stat(g_fNames[0], &fstats) != OS_FS_SUCCESS))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_remove(g_fNames[1]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#7 Same-file";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Mv_Same.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
+    if ((g_fDescs[0] < 0) ||
+        (OS_write(g_fDescs[0], "0123456789", 10) != 10) ||
+        (OS_close(g_fDescs[0]) != OS_FS_SUCCESS))
+    {
+        testDesc = "#7 Same-file - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_movefile_test_exit_tag;
+    }
+
+    if ((OS_mv(g_fNames[0], g_fNames[0]) == OS_FS_ERROR) &&
+        (OS_stat(g_fNames[0], &fstats) == OS_FS_SUCCESS) &&
+        (fstats.st_size == 10))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_remove(g_fNames[0]);
+
+UT_os_movefile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_mv", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_ShellOutputToFile(char *Cmd, int32 OS_fd)
+** Purpose: Passes a command to the OS shell and directs the output from the command
+**          to the given file descriptor
+** Parameters: *Cmd - pointer to the command to pass to the OS
+**             OS_fd - file descriptor to which the command output is written to
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-file-desc-arg condition
+**   1) Call this routine 3 times with a file descriptors of 0, -1, and (OS_MAX_NUM_OPEN_FILES+5)
+**      respectively as argument
+**   2) Expect all three returned values to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #3: OS-call-failure condition
+**   1) Setup the test to fail OS call inside this routine
+**   2) Call this routine
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #4: Nominal condition
+**   1) Call OS_creat() to create and open a file for writing
+**   2) Expect the returned value to be
+**        (a) a file descriptor greater than or equal to 0
+**   3) Call this routine with file descriptor returned in #1 and
+**      command "echo $HOME" as arguments
+**   4) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
+**   5) Call OS_lseek() with file descriptor returned in #1 to rewind to  the
+**      beginning of file to get ready for reading
+**   6) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
+**   7) Call OS_read() with file descriptor returned in #1 to read from beginning of file
+**   8) Expect the returned value to be
+**        (a) number of bytes greater than 0 __and__
+**        (b) the read string is the same as the string returned from getevn("HOME") call
+**--------------------------------------------------------------------------------*/
+void UT_os_outputtofile_test()
+{
+    int32 idx=0;
+    UT_OsApiInfo_t apiInfo;
+	char* cmd=NULL;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (g_skipTestCase == 0)
+    {
+        testDesc = "API not applicable on platform";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, g_skipTestCaseResult)
+        goto UT_os_outputtofile_test_exit_tag;
+    }
+
+    if (OS_ShellOutputToFile(NULL, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_outputtofile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_ShellOutputToFile(NULL, 0) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-file-desc-arg";
+
+    if (OS_ShellOutputToFile("ls", 99999) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 OS-call-failure";
+
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Output_Nominal.txt", g_mntName);
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#4 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_outputtofile_test_exit_tag;
+    }
+
+    cmd = "echo \"UT_os_outputtofile_test\"";
+    if (OS_ShellOutputToFile(cmd, g_fDescs[0]) != OS_FS_SUCCESS)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        goto UT_os_outputtofile_test_exit_tag;
+    }
+
+    if (OS_lseek(g_fDescs[0], 0, OS_SEEK_SET) != OS_FS_SUCCESS)
+    {
+        testDesc = "#4 Nominal - File-lseek failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        goto UT_os_outputtofile_test_exit_tag;
+    }
+
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if (OS_read(g_fDescs[0], g_readBuff, sizeof(g_readBuff)) <= 0)
+    {
+        testDesc = "#4 Nominal - File-read failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_outputtofile_test_exit_tag;
+    }
+
+    if (UT_OS_OUTPUT_TO_FILE_SUCCESS_COND_MACRO)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_outputtofile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_ShellOutputToFile", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_ShellOutputToFileLimited(char *Cmd, int32 OS_fd,
+**                                           uint32 timeout_msecs, uint32 max_bytes)
+** Purpose: Passes a command to the OS shell and directs the output from the command
+**          to the given file descriptor, stopping the command when it runs for too
+**          long or writes too much
+** Parameters: *Cmd - pointer to the command to pass to the OS
+**             OS_fd - file descriptor to which the command output is written to
+**             timeout_msecs - longest time the command may run, 0 for no limit
+**             max_bytes - most output written to the file, 0 for no limit
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_ERROR_TIMEOUT if the command ran for longer than timeout_msecs
+**          OS_ERR_OUTPUT_TRUNCATED if the command wrote more than max_bytes
+**          OS_FS_ERROR if the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Timeout condition
+**   1) Call OS_creat() to create and open a file for writing
+**   2) Call this routine with a command that sleeps for 10 seconds and a timeout
+**      of 100 milliseconds
+**   3) Expect the returned value to be
+**        (a) OS_ERROR_TIMEOUT
+** -----------------------------------------------------
+** Test #3: Output-truncated condition
+**   1) Call this routine with a command that prints 10 characters and a limit
+**      of 4 bytes
+**   2) Expect the returned value to be
+**        (a) OS_ERR_OUTPUT_TRUNCATED __and__
+**        (b) the file to hold the first 4 characters of the output
+** -----------------------------------------------------
+** Test #4: Nominal condition
+**   1) Call this routine with a command that prints a short string and limits
+**      it stays within
+**   2) Expect the returned value to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) the file to hold the string
+** -----------------------------------------------------
+** Test #5: Output-closed-timeout condition
+**   1) Call this routine with a command that closes its output, then sleeps for
+**      10 seconds, and a timeout of 100 milliseconds
+**   2) Expect the returned value to be
+**        (a) OS_ERROR_TIMEOUT
+** -----------------------------------------------------
+** Test #6: Large-timeout condition
+**   1) Call this routine with a command that exits at once and the largest
+**      timeout
+**   2) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
+**--------------------------------------------------------------------------------*/
+void UT_os_outputtofilelimited_test()
+{
+    int32 idx=0;
+    int32 res=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (g_skipTestCase == 0)
+    {
+        testDesc = "API not applicable on platform";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, g_skipTestCaseResult)
+        goto UT_os_outputtofilelimited_test_exit_tag;
+    }
+
+    if (OS_ShellOutputToFileLimited(NULL, 0, 0, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_outputtofilelimited_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_ShellOutputToFileLimited(NULL, 0, 100, 100) == OS_FS_ERR_INVALID_POINTER)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Timeout";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Output_Limited.txt", g_mntName);
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#2 Timeout - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_outputtofilelimited_test_exit_tag;
+    }
+
+    if (OS_ShellOutputToFileLimited("sleep 10", g_fDescs[0], 100, 0) == OS_ERROR_TIMEOUT)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Output-truncated";
+
+    res = OS_ShellOutputToFileLimited("echo 0123456789", g_fDescs[0], 0, 4);
+
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    OS_lseek(g_fDescs[0], 0, OS_SEEK_SET);
+    if ((res == OS_ERR_OUTPUT_TRUNCATED) &&
+        (OS_read(g_fDescs[0], g_readBuff, sizeof(g_readBuff)) == 4) &&
+        (strcmp(g_readBuff, "0123") == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    res = OS_ShellOutputToFileLimited("echo \"limited\"", g_fDescs[0], 5000, 100);
+
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    OS_lseek(g_fDescs[0], 0, OS_SEEK_SET);
+    if ((res == OS_FS_SUCCESS) &&
+        (OS_read(g_fDescs[0], g_readBuff, sizeof(g_readBuff)) > 0) &&
+        (strcmp(g_readBuff, "0123limited\n") == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Output-closed-timeout";
+
+    if (OS_ShellOutputToFileLimited("exec >/dev/null 2>&1; sleep 10", g_fDescs[0], 100, 0) == OS_ERROR_TIMEOUT)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Large-timeout";
+
+    if (OS_ShellOutputToFileLimited("true", g_fDescs[0], 0xFFFFFFFF, 0) == OS_FS_SUCCESS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_outputtofilelimited_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_ShellOutputToFileLimited", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_AsyncQueueCreate(uint32 *queue_id, const char *queue_name, uint32 flags)
+** Purpose: Creates a queue for asynchronous file requests
+** Parameters: *queue_id - pointer that will hold the id of the new queue
+**             *queue_name - name of the new queue
+**             flags - OS_ASYNC_WORKER_POOL to avoid io_uring, or 0
+** Returns: OS_FS_ERR_INVALID_POINTER if a pointer passed in is null
+**          OS_ERR_NAME_TOO_LONG if the name is too long
+**          OS_ERR_NAME_TAKEN if the name is already used by another queue
+**          OS_ERR_NO_FREE_IDS if all queues are in use
+**          OS_FS_ERROR if the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer for each pointer argument
+**   2) Expect the returned values to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Name-too-long-arg condition
+**   1) Call this routine with a name longer than OS_MAX_API_NAME
+**   2) Expect the returned value to be
+**        (a) OS_ERR_NAME_TOO_LONG
+** -----------------------------------------------------
+** Test #3: No-free-IDs condition
+**   1) Call this routine OS_MAX_ASYNC_QUEUES times
+**   2) Call this routine once more
+**   3) Expect the returned value of the last call to be
+**        (a) OS_ERR_NO_FREE_IDS
+** -----------------------------------------------------
+** Test #4: Duplicate-name condition
+**   1) Call this routine with the name of a queue that exists
+**   2) Expect the returned value to be
+**        (a) OS_ERR_NAME_TAKEN
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) Call this routine once without flags and once with OS_ASYNC_WORKER_POOL
+**   2) Expect both returned values to be
+**        (a) OS_FS_SUCCESS
+**--------------------------------------------------------------------------------*/
+void UT_os_asyncqueuecreate_test()
+{
+    int32 idx=0;
+    int32 res=0;
+    uint32 i;
+    uint32 queueIds[OS_MAX_ASYNC_QUEUES + 1];
+    char queueName[OS_MAX_API_NAME];
+    char longName[OS_MAX_API_NAME+5];
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_AsyncQueueCreate(NULL, NULL, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_asyncqueuecreate_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_AsyncQueueCreate(NULL, "AsyncQueue", 0) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_AsyncQueueCreate(&queueIds[0], NULL, 0) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Name-too-long-arg";
+
+    memset(longName, 'X', sizeof(longName));
+    longName[sizeof(longName) - 1] = '\0';
+    if (OS_AsyncQueueCreate(&queueIds[0], longName, 0) == OS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 No-free-IDs";
+
+    for (i = 0; i < OS_MAX_ASYNC_QUEUES; i++)
+    {
+        memset(queueName, '\0', sizeof(queueName));
+        UT_os_sprintf(queueName, "AsyncQueue%d", (int)i);
+        if (OS_AsyncQueueCreate(&queueIds[i], queueName, OS_ASYNC_WORKER_POOL) != OS_FS_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    if (i < OS_MAX_ASYNC_QUEUES)
+    {
+        testDesc = "#3 No-free-IDs - Queue-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else if (OS_AsyncQueueCreate(&queueIds[i], "AsyncQueueX", 0) == OS_ERR_NO_FREE_IDS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment, except for the first queue */
+    while (i > 1)
+    {
+        OS_AsyncQueueDelete(queueIds[--i]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Duplicate-name";
+
+    if (OS_AsyncQueueCreate(&queueIds[1], "AsyncQueue0", 0) == OS_ERR_NAME_TAKEN)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_AsyncQueueDelete(queueIds[0]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    res = OS_AsyncQueueCreate(&queueIds[0], "AsyncQueue", 0);
+    if ((res == OS_FS_SUCCESS) &&
+        (OS_AsyncQueueCreate(&queueIds[1], "AsyncPool", OS_ASYNC_WORKER_POOL) == OS_FS_SUCCESS))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_AsyncQueueDelete(queueIds[0]);
+    OS_AsyncQueueDelete(queueIds[1]);
+
+UT_os_asyncqueuecreate_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_AsyncQueueCreate", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_AsyncQueueDelete(uint32 queue_id)
+** Purpose: Waits for the outstanding requests of a queue and deletes it
+** Parameters: queue_id - id of the queue to delete
+** Returns: OS_ERR_INVALID_ID if the id passed in is not a valid queue
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-ID-arg condition
+**   1) Call this routine with an invalid queue id as argument
+**   2) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #2: Nominal condition
+**   1) Call OS_AsyncQueueCreate() to create a queue
+**   2) Call this routine with the queue id returned in #1
+**   3) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
+**   4) Call this routine with the same id again
+**   5) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+**--------------------------------------------------------------------------------*/
+void UT_os_asyncqueuedelete_test()
+{
+    int32 idx=0;
+    uint32 queueId;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_AsyncQueueDelete(99999) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_asyncqueuedelete_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    if (OS_AsyncQueueDelete(99999) == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Nominal";
+
+    if (OS_AsyncQueueCreate(&queueId, "AsyncDelete", 0) != OS_FS_SUCCESS)
+    {
+        testDesc = "#2 Nominal - Queue-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_asyncqueuedelete_test_exit_tag;
+    }
+
+    if ((OS_AsyncQueueDelete(queueId) == OS_FS_SUCCESS) &&
+        (OS_AsyncQueueDelete(queueId) == OS_ERR_INVALID_ID))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_asyncqueuedelete_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_AsyncQueueDelete", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_AsyncRead(uint32 queue_id, int32 filedes, void *buffer,
+**                            uint32 nbytes, int64 offset, void *user_data)
+**         int32 OS_AsyncWrite(uint32 queue_id, int32 filedes, void *buffer,
+**                             uint32 nbytes, int64 offset, void *user_data)
+**         int32 OS_AsyncFsync(uint32 queue_id, int32 filedes, void *user_data)
+**         int32 OS_AsyncWait(uint32 queue_id, OS_async_completion_t *completion,
+**                            int32 msecs)
+** Purpose: Submits asynchronous file requests and collects their results
+** Returns: OS_ERR_INVALID_ID if the queue id passed in is invalid
+**          OS_FS_ERR_INVALID_POINTER if a pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_QUEUE_FULL if too many requests are outstanding
+**          OS_ERROR_TIMEOUT if no request finished in time (OS_AsyncWait)
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call OS_AsyncWait
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Invalid-ID-arg condition
+**   1) Call each routine with an invalid queue id as argument
+**   2) Expect the returned values to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #2: Null-pointer-arg condition
+**   1) Call OS_AsyncRead, OS_AsyncWrite and OS_AsyncWait with a null pointer
+**   2) Expect the returned values to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #3: Invalid-file-desc-arg condition
+**   1) Call OS_AsyncRead, OS_AsyncWrite and OS_AsyncFsync with an invalid
+**      file descriptor
+**   2) Expect the returned values to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #4: Nothing-to-wait-for condition
+**   1) Call OS_AsyncWait with OS_CHECK and with a 10 msec timeout on an idle queue
+**   2) Expect the returned values to be
+**        (a) OS_ERROR_TIMEOUT
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) For a queue created without flags and one with OS_ASYNC_WORKER_POOL:
+**   2) Write two halves of a string with OS_AsyncWrite, then OS_AsyncFsync,
+**      waiting for each completion with OS_AsyncWait
+**   3) Read the string back with OS_AsyncRead
+**   4) Expect every completion to carry its user_data and byte count, and the
+**      string read back to match
+**--------------------------------------------------------------------------------*/
+int32 UT_os_asyncio_roundtrip(uint32 queueId, int32 fd)
+{
+    OS_async_completion_t completion;
+    uint32 seen = 0;
+    uint32 i;
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "NOW IS THE WINTER OF OUR DISCONTENT");
+
+    if ((OS_AsyncWrite(queueId, fd, g_writeBuff, 10, 0, &g_writeBuff[0]) != OS_FS_SUCCESS) ||
+        (OS_AsyncWrite(queueId, fd, &g_writeBuff[10], strlen(g_writeBuff) - 10, 10,
+                       &g_writeBuff[10]) != OS_FS_SUCCESS))
+    {
+        return OS_FS_ERROR;
+    }
+
+    /* The two writes may complete in either order */
+    for (i = 0; i < 2; i++)
+    {
+        if (OS_AsyncWait(queueId, &completion, 5000) != OS_FS_SUCCESS)
+        {
+            return OS_FS_ERROR;
+        }
+        if (completion.user_data == &g_writeBuff[0] && completion.result == 10)
+        {
+            seen |= 1;
+        }
+        if (completion.user_data == &g_writeBuff[10] && completion.result == strlen(g_writeBuff) - 10)
+        {
+            seen |= 2;
+        }
+    }
+
+    if ((seen != 3) ||
+        (OS_AsyncFsync(queueId, fd, &seen) != OS_FS_SUCCESS) ||
+        (OS_AsyncWait(queueId, &completion, OS_PEND) != OS_FS_SUCCESS) ||
+        (completion.user_data != &seen) || (completion.result != 0))
+    {
+        return OS_FS_ERROR;
+    }
+
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if ((OS_AsyncRead(queueId, fd, g_readBuff, sizeof(g_readBuff) - 1, 0, g_readBuff) != OS_FS_SUCCESS) ||
+        (OS_AsyncWait(queueId, &completion, 5000) != OS_FS_SUCCESS) ||
+        (completion.user_data != g_readBuff) || (completion.result != strlen(g_writeBuff)) ||
+        (strcmp(g_readBuff, g_writeBuff) != 0))
+    {
+        return OS_FS_ERROR;
+    }
+
+    return OS_FS_SUCCESS;
+}
+
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_asyncio_test()
+{
+    int32 idx=0;
+    uint32 queueIds[2];
+    OS_async_completion_t completion;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_AsyncWait(99999, &completion, OS_CHECK) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_asyncio_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    if ((OS_AsyncRead(99999, 0, g_readBuff, 1, 0, NULL) == OS_ERR_INVALID_ID) &&
+        (OS_AsyncWrite(99999, 0, g_writeBuff, 1, 0, NULL) == OS_ERR_INVALID_ID) &&
+        (OS_AsyncFsync(99999, 0, NULL) == OS_ERR_INVALID_ID) &&
+        (OS_AsyncWait(99999, &completion, OS_CHECK) == OS_ERR_INVALID_ID))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    if (OS_AsyncQueueCreate(&queueIds[0], "AsyncRing", 0) != OS_FS_SUCCESS)
+    {
+        testDesc = "#2 Null-pointer-arg - Queue-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_asyncio_test_exit_tag;
+    }
+
+    if (OS_AsyncQueueCreate(&queueIds[1], "AsyncWorkers", OS_ASYNC_WORKER_POOL) != OS_FS_SUCCESS)
+    {
+        testDesc = "#2 Null-pointer-arg - Queue-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_AsyncQueueDelete(queueIds[0]);
+        goto UT_os_asyncio_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Null-pointer-arg";
+
+    if ((OS_AsyncRead(queueIds[0], 0, NULL, 1, 0, NULL) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_AsyncWrite(queueIds[0], 0, NULL, 1, 0, NULL) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_AsyncWait(queueIds[0], NULL, OS_CHECK) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-file-desc-arg";
+
+    if ((OS_AsyncRead(queueIds[0], 99999, g_readBuff, 1, 0, NULL) == OS_FS_ERR_INVALID_FD) &&
+        (OS_AsyncWrite(queueIds[0], 99999, g_writeBuff, 1, 0, NULL) == OS_FS_ERR_INVALID_FD) &&
+        (OS_AsyncFsync(queueIds[0], 99999, NULL) == OS_FS_ERR_INVALID_FD))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nothing-to-wait-for";
+
+    if ((OS_AsyncWait(queueIds[0], &completion, OS_CHECK) == OS_ERROR_TIMEOUT) &&
+        (OS_AsyncWait(queueIds[1], &completion, OS_CHECK) == OS_ERROR_TIMEOUT) &&
+        (OS_AsyncWait(queueIds[0], &completion, 10) == OS_ERROR_TIMEOUT) &&
+        (OS_AsyncWait(queueIds[1], &completion, 10) == OS_ERROR_TIMEOUT))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Async_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#5 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if ((UT_os_asyncio_roundtrip(queueIds[0], g_fDescs[0]) == OS_FS_SUCCESS) &&
+            (UT_os_asyncio_roundtrip(queueIds[1], g_fDescs[0]) == OS_FS_SUCCESS))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+    }
+
+    /* Reset test environment */
+    OS_AsyncQueueDelete(queueIds[0]);
+    OS_AsyncQueueDelete(queueIds[1]);
+
+UT_os_asyncio_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_AsyncRead/Write/Fsync/Wait", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_mmap(int32 filedes, int64 offset, uint32 length, int32 access, void **addr)
+**         int32 OS_munmap(void *addr, uint32 length)
+** Purpose: Maps part of an open file into memory, and unmaps it again
+** Parameters: filedes - a file descriptor
+**             offset - position in the file the mapping starts at
+**             length - number of bytes to map
+**             access - OS_READ_ONLY or OS_READ_WRITE
+**             **addr - pointer that will hold the address of the mapping
+** Returns: OS_FS_ERR_INVALID_POINTER if a pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_FS_ERROR if the length, offset or access mode is invalid, or the
+**          OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call OS_mmap and OS_munmap with a null pointer as argument
+**   2) Expect the returned values to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-file-desc-arg condition
+**   1) Call this routine with an invalid file descriptor as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_FD
+** -----------------------------------------------------
+** Test #3: Invalid-arg condition
+**   1) Call OS_creat() to create a file
+**   2) Call this routine with a zero length, a negative offset and OS_WRITE_ONLY
+**   3) Expect the returned values to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #4: Nominal condition
+**   1) Call OS_creat() to create a file and OS_write() to write a string to it
+**   2) Call this routine to map the middle of the string read-only
+**   3) Expect the mapping to hold that part of the string
+**   4) Call this routine to map the whole string for writing and change a byte
+**   5) Call OS_msync() and OS_pread() to read the file back
+**   6) Expect the file to hold the changed byte
+**   7) Call OS_munmap() for both mappings and expect OS_FS_SUCCESS
+**--------------------------------------------------------------------------------*/
+void UT_os_mmap_test()
+{
+    int32 idx=0;
+    int32 res=0;
+    void *roAddr=NULL;
+    void *rwAddr=NULL;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_mmap(99999, 0, 0, OS_READ_ONLY, NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_mmap_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_mmap(0, 0, 1, OS_READ_ONLY, NULL) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_munmap(NULL, 1) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-file-desc-arg";
+
+    if (OS_mmap(99999, 0, 1, OS_READ_ONLY, &roAddr) == OS_FS_ERR_INVALID_FD)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Invalid-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/Mmap_Nominal.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#3 Invalid-arg - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_mmap_test_exit_tag;
+    }
+
+    if ((OS_mmap(g_fDescs[0], 0, 0, OS_READ_ONLY, &roAddr) == OS_FS_ERROR) &&
+        (OS_mmap(g_fDescs[0], -1, 1, OS_READ_ONLY, &roAddr) == OS_FS_ERROR) &&
+        (OS_mmap(g_fDescs[0], 0, 1, OS_WRITE_ONLY, &roAddr) == OS_FS_ERROR))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "0123456789ABCDEF");
+    if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
+    {
+        testDesc = "#4 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_mmap_test_reset_tag;
+    }
+
+    if ((OS_mmap(g_fDescs[0], 10, 4, OS_READ_ONLY, &roAddr) != OS_FS_SUCCESS) ||
+        (OS_mmap(g_fDescs[0], 0, strlen(g_writeBuff), OS_READ_WRITE, &rwAddr) != OS_FS_SUCCESS))
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        goto UT_os_mmap_test_reset_tag;
+    }
+
+    ((char *)rwAddr)[2] = 'X';
+
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    res = OS_msync(rwAddr, strlen(g_writeBuff));
+    if ((memcmp(roAddr, "ABCD", 4) == 0) &&
+        (res == OS_FS_SUCCESS) &&
+        (OS_pread(g_fDescs[0], g_readBuff, sizeof(g_readBuff), 0) == strlen(g_writeBuff)) &&
+        (strcmp(g_readBuff, "01X3456789ABCDEF") == 0) &&
+        (OS_munmap(roAddr, 4) == OS_FS_SUCCESS) &&
+        (OS_munmap(rwAddr, strlen(g_writeBuff)) == OS_FS_SUCCESS))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+UT_os_mmap_test_reset_tag:
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_mmap_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_mmap", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_mmapFile(const char *path, int32 access, void **addr, uint32 *length)
+** Purpose: Maps a whole file, given by its path, into memory
+** Parameters: *path - pointer to the path name of the file
+**             access - OS_READ_ONLY or OS_READ_WRITE
+**             **addr - pointer that will hold the address of the mapping
+**             *length - pointer that will hold the length of the mapping
+** Returns: OS_FS_ERR_INVALID_POINTER if a pointer passed in is null
+**          OS_FS_ERR_PATH_TOO_LONG if the path is too long
+**          OS_FS_ERR_PATH_INVALID if the path is invalid
+**          OS_FS_ERROR if the file is empty, missing or the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call this routine with a null pointer for each pointer argument
+**   2) Expect the returned values to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-path-arg condition
+**   1) Call this routine with a non-existing path as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_INVALID
+** -----------------------------------------------------
+** Test #3: Path-too-long-arg condition
+**   1) Call this routine with a path length greater than Os_MAX_PATH_LEN as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_PATH_TOO_LONG
+** -----------------------------------------------------
+** Test #4: Empty-file condition
+**   1) Call OS_creat() to create an empty file
+**   2) Call this routine with the file name as argument
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #5: Nominal condition
+**   1) Call OS_write() to write a string to the file created in #4
+**   2) Call this routine with the file name as argument
+**   3) Expect the returned value to be
+**        (a) OS_FS_SUCCESS __and__
+**        (b) the length to be that of the string __and__
+**        (c) the mapping to hold the string
+**   4) Call OS_munmap() and expect OS_FS_SUCCESS
+**--------------------------------------------------------------------------------*/
+void UT_os_mmapfile_test()
+{
+    int32 idx=0;
+    void *addr=NULL;
+    uint32 length=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    if (OS_mmapFile(NULL, OS_READ_ONLY, NULL, NULL) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_mmapfile_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/MmapFile_Nominal.txt", g_mntName);
+
+    if ((OS_mmapFile(NULL, OS_READ_ONLY, &addr, &length) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_mmapFile(g_fNames[0], OS_READ_ONLY, NULL, &length) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_mmapFile(g_fNames[0], OS_READ_ONLY, &addr, NULL) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-path-arg";
+
+    if (OS_mmapFile(g_invalidPath, OS_READ_ONLY, &addr, &length) == OS_FS_ERR_PATH_INVALID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Path-too-long-arg";
+
+    if (OS_mmapFile(g_longPathName, OS_READ_ONLY, &addr, &length) == OS_FS_ERR_PATH_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Empty-file";
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#4 Empty-file - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_mmapfile_test_exit_tag;
+    }
+
+    if (OS_mmapFile(g_fNames[0], OS_READ_ONLY, &addr, &length) == OS_FS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "A HORSE! A HORSE! MY KINGDOM FOR A HORSE!");
+    if (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff))
+    {
+        testDesc = "#5 Nominal - File-write failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else if ((OS_mmapFile(g_fNames[0], OS_READ_ONLY, &addr, &length) == OS_FS_SUCCESS) &&
+             (length == strlen(g_writeBuff)) &&
+             (memcmp(addr, g_writeBuff, length) == 0) &&
+             (OS_munmap(addr, length) == OS_FS_SUCCESS))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_close(g_fDescs[0]);
+    OS_remove(g_fNames[0]);
+
+UT_os_mmapfile_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_mmapFile", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_msync(void *addr, uint32 length)
+**         int32 OS_madvise(void *addr, uint32 length, uint32 advice)
+** Purpose: Flushes a shared mapping to its file, and gives access pattern hints
+** Parameters: *addr - address returned by OS_mmap or OS_mmapFile
+**             length - number of bytes from addr
+**             advice - one of the OS_MADV_ values
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERROR if the advice is unknown or the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call OS_msync
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call both routines with a null pointer as argument
+**   2) Expect the returned values to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-advice-arg condition
+**   1) Call OS_mmapFile() to map a file
+**   2) Call OS_madvise with an unknown advice
+**   3) Expect the returned value to be
+**        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call OS_madvise with each OS_MADV_ value and OS_msync on the mapping
+**   2) Expect the returned values to be
+**        (a) OS_FS_SUCCESS
+**--------------------------------------------------------------------------------*/
+void UT_os_msync_madvise_test()
+{
+    int32 idx=0;
+    void *addr=NULL;
+    uint32 length=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
 
-    if (OS_rename(g_longFileName, g_longFileName) == OS_FS_ERR_NAME_TOO_LONG)
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
-    else
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    if (OS_msync(NULL, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_msync_madvise_test_exit_tag;
+    }
 
     /*-----------------------------------------------------*/
-    testDesc = "#5 OS-call-failure";
+    testDesc = "#1 Null-pointer-arg";
 
-    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+    if ((OS_msync(NULL, 1) == OS_FS_ERR_INVALID_POINTER) &&
+        (OS_madvise(NULL, 1, OS_MADV_NORMAL) == OS_FS_ERR_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#6 Nominal";
+    testDesc = "#2 Invalid-advice-arg";
 
     memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
-    memset(g_fNames[0], '\0', sizeof(g_fNames[1]));
-    UT_os_sprintf(g_fNames[0], "%s/Rename_Nom_Old.txt", g_mntName);
-    UT_os_sprintf(g_fNames[1], "%s/Rename_Nom_New.txt", g_mntName);
+    UT_os_sprintf(g_fNames[0], "%s/Msync_Nominal.txt", g_mntName);
 
-    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
-    if (g_fDescs[0] < 0)
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "THE LADY DOTH PROTEST TOO MUCH");
+    if ((g_fDescs[0] < 0) ||
+        (OS_write(g_fDescs[0], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff)) ||
+        (OS_mmapFile(g_fNames[0], OS_READ_WRITE, &addr, &length) != OS_FS_SUCCESS))
     {
-        testDesc = "#6 Nominal - File-create failed";
+        testDesc = "#2 Invalid-advice-arg - File-map failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_renamefile_test_exit_tag;
+        if (g_fDescs[0] >= 0)
+        {
+            OS_close(g_fDescs[0]);
+            OS_remove(g_fNames[0]);
+        }
+        goto UT_os_msync_madvise_test_exit_tag;
     }
 
-    if (OS_rename(g_fNames[0], g_fNames[1]) != OS_FS_SUCCESS)
-    {
+    if (OS_madvise(addr, length, 99999) == OS_FS_ERROR)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-        goto UT_os_renamefile_test_exit_tag;
-    }
 
-    if (OS_stat(g_fNames[0], &fstats) == OS_FS_ERROR)
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    if ((OS_madvise(addr, length, OS_MADV_SEQUENTIAL) == OS_FS_SUCCESS) &&
+        (OS_madvise(addr, length, OS_MADV_RANDOM) == OS_FS_SUCCESS) &&
+        (OS_madvise(addr, length, OS_MADV_WILLNEED) == OS_FS_SUCCESS) &&
+        (OS_madvise(addr, length, OS_MADV_NORMAL) == OS_FS_SUCCESS) &&
+        (OS_msync(addr, length) == OS_FS_SUCCESS) &&
+        (OS_madvise(addr, length, OS_MADV_DONTNEED) == OS_FS_SUCCESS))
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /* Reset test environment */
+    OS_munmap(addr, length);
     OS_close(g_fDescs[0]);
-    OS_remove(g_fNames[1]);
+    OS_remove(g_fNames[0]);
 
-UT_os_renamefile_test_exit_tag:
-    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_rename", idx)
+UT_os_msync_madvise_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_msync/OS_madvise", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
 /*--------------------------------------------------------------------------------*
-** Syntax: int32 OS_cp(const char *src, const char *dest)
-** Purpose: Copies the given file to a new specified file
-** Parameters: *src - pointer to the absolute path of the file to be copied
-**             *dest - pointer to the absolute path of the new file
-** Returns: OS_FS_ERR_INVALID_POINTER if any of the pointers passed in is null
-**          OS_FS_ERR_PATH_INVALID if the path is invalid
-**          OS_FS_ERR_PATH_TOO_LONG if the path name is too long
-**          OS_FS_ERR_NAME_TOO_LONG if the name is too long
+** Syntax: int32 OS_StreamOpen(uint32 *stream_id, int32 filedes, uint32 buffer_size,
+**                             uint32 flush_msecs, uint32 flags)
+** Purpose: Puts a buffer in front of an open file
+** Parameters: *stream_id - pointer that will hold the id of the new stream
+**             filedes - a file descriptor
+**             buffer_size - size of the buffer, or 0 for the default size
+**             flush_msecs - time after which buffered data is flushed, or 0
+**             flags - OS_STREAM_SYNC, or 0
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
+**          OS_ERR_NO_FREE_IDS if all streams are in use
 **          OS_FS_ERROR if the OS call failed
 **          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
 ** -----------------------------------------------------
 ** Test #0: Not-implemented condition
 **   1) Call this routine
@@ -1744,46 +4306,22 @@ UT_os_renamefile_test_exit_tag:
 **   2) Expect the returned value to be
 **        (a) OS_FS_ERR_INVALID_POINTER
 ** -----------------------------------------------------
-** Test #2: Invalid-path-arg condition
-**   1) Call this routine with a non-existing path as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERR_PATH_INVALID
-** -----------------------------------------------------
-** Test #3: Path-too-long-arg condition
-**   1) Call this routine with a path of length greater than OS_MAX_PATH_LEN as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERR_PATH_TOO_LONG
-** -----------------------------------------------------
-** Test #4: Name-too-long-arg condition
-**   1) Call this routine with just a file name (no absolute path) as argument
+** Test #2: Invalid-file-desc-arg condition
+**   1) Call this routine with an invalid file descriptor as argument
 **   2) Expect the returned value to be
-**        (a) OS_FS_ERR_NAME_TOO_LONG
+**        (a) OS_FS_ERR_INVALID_FD
 ** -----------------------------------------------------
-** Test #5: OS-call-failure condition
-**   1) Setup the test to fail the OS call inside this routine
-**   2) Call this routine
+** Test #3: Nominal condition
+**   1) Call OS_creat() to create a file
+**   2) Call this routine with the file descriptor returned in #1
 **   3) Expect the returned value to be
-**        (a) OS_FS_ERROR
-** -----------------------------------------------------
-** Test #6: Nominal condition
-**   1) Call OS_stat() with a non-existing file name as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERROR
-**   3) Call OS_creat() to create and open a file
-**   4) Expect the returned value to be
-**        (a) a file descriptor value greater than or equal to 0
-**   5) Call this routine with file name used in #3 as old file and file name used
-**      in #1 as new file
-**   6) Expect the returned value to be
-**        (a) OS_FS_SUCCESS
-**   7) Call OS_stat() again as in #1
-**   8) Expect the returned value to be
 **        (a) OS_FS_SUCCESS
+**   4) Call OS_StreamClose() with the stream id returned in #2
 **--------------------------------------------------------------------------------*/
-void UT_os_copyfile_test()
+void UT_os_streamopen_test()
 {
     int32 idx=0;
-    os_fstat_t fstats;
+    uint32 streamId;
     UT_OsApiInfo_t apiInfo;
     const char* testDesc=NULL;
 
@@ -1792,170 +4330,298 @@ void UT_os_copyfile_test()
     /*-----------------------------------------------------*/
     testDesc = "API not implemented";
 
-    if (OS_cp(NULL, NULL) == OS_FS_UNIMPLEMENTED)
+    if (OS_StreamOpen(NULL, 99999, 0, 0, 0) == OS_FS_UNIMPLEMENTED)
     {
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
-        goto UT_os_copyfile_test_exit_tag;
+        goto UT_os_streamopen_test_exit_tag;
     }
 
     /*-----------------------------------------------------*/
     testDesc = "#1 Null-pointer-arg";
 
-    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
-    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
-    UT_os_sprintf(g_fNames[0], "%s/oldName.txt", g_mntName);
-    UT_os_sprintf(g_fNames[1], "%s/newName.txt", g_mntName);
-
-    if ((OS_cp(NULL, g_fNames[1]) == OS_FS_ERR_INVALID_POINTER) &&
-        (OS_cp(g_fNames[0], NULL) == OS_FS_ERR_INVALID_POINTER))
+    if (OS_StreamOpen(NULL, 0, 0, 0, 0) == OS_FS_ERR_INVALID_POINTER)
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#2 Invalid-path-arg";
+    testDesc = "#2 Invalid-file-desc-arg";
 
-    if (OS_cp(g_invalidPath, g_invalidPath) == OS_FS_ERR_PATH_INVALID)
+    if (OS_StreamOpen(&streamId, 99999, 0, 0, 0) == OS_FS_ERR_INVALID_FD)
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#3 Path-too-long-arg";
+    testDesc = "#3 Nominal";
 
-    if (OS_cp(g_longPathName, g_longPathName) == OS_FS_ERR_PATH_TOO_LONG)
+    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
+    UT_os_sprintf(g_fNames[0], "%s/StrmOpen_Nom.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#3 Nominal - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_streamopen_test_exit_tag;
+    }
+
+    if (OS_StreamOpen(&streamId, g_fDescs[0], 0, 100, OS_STREAM_SYNC) == OS_FS_SUCCESS)
+    {
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        OS_StreamClose(streamId);
+    }
     else
+    {
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+        OS_close(g_fDescs[0]);
+    }
+
+    /* Reset test environment */
+    OS_remove(g_fNames[0]);
+
+UT_os_streamopen_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_StreamOpen", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_StreamWrite(uint32 stream_id, const void *buffer, uint32 nbytes)
+**         int32 OS_StreamFlush(uint32 stream_id)
+** Purpose: Adds data to a stream, and writes the buffered data to the file
+** Parameters: stream_id - id of an open stream
+**             *buffer - pointer that holds the data to be written
+**             nbytes - the number of bytes to write
+** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in is not an open stream
+**          OS_FS_ERROR if the OS call failed
+**          The number of bytes written (OS_StreamWrite) or OS_FS_SUCCESS
+**          (OS_StreamFlush) if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
+** -----------------------------------------------------
+** Test #0: Not-implemented condition
+**   1) Call OS_StreamWrite
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
+** -----------------------------------------------------
+** Test #1: Null-pointer-arg condition
+**   1) Call OS_StreamWrite with a null pointer as argument
+**   2) Expect the returned value to be
+**        (a) OS_FS_ERR_INVALID_POINTER
+** -----------------------------------------------------
+** Test #2: Invalid-ID-arg condition
+**   1) Call both routines with an invalid stream id as argument
+**   2) Expect the returned values to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call OS_creat() to create a file and OS_StreamOpen() to open a stream on
+**      it with a 16-byte buffer and no flush time
+**   2) Call OS_StreamWrite twice with 6-byte records
+**   3) Expect the file to be empty
+**   4) Call OS_StreamWrite with a third 6-byte record
+**   5) Expect the file to hold the first two records
+**   6) Call OS_StreamFlush and expect the file to hold all three records
+** -----------------------------------------------------
+** Test #4: Flush-time condition
+**   1) Call OS_StreamOpen() on the same file with a 50 msec flush time
+**   2) Call OS_StreamWrite with a record and wait for 500 msecs
+**   3) Expect the record to be in the file without OS_StreamFlush
+** -----------------------------------------------------
+** Test #5: Flush-retry condition
+**   1) Call OS_StreamOpen() on the same file with a 50 msec flush time
+**   2) Limit the file size to its current size so that writes to it fail
+**   3) Call OS_StreamWrite with a record and wait for 200 msecs
+**   4) Expect the file to be unchanged
+**   5) Lift the file size limit and wait for 500 msecs
+**   6) Expect the record to be in the file without OS_StreamFlush
+**--------------------------------------------------------------------------------*/
+void UT_os_streamwrite_test()
+{
+    int32 idx=0;
+    uint32 streamId;
+    int32 stat1=0, stat2=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
 
     /*-----------------------------------------------------*/
-    testDesc = "#4 Name-too-long-arg";
+    testDesc = "API not implemented";
 
-    if (OS_cp(g_longFileName, g_longFileName) == OS_FS_ERR_NAME_TOO_LONG)
+    if (OS_StreamWrite(99999, NULL, 0) == OS_FS_UNIMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_streamwrite_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if (OS_StreamWrite(0, NULL, 1) == OS_FS_ERR_INVALID_POINTER)
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#5 OS-call-failure";
+    testDesc = "#2 Invalid-ID-arg";
 
-    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
+    if ((OS_StreamWrite(99999, g_writeBuff, 1) == OS_ERR_INVALID_ID) &&
+        (OS_StreamFlush(99999) == OS_ERR_INVALID_ID))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#6 Nominal";
+    testDesc = "#3 Nominal";
 
     memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
-    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
-    UT_os_sprintf(g_fNames[0], "%s/Cp_Nom_Old.txt", g_mntName);
-    UT_os_sprintf(g_fNames[1], "%s/Cp_Nom_New.txt", g_mntName);
+    UT_os_sprintf(g_fNames[0], "%s/StrmWrite_Nom.txt", g_mntName);
 
-    if (OS_stat(g_fNames[1], &fstats) != OS_FS_ERROR)
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
     {
-        testDesc = "#6 Nominal - File-stat failed";
+        testDesc = "#3 Nominal - File-create failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_copyfile_test_exit_tag;
+        goto UT_os_streamwrite_test_exit_tag;
     }
 
-    g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
-    if (g_fDescs[0] < 0)
+    if (OS_StreamOpen(&streamId, g_fDescs[0], 16, 0, 0) != OS_FS_SUCCESS)
     {
-        testDesc = "#6 Nominal - File-create failed";
+        testDesc = "#3 Nominal - Stream-open failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_copyfile_test_exit_tag;
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+        goto UT_os_streamwrite_test_exit_tag;
     }
 
-    if (OS_close(g_fDescs[0]) != OS_FS_SUCCESS)
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    if ((OS_StreamWrite(streamId, "REC01;", 6) == 6) &&
+        (OS_StreamWrite(streamId, "REC02;", 6) == 6) &&
+        (OS_pread(g_fDescs[0], g_readBuff, sizeof(g_readBuff), 0) == 0) &&
+        (OS_StreamWrite(streamId, "REC03;", 6) == 6) &&
+        (OS_pread(g_fDescs[0], g_readBuff, sizeof(g_readBuff), 0) == 12) &&
+        (OS_StreamFlush(streamId) == OS_FS_SUCCESS) &&
+        (OS_pread(g_fDescs[0], g_readBuff, sizeof(g_readBuff), 0) == 18) &&
+        (strcmp(g_readBuff, "REC01;REC02;REC03;") == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Flush-time";
+
+    /* the stream owns the file, so take both back */
+    OS_StreamClose(streamId);
+
+    g_fDescs[0] = OS_open(g_fNames[0], OS_READ_WRITE, 0644);
+    if ((g_fDescs[0] < 0) ||
+        (OS_lseek(g_fDescs[0], 0, OS_SEEK_END) != 18) ||
+        (OS_StreamOpen(&streamId, g_fDescs[0], 0, 50, 0) != OS_FS_SUCCESS))
     {
-        testDesc = "#6 Nominal - File-close failed";
+        testDesc = "#4 Flush-time - Stream-open failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_copyfile_test_exit_tag;
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+        goto UT_os_streamwrite_test_exit_tag;
     }
 
-    if (OS_cp(g_fNames[0], g_fNames[1]) != OS_FS_SUCCESS)
-    {
+    memset(g_readBuff, '\0', sizeof(g_readBuff));
+    stat1 = OS_StreamWrite(streamId, "REC04;", 6);
+    OS_TaskDelay(500);
+    stat2 = OS_pread(g_fDescs[0], g_readBuff, sizeof(g_readBuff), 0);
+    if ((stat1 == 6) && (stat2 == 24) &&
+        (strcmp(g_readBuff, "REC01;REC02;REC03;REC04;") == 0))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-        goto UT_os_copyfile_test_exit_tag;
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Flush-retry";
+
+#ifdef UT_OS_LIMIT_FILE_SIZE_MACRO
+    OS_StreamClose(streamId);
+
+    g_fDescs[0] = OS_open(g_fNames[0], OS_READ_WRITE, 0644);
+    if ((g_fDescs[0] < 0) ||
+        (OS_lseek(g_fDescs[0], 0, OS_SEEK_END) != 24) ||
+        (OS_StreamOpen(&streamId, g_fDescs[0], 0, 50, 0) != OS_FS_SUCCESS))
+    {
+        testDesc = "#5 Flush-retry - Stream-open failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+        goto UT_os_streamwrite_test_exit_tag;
     }
 
-    if (OS_stat(g_fNames[1], &fstats) == OS_FS_SUCCESS)
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    UT_OS_LIMIT_FILE_SIZE_MACRO(24)
+    stat1 = OS_StreamWrite(streamId, "REC05;", 6);
+    OS_TaskDelay(200);
+    stat2 = OS_pread(g_fDescs[0], g_readBuff, sizeof(g_readBuff), 0);
+    UT_OS_UNLIMIT_FILE_SIZE_MACRO
+
+    if ((stat1 != 6) || (stat2 != 24))
+    {
+        testDesc = "#5 Flush-retry - Failed-flush setup failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
     else
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    {
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        OS_TaskDelay(500);
+        if ((OS_pread(g_fDescs[0], g_readBuff, sizeof(g_readBuff), 0) == 30) &&
+            (strcmp(g_readBuff, "REC01;REC02;REC03;REC04;REC05;") == 0))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+#else
+    testDesc = "#5 Flush-retry - Test case not applicable on platform";
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+#endif
 
     /* Reset test environment */
+    OS_StreamClose(streamId);
     OS_remove(g_fNames[0]);
-    OS_remove(g_fNames[1]);
 
-UT_os_copyfile_test_exit_tag:
-    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_cp", idx)
+UT_os_streamwrite_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_StreamWrite/OS_StreamFlush", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
 }
-
-/*--------------------------------------------------------------------------------*
-** Syntax: int32 OS_mv(const char *src, const char *dest)
-** Purpose: Moves the given file to a new specified file
-** Parameters: *src - pointer to the absolute path of the file to be moved
-**             *dest - pointer to the aboslute path of the new file
-** Returns: OS_FS_ERR_INVALID_POINTER if any of the pointers passed in is null
-**          OS_FS_ERR_INVALID_PATH if path is invalid
-**          OS_FS_ERR_PATH_TOO_LONG if the path name is too long
-**          OS_FS_ERR_NAME_TOO_LONG if the name is too long
-**          OS_FS_ERROR if the OS call failed
-**          OS_FS_SUCCESS if succeeded
-** -----------------------------------------------------
-** Test #0: Not-implemented condition
-**   1) Call this routine
-**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
-**   3) Otherwise, continue
-** -----------------------------------------------------
-** Test #1: Null-pointer-arg condition
-**   1) Call this routine with a null pointer as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERR_INVALID_POINTER
-** -----------------------------------------------------
-** Test #2: Invalid-path-arg condition
-**   1) Call this routine with a non-existing path as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERR_PATH_INVALID
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_StreamClose(uint32 stream_id)
+** Purpose: Flushes a stream, then closes it and its file
+** Parameters: stream_id - id of an open stream
+** Returns: OS_ERR_INVALID_ID if the id passed in is not an open stream
+**          OS_FS_ERROR if the OS call failed
+**          OS_FS_SUCCESS if succeeded
+**          OS_FS_UNIMPLEMENTED if not implemented
 ** -----------------------------------------------------
-** Test #3: Path-too-long-arg condition
-**   1) Call this routine with a path of length greater than OS_MAX_PATH_LEN as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERR_PATH_TOO_LONG
+** Test #0: Not-implemented condition
+**   1) Call this routine
+**   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
+**   3) Otherwise, continue
 ** -----------------------------------------------------
-** Test #4: Name-too-long-arg condition
-**   1) Call this routine with just a file name (no absolute path) as argument
+** Test #1: Invalid-ID-arg condition
+**   1) Call this routine with an invalid stream id as argument
 **   2) Expect the returned value to be
-**        (a) OS_FS_ERR_NAME_TOO_LONG
+**        (a) OS_ERR_INVALID_ID
 ** -----------------------------------------------------
-** Test #5: OS-call-failure condition
-**   1) Setup the test to fail the OS call inside this routine
-**   2) Call this routine
-**   3) Expect the returned value to be
-**        (a) OS_FS_ERROR
-** -----------------------------------------------------
-** Test #6: Nominal condition
-**   1) Call OS_stat() with a non-existing file name as argument
-**   2) Expect the returned value to be
-**        (a) OS_FS_ERROR
-**   3) Call OS_creat() to create and open a file
+** Test #2: Nominal condition
+**   1) Call OS_creat() to create a file and OS_StreamOpen() to open a stream on it
+**   2) Call OS_StreamWrite() to buffer a string
+**   3) Call this routine with the stream id returned in #1
 **   4) Expect the returned value to be
-**        (a) a file descriptor value greater than or equal to 0
-**   5) Call this routine with file name used in #3 as old file and file name used
-**      in #1 as new file
-**   6) Expect the returned value to be
-**        (a) OS_FS_SUCCESS
-**   7) Call OS_stat() again as in #1
-**   8) Expect the returned value to be
-**        (a) OS_FS_SUCCESS
-**   9) Call OS_stat() on the file name used in #3
-**  10) Expect the returned value to be
-**        (a) not OS_FS_SUCCESS
+**        (a) OS_FS_SUCCESS __and__
+**        (b) the file descriptor to be closed __and__
+**        (c) the file to hold the string
 **--------------------------------------------------------------------------------*/
-void UT_os_movefile_test()
+void UT_os_streamclose_test()
 {
     int32 idx=0;
-    os_fstat_t fstats;
+    uint32 streamId;
+    OS_FDTableEntry fdProps;
     UT_OsApiInfo_t apiInfo;
     const char* testDesc=NULL;
 
@@ -1964,162 +4630,128 @@ void UT_os_movefile_test()
     /*-----------------------------------------------------*/
     testDesc = "API not implemented";
 
-    if (OS_mv(NULL, NULL) == OS_FS_UNIMPLEMENTED)
+    if (OS_StreamClose(99999) == OS_FS_UNIMPLEMENTED)
     {
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
-        goto UT_os_movefile_test_exit_tag;
+        goto UT_os_streamclose_test_exit_tag;
     }
 
     /*-----------------------------------------------------*/
-    testDesc = "#1 Null-pointer-arg";
-
-    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
-    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
-    UT_os_sprintf(g_fNames[0], "%s/oldName.txt", g_mntName);
-    UT_os_sprintf(g_fNames[1], "%s/newName.txt", g_mntName);
-
-    if ((OS_mv(NULL, g_fNames[1]) == OS_FS_ERR_INVALID_POINTER) &&
-        (OS_mv(g_fNames[0], NULL) == OS_FS_ERR_INVALID_POINTER))
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
-    else
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-
-    /*-----------------------------------------------------*/
-    testDesc = "#2 Invalid-path-arg";
-
-    if (OS_mv(g_invalidPath, g_invalidPath) == OS_FS_ERR_PATH_INVALID)
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
-    else
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-
-    /*-----------------------------------------------------*/
-    testDesc = "#3 Path-too-long-arg";
-
-    if (OS_mv(g_longPathName, g_longPathName) == OS_FS_ERR_PATH_TOO_LONG)
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
-    else
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-
-    /*-----------------------------------------------------*/
-    testDesc = "#4 Name-too-long-arg";
+    testDesc = "#1 Invalid-ID-arg";
 
-    if (OS_mv(g_longFileName, g_longFileName) == OS_FS_ERR_NAME_TOO_LONG)
+    if (OS_StreamClose(99999) == OS_ERR_INVALID_ID)
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#5 OS-call-failure";
-
-    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
-
-    /*-----------------------------------------------------*/
-    testDesc = "#6 Nominal";
+    testDesc = "#2 Nominal";
 
     memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
-    memset(g_fNames[0], '\0', sizeof(g_fNames[1]));
-    UT_os_sprintf(g_fNames[0], "%s/Mv_Nom_Old.txt", g_mntName);
-    UT_os_sprintf(g_fNames[1], "%s/Mv_Nom_New.txt", g_mntName);
-
-    if (OS_stat(g_fNames[1], &fstats) != OS_FS_ERROR)
-    {
-        testDesc = "#6 Nominal - File-stat failed";
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_movefile_test_exit_tag;
-    }
+    UT_os_sprintf(g_fNames[0], "%s/StrmClose_Nom.txt", g_mntName);
 
     g_fDescs[0] = OS_creat(g_fNames[0], OS_WRITE_ONLY);
     if (g_fDescs[0] < 0)
     {
-        testDesc = "#6 Nominal - File-create failed";
+        testDesc = "#2 Nominal - File-create failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_movefile_test_exit_tag;
+        goto UT_os_streamclose_test_exit_tag;
     }
 
-    /* Close file before moving */
-    if (OS_close(g_fDescs[0]) != OS_FS_SUCCESS)
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "ALL THE WORLD'S A STAGE");
+    if ((OS_StreamOpen(&streamId, g_fDescs[0], 0, 0, 0) != OS_FS_SUCCESS) ||
+        (OS_StreamWrite(streamId, g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff)))
     {
-        testDesc = "#6 Nominal - File-close failed";
+        testDesc = "#2 Nominal - Stream-write failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_movefile_test_exit_tag;
+        OS_close(g_fDescs[0]);
+        OS_remove(g_fNames[0]);
+        goto UT_os_streamclose_test_exit_tag;
     }
 
-    if (OS_mv(g_fNames[0], g_fNames[1]) != OS_FS_SUCCESS)
+    if ((OS_StreamClose(streamId) == OS_FS_SUCCESS) &&
+        (OS_FDGetInfo(g_fDescs[0], &fdProps) == OS_FS_ERR_INVALID_FD) &&
+        ((g_fDescs[0] = OS_open(g_fNames[0], OS_READ_ONLY, 0644)) >= 0))
     {
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-        goto UT_os_movefile_test_exit_tag;
-    }
+        memset(g_readBuff, '\0', sizeof(g_readBuff));
+        if ((OS_read(g_fDescs[0], g_readBuff, sizeof(g_readBuff)) == strlen(g_writeBuff)) &&
+            (strcmp(g_readBuff, g_writeBuff) == 0))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
-    if ((OS_stat(g_fNames[1], &fstats) == OS_FS_SUCCESS) &&
-        (OS_stat(g_fNames[0], &fstats) != OS_FS_SUCCESS))
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        OS_close(g_fDescs[0]);
+    }
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /* Reset test environment */
-    OS_remove(g_fNames[1]);
+    OS_remove(g_fNames[0]);
 
-UT_os_movefile_test_exit_tag:
-    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_mv", idx)
+UT_os_streamclose_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_StreamClose", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
 /*--------------------------------------------------------------------------------*
-** Syntax: int32 OS_ShellOutputToFile(char *Cmd, int32 OS_fd)
-** Purpose: Passes a command to the OS shell and directs the output from the command
-**          to the given file descriptor
-** Parameters: *Cmd - pointer to the command to pass to the OS
-**             OS_fd - file descriptor to which the command output is written to
+** Syntax: int32 OS_SyncGroupCreate(uint32 *group_id, uint32 flush_msecs,
+**                                  uint32 max_pending, uint32 flags)
+**         int32 OS_SyncGroupAdd(uint32 group_id, int32 filedes)
+**         int32 OS_SyncGroupCommit(uint32 group_id)
+**         int32 OS_SyncGroupDelete(uint32 group_id)
+** Purpose: Syncs several files together
+** Parameters: *group_id - pointer that will hold the id of the new group
+**             flush_msecs - time after which waiting files are synced, or 0
+**             max_pending - number of waiting files that triggers a sync, or 0
+**             flags - OS_SYNC_GROUP_FULL, OS_SYNC_GROUP_SYNCFS, or 0
+**             filedes - a file descriptor
 ** Returns: OS_FS_ERR_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in is not a sync group in use
 **          OS_FS_ERR_INVALID_FD if the file descriptor passed in is invalid
 **          OS_FS_ERROR if the OS call failed
 **          OS_FS_SUCCESS if succeeded
 **          OS_FS_UNIMPLEMENTED if not implemented
 ** -----------------------------------------------------
 ** Test #0: Not-implemented condition
-**   1) Call this routine
+**   1) Call OS_SyncGroupCreate
 **   2) If the returned value is OS_FS_UNIMPLEMENTED, then exit test
 **   3) Otherwise, continue
 ** -----------------------------------------------------
 ** Test #1: Null-pointer-arg condition
-**   1) Call this routine with a null pointer as argument
+**   1) Call OS_SyncGroupCreate with a null pointer as argument
 **   2) Expect the returned value to be
 **        (a) OS_FS_ERR_INVALID_POINTER
 ** -----------------------------------------------------
-** Test #2: Invalid-file-desc-arg condition
-**   1) Call this routine 3 times with a file descriptors of 0, -1, and (OS_MAX_NUM_OPEN_FILES+5)
-**      respectively as argument
-**   2) Expect all three returned values to be
-**        (a) OS_FS_ERR_INVALID_FD
+** Test #2: Invalid-ID-arg condition
+**   1) Call OS_SyncGroupAdd, OS_SyncGroupCommit and OS_SyncGroupDelete with an
+**      invalid group id
+**   2) Expect all returned values to be
+**        (a) OS_ERR_INVALID_ID
 ** -----------------------------------------------------
-** Test #3: OS-call-failure condition
-**   1) Setup the test to fail OS call inside this routine
-**   2) Call this routine
+** Test #3: Invalid-file-desc-arg condition
+**   1) Call OS_SyncGroupCreate to create a group
+**   2) Call OS_SyncGroupAdd with an invalid file descriptor
 **   3) Expect the returned value to be
-**        (a) OS_FS_ERROR
+**        (a) OS_FS_ERR_INVALID_FD
 ** -----------------------------------------------------
 ** Test #4: Nominal condition
-**   1) Call OS_creat() to create and open a file for writing
-**   2) Expect the returned value to be
-**        (a) a file descriptor greater than or equal to 0
-**   3) Call this routine with file descriptor returned in #1 and
-**      command "echo $HOME" as arguments
-**   4) Expect the returned value to be
+**   1) Call OS_SyncGroupCreate to create a group that commits at 2 waiting files
+**   2) Call OS_creat() to create two files and write to them
+**   3) Call OS_SyncGroupAdd with the first file twice, then with the second
+**   4) Call OS_SyncGroupCommit and OS_SyncGroupDelete
+**   5) Expect all returned values to be
 **        (a) OS_FS_SUCCESS
-**   5) Call OS_lseek() with file descriptor returned in #1 to rewind to  the
-**      beginning of file to get ready for reading
-**   6) Expect the returned value to be
+**   6) Call OS_SyncGroupCreate to create a group with OS_SYNC_GROUP_SYNCFS and a
+**      flush time, add both files to it, wait past the flush time, and delete it
+**   7) Expect all returned values to be
 **        (a) OS_FS_SUCCESS
-**   7) Call OS_read() with file descriptor returned in #1 to read from beginning of file
-**   8) Expect the returned value to be
-**        (a) number of bytes greater than 0 __and__
-**        (b) the read string is the same as the string returned from getevn("HOME") call
 **--------------------------------------------------------------------------------*/
-void UT_os_outputtofile_test()
+void UT_os_syncgroup_test()
 {
-    int32 idx=0;
+    int32 idx=0, i=0;
+    uint32 groupId;
     UT_OsApiInfo_t apiInfo;
-	char* cmd=NULL;
     const char* testDesc=NULL;
 
     UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
@@ -2127,86 +4759,103 @@ void UT_os_outputtofile_test()
     /*-----------------------------------------------------*/
     testDesc = "API not implemented";
 
-    if (g_skipTestCase == 0)
-    {
-        testDesc = "API not applicable on platform";
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, g_skipTestCaseResult)
-        goto UT_os_outputtofile_test_exit_tag;
-    }
-
-    if (OS_ShellOutputToFile(NULL, 0) == OS_FS_UNIMPLEMENTED)
+    if (OS_SyncGroupCreate(NULL, 0, 0, 0) == OS_FS_UNIMPLEMENTED)
     {
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
-        goto UT_os_outputtofile_test_exit_tag;
+        goto UT_os_syncgroup_test_exit_tag;
     }
 
     /*-----------------------------------------------------*/
     testDesc = "#1 Null-pointer-arg";
 
-    if (OS_ShellOutputToFile(NULL, 0) == OS_FS_ERR_INVALID_POINTER)
+    if (OS_SyncGroupCreate(NULL, 0, 0, 0) == OS_FS_ERR_INVALID_POINTER)
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#2 Invalid-file-desc-arg";
+    testDesc = "#2 Invalid-ID-arg";
 
-    if (OS_ShellOutputToFile("ls", 99999) == OS_FS_ERR_INVALID_FD)
+    if ((OS_SyncGroupAdd(99999, 0) == OS_ERR_INVALID_ID) &&
+        (OS_SyncGroupCommit(99999) == OS_ERR_INVALID_ID) &&
+        (OS_SyncGroupDelete(99999) == OS_ERR_INVALID_ID))
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /*-----------------------------------------------------*/
-    testDesc = "#3 OS-call-failure";
-
-    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_UOF)
-
-    /*-----------------------------------------------------*/
-    testDesc = "#4 Nominal";
+    testDesc = "#3 Invalid-file-desc-arg";
 
-    memset(g_fNames[0], '\0', sizeof(g_fNames[0]));
-    UT_os_sprintf(g_fNames[0], "%s/Output_Nominal.txt", g_mntName);
-    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
-    if (g_fDescs[0] < 0)
+    if (OS_SyncGroupCreate(&groupId, 0, 0, 0) != OS_FS_SUCCESS)
     {
-        testDesc = "#4 Nominal - File-create failed";
+        testDesc = "#3 Invalid-file-desc-arg - Group-create failed";
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_outputtofile_test_exit_tag;
     }
-
-    cmd = "echo \"UT_os_outputtofile_test\"";
-    if (OS_ShellOutputToFile(cmd, g_fDescs[0]) != OS_FS_SUCCESS)
+    else
     {
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-        goto UT_os_outputtofile_test_exit_tag;
-    }
+        if (OS_SyncGroupAdd(groupId, 99999) == OS_FS_ERR_INVALID_FD)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
-    if (OS_lseek(g_fDescs[0], 0, OS_SEEK_SET) != OS_FS_SUCCESS)
-    {
-        testDesc = "#4 Nominal - File-lseek failed";
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
-        goto UT_os_outputtofile_test_exit_tag;
+        OS_SyncGroupDelete(groupId);
     }
 
-    memset(g_readBuff, '\0', sizeof(g_readBuff));
-    if (OS_read(g_fDescs[0], g_readBuff, sizeof(g_readBuff)) <= 0)
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    memset(g_writeBuff, '\0', sizeof(g_writeBuff));
+    strcpy(g_writeBuff, "BREVITY IS THE SOUL OF WIT");
+
+    for (i = 0; i < 2; i++)
     {
-        testDesc = "#4 Nominal - File-read failed";
-        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
-        goto UT_os_outputtofile_test_exit_tag;
+        memset(g_fNames[i], '\0', sizeof(g_fNames[i]));
+        UT_os_sprintf(g_fNames[i], "%s/SyncGrp_Nom%d.txt", g_mntName, (int)i);
+
+        g_fDescs[i] = OS_creat(g_fNames[i], OS_WRITE_ONLY);
+        if ((g_fDescs[i] < 0) ||
+            (OS_write(g_fDescs[i], g_writeBuff, strlen(g_writeBuff)) != strlen(g_writeBuff)))
+        {
+            testDesc = "#4 Nominal - File-write failed";
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+            for ( ; i >= 0; i--)
+            {
+                if (g_fDescs[i] >= 0)
+                {
+                    OS_close(g_fDescs[i]);
+                    OS_remove(g_fNames[i]);
+                }
+            }
+            goto UT_os_syncgroup_test_exit_tag;
+        }
     }
 
-    if (UT_OS_OUTPUT_TO_FILE_SUCCESS_COND_MACRO)
+    if ((OS_SyncGroupCreate(&groupId, 0, 2, 0) == OS_FS_SUCCESS) &&
+        (OS_SyncGroupAdd(groupId, g_fDescs[0]) == OS_FS_SUCCESS) &&
+        (OS_SyncGroupAdd(groupId, g_fDescs[0]) == OS_FS_SUCCESS) &&
+        (OS_SyncGroupAdd(groupId, g_fDescs[1]) == OS_FS_SUCCESS) &&
+        (OS_SyncGroupCommit(groupId) == OS_FS_SUCCESS) &&
+        (OS_SyncGroupDelete(groupId) == OS_FS_SUCCESS) &&
+        (OS_SyncGroupCommit(groupId) == OS_ERR_INVALID_ID) &&
+        (OS_SyncGroupCreate(&groupId, 10, 0, OS_SYNC_GROUP_SYNCFS) == OS_FS_SUCCESS) &&
+        (OS_SyncGroupAdd(groupId, g_fDescs[0]) == OS_FS_SUCCESS) &&
+        (OS_SyncGroupAdd(groupId, g_fDescs[1]) == OS_FS_SUCCESS) &&
+        (OS_TaskDelay(50) == OS_SUCCESS) &&
+        (OS_SyncGroupDelete(groupId) == OS_FS_SUCCESS))
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
     /* Reset test environment */
-    OS_close(g_fDescs[0]);
-    OS_remove(g_fNames[0]);
+    OS_SyncGroupDelete(groupId);
+    for (i = 0; i < 2; i++)
+    {
+        OS_close(g_fDescs[i]);
+        OS_remove(g_fNames[i]);
+    }
 
-UT_os_outputtofile_test_exit_tag:
-    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_ShellOutputToFile", idx)
+UT_os_syncgroup_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_SyncGroup", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
@@ -2605,10 +5254,30 @@ UT_os_closeallfiles_test_exit_tag:
 **   5) Call OS_FileOpenCheck() with the file name used in #1
 **   6) Expect the returned value to be
 **        (a) OS_FS_ERROR
+** -----------------------------------------------------
+** Test #5: Renamed-file-opened-twice condition
+**   1) Call OS_creat() and OS_open() to open the same file twice
+**   2) Call this routine with the file name used in #1
+**   3) Expect OS_FileOpenCheck() to still find the file open
+**   4) Call OS_rename() to rename the file
+**   5) Expect OS_FileOpenCheck() to find the new name open and the old name
+**      not open, and OS_remove() on the new name to fail
+**   6) Call this routine with the new name
+**   7) Expect OS_FileOpenCheck() to find the new name not open
+** -----------------------------------------------------
+** Test #6: Renamed-to-own-name condition
+**   1) Call OS_creat() to create and open a file
+**   2) Call OS_rename() with the file name as both old and new name
+**   3) Expect OS_rename() to return OS_FS_SUCCESS and OS_FileOpenCheck() to
+**      still find the file open
+**   4) Call this routine with the file name
+**   5) Expect the returned value to be
+**        (a) OS_FS_SUCCESS
 **--------------------------------------------------------------------------------*/
 void UT_os_closefilebyname_test()
 {
     int32 idx=0;
+    int32 res=0;
     UT_OsApiInfo_t apiInfo;
     const char* testDesc=NULL;
 
@@ -2671,6 +5340,65 @@ void UT_os_closefilebyname_test()
     /* Reset test environment */
     OS_remove(g_fNames[0]);
 
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Renamed-file-opened-twice";
+
+    memset(g_fNames[1], '\0', sizeof(g_fNames[1]));
+    UT_os_sprintf(g_fNames[1], "%s/Close_Renamed.txt", g_mntName);
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    g_fDescs[1] = OS_open(g_fNames[0], OS_READ_ONLY, 0644);
+    if ((g_fDescs[0] < 0) || (g_fDescs[1] < 0))
+    {
+        testDesc = "#5 Renamed-file-opened-twice - File-open failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_close(g_fDescs[0]);
+        OS_close(g_fDescs[1]);
+        OS_remove(g_fNames[0]);
+        goto UT_os_closefilebyname_test_exit_tag;
+    }
+
+    res = OS_CloseFileByName(g_fNames[0]);
+    if ((res == OS_FS_SUCCESS) &&
+        (OS_FileOpenCheck(g_fNames[0]) == OS_FS_SUCCESS) &&
+        (OS_rename(g_fNames[0], g_fNames[1]) == OS_FS_SUCCESS) &&
+        (OS_FileOpenCheck(g_fNames[0]) == OS_FS_ERROR) &&
+        (OS_FileOpenCheck(g_fNames[1]) == OS_FS_SUCCESS) &&
+        (OS_remove(g_fNames[1]) == OS_FS_ERROR) &&
+        (OS_CloseFileByName(g_fNames[1]) == OS_FS_SUCCESS) &&
+        (OS_FileOpenCheck(g_fNames[1]) == OS_FS_ERROR))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_CloseFileByName(g_fNames[0]);
+    OS_CloseFileByName(g_fNames[1]);
+    OS_remove(g_fNames[0]);
+    OS_remove(g_fNames[1]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Renamed-to-own-name";
+
+    g_fDescs[0] = OS_creat(g_fNames[0], OS_READ_WRITE);
+    if (g_fDescs[0] < 0)
+    {
+        testDesc = "#6 Renamed-to-own-name - File-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_closefilebyname_test_exit_tag;
+    }
+
+    if ((OS_rename(g_fNames[0], g_fNames[0]) == OS_FS_SUCCESS) &&
+        (OS_FileOpenCheck(g_fNames[0]) == OS_FS_SUCCESS) &&
+        (OS_CloseFileByName(g_fNames[0]) == OS_FS_SUCCESS))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_CloseFileByName(g_fNames[0]);
+    OS_remove(g_fNames[0]);
+
 UT_os_closefilebyname_test_exit_tag:
     UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_CloseFileByName", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
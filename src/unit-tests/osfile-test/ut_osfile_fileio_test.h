@@ -37,11 +37,19 @@ void UT_os_initfs_test(void);
 
 void UT_os_createfile_test(void);
 void UT_os_openfile_test(void);
+void UT_os_openprealloc_test(void);
 void UT_os_closefile_test(void);
 
 void UT_os_readfile_test(void);
 void UT_os_writefile_test(void);
+void UT_os_readvfile_test(void);
+void UT_os_writevfile_test(void);
+void UT_os_preadfile_test(void);
+void UT_os_pwritefile_test(void);
+void UT_os_fsync_test(void);
+void UT_os_fallocate_test(void);
 void UT_os_lseekfile_test(void);
+void UT_os_largefile_test(void);
 
 void UT_os_chmodfile_test(void);
 void UT_os_statfile_test(void);
@@ -49,9 +57,24 @@ void UT_os_statfile_test(void);
 void UT_os_removefile_test(void);
 void UT_os_renamefile_test(void);
 void UT_os_copyfile_test(void);
+void UT_os_copyfileprogress_test(void);
 void UT_os_movefile_test(void);
 
 void UT_os_outputtofile_test(void);
+void UT_os_outputtofilelimited_test(void);
+
+void UT_os_asyncqueuecreate_test(void);
+void UT_os_asyncqueuedelete_test(void);
+void UT_os_asyncio_test(void);
+
+void UT_os_mmap_test(void);
+void UT_os_mmapfile_test(void);
+void UT_os_msync_madvise_test(void);
+
+void UT_os_streamopen_test(void);
+void UT_os_streamwrite_test(void);
+void UT_os_streamclose_test(void);
+void UT_os_syncgroup_test(void);
 void UT_os_getfdinfo_test(void);
 
 void UT_os_checkfileopen_test(void);
@@ -159,6 +159,7 @@ void UT_main()
 
         UT_os_init_rewinddir_test();
         UT_os_rewinddir_test();
+        UT_os_readdirbatch_test();
 
         UT_os_removedir_test();
 
@@ -166,11 +167,19 @@ void UT_main()
         UT_os_createfile_test();
 
         UT_os_openfile_test();
+        UT_os_openprealloc_test();
         UT_os_closefile_test();
 
         UT_os_readfile_test();
         UT_os_writefile_test();
+        UT_os_readvfile_test();
+        UT_os_writevfile_test();
+        UT_os_preadfile_test();
+        UT_os_pwritefile_test();
+        UT_os_fsync_test();
+        UT_os_fallocate_test();
         UT_os_lseekfile_test();
+        UT_os_largefile_test();
 
         UT_os_chmodfile_test();
         UT_os_statfile_test();
@@ -178,10 +187,25 @@ void UT_main()
         UT_os_removefile_test();
         UT_os_renamefile_test();
         UT_os_copyfile_test();
+        UT_os_copyfileprogress_test();
         UT_os_movefile_test();
 
         UT_os_init_outputtofile_test();
         UT_os_outputtofile_test();
+        UT_os_outputtofilelimited_test();
+
+        UT_os_asyncqueuecreate_test();
+        UT_os_asyncqueuedelete_test();
+        UT_os_asyncio_test();
+
+        UT_os_mmap_test();
+        UT_os_mmapfile_test();
+        UT_os_msync_madvise_test();
+
+        UT_os_streamopen_test();
+        UT_os_streamwrite_test();
+        UT_os_streamclose_test();
+        UT_os_syncgroup_test();
 
         UT_os_getfdinfo_test();
         UT_os_checkfileopen_test();
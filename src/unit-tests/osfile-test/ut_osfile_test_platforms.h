@@ -12,6 +12,8 @@
 **--------------------------------------------------------------------------------*/
 
 #ifdef _LINUX_OS_
+#include <signal.h>
+#include <sys/resource.h>
 #endif  /* _LINUX_OS_ */
 
 #ifdef OSP_ARINC653
@@ -36,6 +38,27 @@ if ((OS_FDGetInfo(g_fDescs[0], &fdProps) != OS_FS_SUCCESS) ||       \
     (fdProps.IsValid != TRUE) ||                                    \
     (strncmp(fdProps.Path, g_fNames[0], strlen(g_fNames[0])) != 0))
 
+/*--------------------------------------------------------------------------------*/
+
+/* Writes past limit bytes fail with EFBIG instead of raising SIGXFSZ */
+#define UT_OS_LIMIT_FILE_SIZE_MACRO(limit)              \
+{                                                       \
+    struct rlimit fsizeLimit;                           \
+    signal(SIGXFSZ, SIG_IGN);                           \
+    getrlimit(RLIMIT_FSIZE, &fsizeLimit);               \
+    fsizeLimit.rlim_cur = (limit);                      \
+    setrlimit(RLIMIT_FSIZE, &fsizeLimit);               \
+}
+
+#define UT_OS_UNLIMIT_FILE_SIZE_MACRO                   \
+{                                                       \
+    struct rlimit fsizeLimit;                           \
+    getrlimit(RLIMIT_FSIZE, &fsizeLimit);               \
+    fsizeLimit.rlim_cur = fsizeLimit.rlim_max;          \
+    setrlimit(RLIMIT_FSIZE, &fsizeLimit);               \
+    signal(SIGXFSZ, SIG_DFL);                           \
+}
+
 /*--------------------------------------------*/
 #endif  /* _LINUX_OS_ */
 /*--------------------------------------------*/
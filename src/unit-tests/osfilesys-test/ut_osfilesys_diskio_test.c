@@ -991,6 +991,15 @@ UT_os_getfsinfo_test_exit_tag:
 **   7) Expect the returned value to be
 **        (a) OS_FS_SUCCESS __and__
 **        (b) the returned local path to be ?
+** -----------------------------------------------------
+** Test #5: Nested-mount-point condition
+**   1) Call OS_mkfs and OS_mount to mount a second file system on a directory
+**      below the mount-point used in #4
+**   2) Call this routine with a path below the second mount-point
+**   3) Expect the local path to start with the physical drive of the second file system
+**   4) Call this routine with a path that only shares a prefix with the second
+**      mount-point, but not a whole path component
+**   5) Expect the local path to start with the physical drive of the first file system
 ** --------------------------------------------------------------------------------*/
 void UT_os_translatepath_test()
 {
@@ -998,6 +1007,10 @@ void UT_os_translatepath_test()
     UT_OsApiInfo_t apiInfo;
     const char* testDesc=NULL;
     char localPath[UT_OS_LG_TEXT_LEN];
+    char outerDrive[OS_FS_PHYS_NAME_LEN];
+    char innerDrive[OS_FS_PHYS_NAME_LEN];
+    char nestedMnt[OS_MAX_PATH_LEN];
+    char virtPath[UT_OS_LG_TEXT_LEN];
 
     UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
 
@@ -1065,7 +1078,53 @@ void UT_os_translatepath_test()
     else
         UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
 
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nested-mount-point";
+
+    memset(nestedMnt, '\0', sizeof(nestedMnt));
+    UT_os_sprintf(nestedMnt, "%s/nested", g_mntNames[4]);
+
+    if ((OS_mkfs(g_fsAddrPtr, g_devNames[5], g_volNames[5], g_blkSize, g_blkCnt) != OS_FS_SUCCESS) ||
+        (OS_mount(g_devNames[5], nestedMnt) != OS_FS_SUCCESS))
+    {
+        testDesc = "#5 Nested-mount-point - File-system-mount failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        memset(outerDrive, '\0', sizeof(outerDrive));
+        memset(innerDrive, '\0', sizeof(innerDrive));
+        OS_FS_GetPhysDriveName(outerDrive, g_mntNames[4]);
+        OS_FS_GetPhysDriveName(innerDrive, nestedMnt);
+
+        memset(virtPath, '\0', sizeof(virtPath));
+        UT_os_sprintf(virtPath, "%s/file.txt", nestedMnt);
+        res = OS_TranslatePath(virtPath, localPath);
+
+        if ((res == OS_FS_SUCCESS) &&
+            (strncmp(localPath, innerDrive, strlen(innerDrive)) == 0) &&
+            (strcmp(localPath + strlen(innerDrive), "/file.txt") == 0))
+        {
+            UT_os_sprintf(virtPath, "%sX/file.txt", nestedMnt);
+            res = OS_TranslatePath(virtPath, localPath);
+        }
+        else
+        {
+            res = OS_FS_ERROR;
+        }
+
+        if ((res == OS_FS_SUCCESS) &&
+            (strncmp(localPath, outerDrive, strlen(outerDrive)) == 0) &&
+            (strcmp(localPath + strlen(outerDrive), "/nestedX/file.txt") == 0))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        OS_unmount(nestedMnt);
+    }
+
     /* Reset test environment */
+    OS_rmfs(g_devNames[5]);
     OS_unmount(g_mntNames[4]);
     OS_rmfs(g_devNames[4]);
 
@@ -12,6 +12,7 @@
 **--------------------------------------------------------------------------------*/
 
 #ifdef _LINUX_OS_
+#include <unistd.h>
 #endif  /* _LINUX_OS_ */
 
 #ifdef OSP_ARINC653
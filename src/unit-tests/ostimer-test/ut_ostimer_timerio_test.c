@@ -38,6 +38,7 @@ UT_OS_TIMER_DECLARE_EXTRA_VARIABLES_MACRO
 **--------------------------------------------------------------------------------*/
 
 extern void UT_os_timercallback(uint32 timerId);
+extern void UT_os_timeraddcallback(uint32 timerId, void *arg);
 
 /*--------------------------------------------------------------------------------*
 ** Global variables
@@ -50,10 +51,22 @@ uint32  g_timerIds[UT_OS_TIMER_LIST_LEN];
 ** Local function prototypes
 **--------------------------------------------------------------------------------*/
 
+void UT_os_slowtimercallback(uint32 timerId, void *arg);
+
 /*--------------------------------------------------------------------------------*
 ** Local function definitions
 **--------------------------------------------------------------------------------*/
 
+/* Sets the first flag when it starts and the second once it has slept for a while */
+void UT_os_slowtimercallback(uint32 timerId, void *arg)
+{
+    volatile uint32 *flags = (volatile uint32 *)arg;
+
+    flags[0] = 1;
+    OS_TaskDelay(50);
+    flags[1] = 1;
+}
+
 /* Test code template for testing a single OSAL API with multiple test cases */
 
 #if 0
@@ -461,12 +474,23 @@ UT_os_timercreate_test_exit_tag:
 **   7) Call OS_TimerCreate exactly as in #1
 **   8) Expect the returned value to be
 **        (a) OS_SUCCESS
+** -----------------------------------------------------
+** Test #4: Callback-running condition
+**   1) Call OS_TimerAdd to add a timer with a slow callback to a new time base,
+**      and arm it
+**   2) Wait for the callback to start
+**   3) Call this routine with the timer id returned in #1 as argument
+**   4) Expect the returned value to be
+**        (a) OS_SUCCESS __and__
+**        (b) the callback to have finished
 **--------------------------------------------------------------------------------*/
 void UT_os_timerdelete_test()
 {
-    int32 res=0, idx=0;
+    int32 res=0, idx=0, i=0;
     UT_OsApiInfo_t apiInfo;
     const char* testDesc=NULL;
+    uint32 timebaseId=0, timerId=0;
+    volatile uint32 flags[2] = { 0, 0 };
 
     UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
 
@@ -521,6 +545,36 @@ void UT_os_timerdelete_test()
     /* Reset test environment */
     OS_TimerDelete(g_timerIds[3]);
 
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Callback-running";
+
+    if ((OS_TimeBaseCreate(&timebaseId, "TB_DelTimer", NULL) != OS_SUCCESS) ||
+        (OS_TimeBaseSet(timebaseId, 10000, 10000) != OS_SUCCESS) ||
+        (OS_TimerAdd(&timerId, "Slow_Timer", timebaseId, &UT_os_slowtimercallback, (void *)flags) != OS_SUCCESS) ||
+        (OS_TimerSet(timerId, 10000, 0) != OS_SUCCESS))
+    {
+        testDesc = "#4 Callback-running - Timer-add failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        for (i=0; i < 100 && flags[0] == 0; i++)
+            OS_TaskDelay(5);
+
+        if (flags[0] == 0)
+        {
+            testDesc = "#4 Callback-running - Callback did not run";
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        }
+        else if ((OS_TimerDelete(timerId) == OS_SUCCESS) && (flags[1] == 1))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_TimeBaseDelete(timebaseId);
+
 UT_os_timerdelete_test_exit_tag:
     UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimerDelete", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
@@ -799,6 +853,14 @@ UT_os_timergetidbyname_test_exit_tag:
 **   4) Expect the returned value to be
 **       (a) OS_SUCCESS __and__
 **       (b) timer name returned for timer properties is the same as timer name used in #1
+** -----------------------------------------------------
+** Test #4: Statistics condition
+**   1) Add a 10 msec periodic timer to a 10 msec time base and let it run for 205 msecs
+**   2) Call this routine with the timer id
+**   3) Expect the returned value to be
+**       (a) OS_SUCCESS __and__
+**       (b) a fire count of 15 to 21, matching the sum of the latency histogram __and__
+**       (c) min latency <= mean latency <= max latency
 **--------------------------------------------------------------------------------*/
 void UT_os_timergetinfo_test()
 {
@@ -806,6 +868,7 @@ void UT_os_timergetinfo_test()
     UT_OsApiInfo_t apiInfo;
     const char* testDesc=NULL;
     OS_timer_prop_t timerProps;
+    uint32 timebaseId=0, timerId=0, count=0, histTotal=0, i=0;
 
     UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
 
@@ -877,11 +940,729 @@ void UT_os_timergetinfo_test()
         OS_TimerDelete(g_timerIds[3]);
     }
 
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Statistics";
+
+    if ((OS_TimeBaseCreate(&timebaseId, "TB_Stats", NULL) != OS_SUCCESS) ||
+        (OS_TimerAdd(&timerId, "Stats_Timer", timebaseId, &UT_os_timeraddcallback, &count) != OS_SUCCESS))
+    {
+        testDesc = "#4 Statistics - Timer-add failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        OS_TimerSet(timerId, 10000, 10000);
+        OS_TimeBaseSet(timebaseId, 10000, 10000);
+
+        OS_TaskDelay(205);
+
+        OS_TimeBaseSet(timebaseId, 0, 0);
+
+        memset(&timerProps, 0x00, sizeof(timerProps));
+        res = OS_TimerGetInfo(timerId, &timerProps);
+
+        histTotal = 0;
+        for (i=0; i < OS_TIMER_LATENCY_BUCKETS; i++)
+            histTotal += timerProps.latency_histogram[i];
+
+        UT_OS_LOG_MACRO("\nOS_TimerGetInfo() - #4 Statistics [%d callbacks, %d overruns, latency min %d mean %d max %d usecs]\n",
+                        (int)timerProps.fire_count, (int)timerProps.overrun_count, (int)timerProps.min_latency,
+                        (int)timerProps.mean_latency, (int)timerProps.max_latency);
+
+        if ((res == OS_SUCCESS) && (timerProps.fire_count == 0) && (count > 0))
+        {
+            testDesc = "#4 Statistics - Not supported on platform";
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        }
+        else if ((res == OS_SUCCESS) &&
+                 (timerProps.fire_count >= 15) && (timerProps.fire_count <= 21) &&
+                 (histTotal == timerProps.fire_count) &&
+                 (timerProps.min_latency <= timerProps.mean_latency) &&
+                 (timerProps.mean_latency <= timerProps.max_latency))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment - deletes the timer as well */
+    OS_TimeBaseDelete(timebaseId);
+
 UT_os_timergetinfo_test_exit_tag:
     UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimerGetInfo", idx)
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*
+** External sync function for the time base tests: one tick every 2 msec
+**--------------------------------------------------------------------------------*/
+volatile uint32 g_syncCount = 0;
+
+int32 UT_os_timebasesync(uint32 timebaseId)
+{
+    OS_TaskDelay(2);
+    g_syncCount++;
+    return 1;
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimeBaseCreate(uint32 *timer_id, const char *timebase_name,
+**                                 OS_TimerSync_t external_sync)
+** Purpose: Creates a new time base
+** Parameters: *timer_id - a pointer that will hold the time base id
+**             *timebase_name - a pointer that holds the name of the time base
+**             external_sync - optional function that waits for an external tick
+** Returns: OS_INVALID_POINTER if any of the pointers passed in is null
+**          OS_ERR_NAME_TOO_LONG if the name passed in is too long
+**          OS_ERR_NAME_TAKEN if the name passed in has already been used
+**          OS_ERR_NO_FREE_IDS if there are no more free time base ids
+**          OS_TIMER_ERR_UNAVAILABLE if the time base cannot be created
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_timebasecreate_test()
+{
+    int32 res=0, idx=0, i=0, j=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    char tmpStr[UT_OS_XS_TEXT_LEN];
+    uint32 timebaseIds[OS_MAX_TIMEBASES+1];
+    uint32 timerId=0, count=0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimeBaseCreate(&timebaseIds[0], "TB_NotImpl", NULL);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timebasecreate_test_exit_tag;
+    }
+
+    /* Reset test environment */
+    OS_TimeBaseDelete(timebaseIds[0]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_TimeBaseCreate(NULL, "TB_NullPtr", NULL) == OS_INVALID_POINTER) &&
+        (OS_TimeBaseCreate(&timebaseIds[0], NULL, NULL) == OS_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Name-too-long";
+
+    if (OS_TimeBaseCreate(&timebaseIds[0], g_longTimerName, NULL) == OS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Name-taken";
+
+    if (OS_TimeBaseCreate(&timebaseIds[0], "TB_DuplName", NULL) != OS_SUCCESS)
+    {
+        testDesc = "#3 Name-taken - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        if (OS_TimeBaseCreate(&timebaseIds[1], "TB_DuplName", NULL) == OS_ERR_NAME_TAKEN)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        OS_TimeBaseDelete(timebaseIds[0]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 No-free-IDs";
+
+    for (i=0; i <= OS_MAX_TIMEBASES; i++)
+    {
+        memset(tmpStr, '\0', sizeof(tmpStr));
+        UT_os_sprintf(tmpStr, "TimeBase #%d", (int)i);
+        res = OS_TimeBaseCreate(&timebaseIds[i], tmpStr, NULL);
+        if (res != OS_SUCCESS)
+            break;
+    }
+
+    if ((i == OS_MAX_TIMEBASES) && (res == OS_ERR_NO_FREE_IDS))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    for (j=0; j < i; j++)
+        OS_TimeBaseDelete(timebaseIds[j]);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    res = OS_TimeBaseCreate(&timebaseIds[0], "TB_Nominal", NULL);
+    if ((res == OS_SUCCESS) && (OS_TimeBaseDelete(timebaseIds[0]) == OS_SUCCESS))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 External-sync";
+
+#ifdef OS_VIRTUAL_TIME
+    /*
+    ** Pulses from outside the OSAL do not hold the virtual clock, so the
+    ** delay below would be over before the time base saw any of them
+    */
+    testDesc = "#6 External-sync - Not applicable with virtual time";
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+    goto UT_os_timebasecreate_test_exit_tag;
+#endif
+
+    g_syncCount = 0;
+    count = 0;
+    if ((OS_TimeBaseCreate(&timebaseIds[0], "TB_ExtSync", &UT_os_timebasesync) != OS_SUCCESS) ||
+        (OS_TimeBaseSet(timebaseIds[0], 2000, 2000) != OS_SUCCESS) ||
+        (OS_TimerAdd(&timerId, "ExtSync_Timer", timebaseIds[0], &UT_os_timeraddcallback, &count) != OS_SUCCESS) ||
+        (OS_TimerSet(timerId, 2000, 2000) != OS_SUCCESS))
+    {
+        testDesc = "#6 External-sync - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        OS_TaskDelay(100);
+        OS_TimerSet(timerId, 0, 0);
+
+        /* Every pulse is one tick, so the timer fires on every pulse it sees */
+        if ((count > 0) && (count <= g_syncCount))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    OS_TimeBaseDelete(timebaseIds[0]);
+
+UT_os_timebasecreate_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimeBaseCreate", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimeBaseGetIdByName(uint32 *timer_id, const char *timebase_name)
+** Purpose: Returns the time base id of a given time base name
+** Parameters: *timer_id - a pointer that will hold the time base id
+**             *timebase_name - a pointer that holds the time base name
+** Returns: OS_INVALID_POINTER if any of the pointers passed in is null
+**          OS_ERR_NAME_TOO_LONG if the name passed in is too long
+**          OS_ERR_NAME_NOT_FOUND if the name passed in is not found
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_timebasegetidbyname_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    uint32 timebaseId=0, foundId=0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimeBaseGetIdByName(&foundId, "TB_NotImpl");
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timebasegetidbyname_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_TimeBaseGetIdByName(NULL, "TB_NullPtr") == OS_INVALID_POINTER) &&
+        (OS_TimeBaseGetIdByName(&foundId, NULL) == OS_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Name-too-long";
+
+    if (OS_TimeBaseGetIdByName(&foundId, g_longTimerName) == OS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Name-not-found";
+
+    if (OS_TimeBaseGetIdByName(&foundId, "TB_NotFound") == OS_ERR_NAME_NOT_FOUND)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Nominal";
+
+    if (OS_TimeBaseCreate(&timebaseId, "TB_Nominal", NULL) != OS_SUCCESS)
+    {
+        testDesc = "#4 Nominal - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timebasegetidbyname_test_exit_tag;
+    }
+
+    res = OS_TimeBaseGetIdByName(&foundId, "TB_Nominal");
+    if ((res == OS_SUCCESS) && (foundId == timebaseId))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /* Reset test environment */
+    OS_TimeBaseDelete(timebaseId);
+
+UT_os_timebasegetidbyname_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimeBaseGetIdByName", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimeBaseCreateFd(uint32 *timer_id, const char *timebase_name, int32 sync_fd)
+** Purpose: Creates a time base that ticks when the given file descriptor is readable
+** Parameters: *timer_id - a pointer that will hold the time base id
+**             *timebase_name - a pointer that holds the time base name
+**             sync_fd - the file descriptor that drives the time base
+** Returns: OS_INVALID_POINTER if any of the pointers passed in is null
+**          OS_TIMER_ERR_INVALID_ARGS if the file descriptor is not valid
+**          OS_ERR_NAME_TOO_LONG if the name passed in is too long
+**          OS_ERR_NAME_TAKEN if the name passed in has already been used
+**          OS_ERR_NO_FREE_IDS if there are no more free time base ids
+**          OS_SUCCESS if succeeded
+** -----------------------------------------------------
+** The wheel-boundary case drives a 1 msec time base one byte per tick and
+** arms a timer that is due on every second 64 tick boundary of the timing
+** wheel, then checks that each callback comes on its own tick, neither
+** early nor late, and that the periods do not drift
+**--------------------------------------------------------------------------------*/
+void UT_os_timebasecreatefd_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    uint32 timebaseId=0;
+#ifdef _LINUX_OS_
+    uint32 timerId=0, count=0, i=0;
+    int pipeFds[2];
+    char pulse = 0;
+    char pulses[127];
+#endif  /* _LINUX_OS_ */
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimeBaseCreateFd(&timebaseId, "TB_NotImpl", 0);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timebasecreatefd_test_exit_tag;
+    }
+
+    /* Reset test environment */
+    OS_TimeBaseDelete(timebaseId);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Null-pointer-arg";
+
+    if ((OS_TimeBaseCreateFd(NULL, "TB_NullPtr", 0) == OS_INVALID_POINTER) &&
+        (OS_TimeBaseCreateFd(&timebaseId, NULL, 0) == OS_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-fd-arg";
+
+    if (OS_TimeBaseCreateFd(&timebaseId, "TB_InvFd", -1) == OS_TIMER_ERR_INVALID_ARGS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Pipe-sync";
+
+#ifdef _LINUX_OS_
+    if (pipe(pipeFds) != 0)
+    {
+        testDesc = "#3 Pipe-sync - Pipe-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timebasecreatefd_test_exit_tag;
+    }
+
+    if ((OS_TimeBaseCreateFd(&timebaseId, "TB_Pipe", pipeFds[0]) != OS_SUCCESS) ||
+        (OS_TimeBaseSet(timebaseId, 10000, 10000) != OS_SUCCESS) ||
+        (OS_TimerAdd(&timerId, "Pipe_Timer", timebaseId, &UT_os_timeraddcallback, &count) != OS_SUCCESS) ||
+        (OS_TimerSet(timerId, 30000, 30000) != OS_SUCCESS))
+    {
+        testDesc = "#3 Pipe-sync - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        /*
+        ** Every byte is one 10 msec tick, so the 30 msec timer fires on every
+        ** third, counted from the tick after it was set
+        */
+        for (i=0; i < 10; i++)
+        {
+            if (write(pipeFds[1], &pulse, 1) != 1)
+                break;
+            OS_TaskDelay(10);
+        }
+        OS_TaskDelay(20);
+
+        if (count == 3)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment; the time base must stop on end of file too */
+    close(pipeFds[1]);
+    OS_TaskDelay(10);
+    OS_TimeBaseDelete(timebaseId);
+    close(pipeFds[0]);
+#else
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+#endif  /* _LINUX_OS_ */
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Wheel-boundary";
+
+#ifdef _LINUX_OS_
+    if (pipe(pipeFds) != 0)
+    {
+        testDesc = "#4 Wheel-boundary - Pipe-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timebasecreatefd_test_exit_tag;
+    }
+
+    count = 0;
+    memset(pulses, 0, sizeof(pulses));
+    if ((OS_TimeBaseCreateFd(&timebaseId, "TB_Wheel", pipeFds[0]) != OS_SUCCESS) ||
+        (OS_TimeBaseSet(timebaseId, 1000, 1000) != OS_SUCCESS) ||
+        (OS_TimerAdd(&timerId, "Wheel_Timer", timebaseId, &UT_os_timeraddcallback, &count) != OS_SUCCESS) ||
+        (OS_TimerSet(timerId, 127000, 128000) != OS_SUCCESS))
+    {
+        testDesc = "#4 Wheel-boundary - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        /*
+        ** The timer is due on ticks 128, 256 and 384, each cascaded down from
+        ** the second level of the wheel. Run up to the tick before each one
+        ** and check the count, then run the tick itself and check again.
+        */
+        res = OS_SUCCESS;
+        for (i=1; i <= 3; i++)
+        {
+            if (write(pipeFds[1], pulses, sizeof(pulses)) != (ssize_t)sizeof(pulses))
+                break;
+            OS_TaskDelay(20);
+            if (count != i - 1)
+                res = OS_ERROR;
+
+            if (write(pipeFds[1], &pulse, 1) != 1)
+                break;
+            OS_TaskDelay(20);
+            if (count != i)
+                res = OS_ERROR;
+        }
+
+        if ((i > 3) && (res == OS_SUCCESS))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment */
+    close(pipeFds[1]);
+    OS_TaskDelay(10);
+    OS_TimeBaseDelete(timebaseId);
+    close(pipeFds[0]);
+#else
+    UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+#endif  /* _LINUX_OS_ */
+
+UT_os_timebasecreatefd_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimeBaseCreateFd", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimerAdd(uint32 *timer_id, const char *timer_name, uint32 timebase_id,
+**                           OS_ArgCallback_t callback_ptr, void *callback_arg)
+** Purpose: Creates a new timer on an existing time base
+** Parameters: *timer_id - a pointer that will hold the timer id
+**             *timer_name - a pointer that holds the name of the timer
+**             timebase_id - the time base that drives the timer
+**             callback_ptr - a function pointer to the timer's callback
+**             callback_arg - passed to the callback
+** Returns: OS_INVALID_POINTER if any of the pointers passed in is null
+**          OS_ERR_NAME_TOO_LONG if the name passed in is too long
+**          OS_TIMER_ERR_INVALID_ARGS if the callback pointer is null
+**          OS_ERR_INVALID_ID if the time base id is not valid
+**          OS_SUCCESS if succeeded
+** -----------------------------------------------------
+** The nominal case runs two timers on one 10 msec time base, firing every
+** 20 and 50 msecs, and checks that each callback gets its own argument
+** -----------------------------------------------------
+** The many-timers case fills the timer table with one-shot timers on a
+** 1 msec time base, due 1 to 200 ticks out, and checks that each fires once
+**--------------------------------------------------------------------------------*/
+void UT_os_timeradd_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    uint32 timebaseId=0, timerIds[2];
+    uint32 counts[2] = {0, 0};
+    static uint32 manyCounts[UT_OS_TIMER_LIST_LEN];
+    char tmpStr[UT_OS_XS_TEXT_LEN];
+    uint32 i=0, numAdded=0, numOnce=0;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimerAdd(&timerIds[0], "Add_NotImpl", 99999, &UT_os_timeraddcallback, &counts[0]);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timeradd_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-id-arg";
+
+    if ((OS_TimerAdd(&timerIds[0], "Add_InvId", 99999, &UT_os_timeraddcallback, &counts[0]) == OS_ERR_INVALID_ID) &&
+        (OS_TimeBaseSet(99999, 10000, 10000) == OS_ERR_INVALID_ID) &&
+        (OS_TimeBaseDelete(99999) == OS_ERR_INVALID_ID))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    if (OS_TimeBaseCreate(&timebaseId, "TB_Add", NULL) != OS_SUCCESS)
+    {
+        testDesc = "#2 Null-pointer-arg - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timeradd_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Null-pointer-arg";
+
+    if ((OS_TimerAdd(NULL, "Add_NullPtr", timebaseId, &UT_os_timeraddcallback, NULL) == OS_INVALID_POINTER) &&
+        (OS_TimerAdd(&timerIds[0], NULL, timebaseId, &UT_os_timeraddcallback, NULL) == OS_INVALID_POINTER))
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Name-too-long";
+
+    if (OS_TimerAdd(&timerIds[0], g_longTimerName, timebaseId, &UT_os_timeraddcallback, NULL) == OS_ERR_NAME_TOO_LONG)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#4 Invalid-arg";
+
+    if (OS_TimerAdd(&timerIds[0], "Add_InvArg", timebaseId, NULL, NULL) == OS_TIMER_ERR_INVALID_ARGS)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#5 Nominal";
+
+    if ((OS_TimerAdd(&timerIds[0], "Add_Nominal1", timebaseId, &UT_os_timeraddcallback, &counts[0]) != OS_SUCCESS) ||
+        (OS_TimerAdd(&timerIds[1], "Add_Nominal2", timebaseId, &UT_os_timeraddcallback, &counts[1]) != OS_SUCCESS))
+    {
+        testDesc = "#5 Nominal - Timer-add failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        OS_TimerSet(timerIds[0], 20000, 20000);
+        OS_TimerSet(timerIds[1], 50000, 50000);
+        res = OS_TimeBaseSet(timebaseId, 10000, 10000);
+
+        OS_TaskDelay(1010);
+
+        OS_TimeBaseSet(timebaseId, 0, 0);
+
+        UT_OS_LOG_MACRO("\nOS_TimerAdd() - #5 Nominal [20 msec timer fired %d times, 50 msec timer %d times]\n",
+                        (int)counts[0], (int)counts[1]);
+
+        if ((res == OS_SUCCESS) &&
+            (counts[0] >= 45) && (counts[0] <= 51) &&
+            (counts[1] >= 18) && (counts[1] <= 21))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment - deletes the timers as well */
+    OS_TimeBaseDelete(timebaseId);
+
+    /*-----------------------------------------------------*/
+    testDesc = "#6 Many-timers";
+
+    if (OS_TimeBaseCreate(&timebaseId, "TB_Many", NULL) != OS_SUCCESS)
+    {
+        testDesc = "#6 Many-timers - Time-base-create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        goto UT_os_timeradd_test_exit_tag;
+    }
+
+    memset(manyCounts, 0, sizeof(manyCounts));
+    for (numAdded=0; numAdded < OS_MAX_TIMERS; numAdded++)
+    {
+        UT_os_sprintf(tmpStr, "Add_Many%d", (int)numAdded);
+        if (OS_TimerAdd(&g_timerIds[numAdded], tmpStr, timebaseId,
+                        &UT_os_timeraddcallback, &manyCounts[numAdded]) != OS_SUCCESS)
+            break;
+        OS_TimerSet(g_timerIds[numAdded], ((numAdded % 200) + 1) * 1000, 0);
+    }
+
+    if (numAdded < OS_MAX_TIMERS)
+    {
+        testDesc = "#6 Many-timers - Timer-add failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        res = OS_TimeBaseSet(timebaseId, 1000, 1000);
+
+        OS_TaskDelay(500);
+
+        OS_TimeBaseSet(timebaseId, 0, 0);
+
+        for (i=0; i < numAdded; i++)
+        {
+            if (manyCounts[i] == 1)
+                numOnce++;
+        }
+
+        UT_OS_LOG_MACRO("\nOS_TimerAdd() - #6 Many-timers [%d of %d one-shot timers fired once]\n",
+                        (int)numOnce, (int)numAdded);
+
+        if ((res == OS_SUCCESS) && (numOnce == numAdded))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment - deletes the timers as well */
+    OS_TimeBaseDelete(timebaseId);
+
+UT_os_timeradd_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimerAdd", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TimerSet64(uint32 timer_id, uint64 start_time, uint64 interval_time)
+** Purpose: Programs a timer with 64 bit start and interval times in microseconds
+** Parameters: timer_id - id of the timer to be programmed
+**             start_time - start time in microseconds
+**             interval_time - interval time in microseconds
+** Returns: OS_ERR_INVALID_ID if the timer id passed in is not a valid timer id
+**          OS_TIMER_ERR_INVALID_ARGS if the times are not supported
+**          OS_TIMER_ERR_INTERNAL if the OS call failed
+**          OS_SUCCESS if succeeded
+** -----------------------------------------------------
+** The long-period case arms a timer 5000 secs out, past the 32 bit limit,
+** and checks that it is accepted, reported as the largest 32 bit time by
+** OS_TimerGetInfo, and does not fire early
+**--------------------------------------------------------------------------------*/
+void UT_os_timerset64_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    const char* testDesc=NULL;
+    uint32 timebaseId=0, timerId=0;
+    uint32 count=0;
+    OS_timer_prop_t timerProp;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TimerSet64(99999, 0, 0);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_timerset64_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-id-arg";
+
+    if (res == OS_ERR_INVALID_ID)
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Long-period";
+
+    if ((OS_TimeBaseCreate(&timebaseId, "TB_Set64", NULL) != OS_SUCCESS) ||
+        (OS_TimerAdd(&timerId, "Set64_Timer", timebaseId, &UT_os_timeraddcallback, &count) != OS_SUCCESS))
+    {
+        testDesc = "#2 Long-period - Timer-add failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+        OS_TimeBaseDelete(timebaseId);
+        goto UT_os_timerset64_test_exit_tag;
+    }
+
+    OS_TimeBaseSet(timebaseId, 1000, 1000);
+    res = OS_TimerSet64(timerId, (uint64)5000 * 1000000, (uint64)5000 * 1000000);
+    if (res == OS_TIMER_ERR_INVALID_ARGS)
+    {
+        testDesc = "#2 Long-period - Not supported on platform";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+    }
+    else
+    {
+        OS_TaskDelay(50);
+        memset(&timerProp, 0, sizeof(timerProp));
+        OS_TimerGetInfo(timerId, &timerProp);
+
+        if ((res == OS_SUCCESS) && (count == 0) &&
+            (timerProp.start_time == 0xFFFFFFFF) && (timerProp.interval_time == 0xFFFFFFFF))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+    }
+
+    /* Reset test environment - deletes the timer as well */
+    OS_TimeBaseDelete(timebaseId);
+
+UT_os_timerset64_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TimerSet64", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*================================================================================*
 ** End of File: ut_ostimer_timerio_test.c
 **================================================================================*/
@@ -42,6 +42,12 @@ void UT_os_timerset_test(void);
 void UT_os_timergetidbyname_test(void);
 void UT_os_timergetinfo_test(void);
 
+void UT_os_timebasecreate_test(void);
+void UT_os_timebasegetidbyname_test(void);
+void UT_os_timebasecreatefd_test(void);
+void UT_os_timeradd_test(void);
+void UT_os_timerset64_test(void);
+
 /*--------------------------------------------------------------------------------*/
 
 #endif  /* _UT_OSTIMER_TIMERIO_TEST_H_ */